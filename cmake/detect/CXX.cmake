@@ -41,8 +41,17 @@ set(NOEXCEPT_CODE
      void Foo( const std::vector<int>& x ) noexcept { }
      int main()
      { return 0; }")
+set(MMAP_CODE
+    "#include <sys/mman.h>
+     int main()
+     {
+         void* ptr = mmap( 0, 4096, PROT_READ, MAP_SHARED, -1, 0 );
+         munmap( ptr, 4096 );
+         return 0;
+     }")
 check_cxx_source_compiles("${STEADYCLOCK_CODE}" EL_HAVE_STEADYCLOCK)
 check_cxx_source_compiles("${NOEXCEPT_CODE}" EL_HAVE_NOEXCEPT)
+check_cxx_source_compiles("${MMAP_CODE}" EL_HAVE_MMAP)
 
 # C++11 random number generation
 # ==============================
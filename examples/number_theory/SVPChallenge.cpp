@@ -96,6 +96,10 @@ int main( int argc, char* argv[] )
         const bool probEnum =
           Input("--probEnum","probabalistic enumeration *after* BKZ?",true);
         const bool fullEnum = Input("--fullEnum","SVP via full enum?",false);
+        const bool parallelEnum =
+          Input("--parallelEnum","enumerate with a team of threads?",false);
+        const Int splitDepth =
+          Input("--splitDepth","depth at which to split enum trees",8);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec =
           Input("--prec","MPFR precision",mpfr_prec_t(1024));
@@ -182,6 +186,8 @@ int main( int argc, char* argv[] )
         ctrl.enumCtrl.phaseLength = phaseLength;
         ctrl.enumCtrl.enqueueProb = enqueueProb;
         ctrl.enumCtrl.progressLevel = progressLevel;
+        ctrl.enumCtrl.parallel = parallelEnum;
+        ctrl.enumCtrl.splitDepth = splitDepth;
         ctrl.earlyAbort = earlyAbort;
         ctrl.numEnumsBeforeAbort = numEnumsBeforeAbort;
         ctrl.subBKZ = subBKZ;
@@ -300,6 +306,8 @@ int main( int argc, char* argv[] )
             Timer timer;
             Matrix<F> v;
             EnumCtrl<Real> enumCtrl;
+            enumCtrl.parallel = parallelEnum;
+            enumCtrl.splitDepth = splitDepth;
             enumCtrl.enumType = ( probEnum ? GNR_ENUM : FULL_ENUM );
             timer.Start();
             Real result;
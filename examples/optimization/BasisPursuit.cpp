@@ -22,6 +22,8 @@ main( int argc, char* argv[] )
         const Int n = Input("--n","width of matrix",200);
         const bool useIPM = Input("--useIPM","use Interior Point?",true);
         // TODO: Add options for controlling IPM
+        const Int maxGondzio =
+          Input("--maxGondzio","max # of Gondzio correctors per IPM iter",0);
         const Int maxIter = Input("--maxIter","maximum # of iter's",500);
         const Real rho = Input("--rho","augmented Lagrangian param.",1.);
         const Real alpha = Input("--alpha","over-relaxation",1.2);
@@ -49,6 +51,7 @@ main( int argc, char* argv[] )
         const bool sparse = false;
         BPCtrl<Real> ctrl(sparse);
         ctrl.useIPM = useIPM;
+        ctrl.lpIPMCtrl.mehrotraCtrl.maxGondzioCorrectors = maxGondzio;
         ctrl.admmCtrl.rho = rho;
         ctrl.admmCtrl.alpha = alpha;
         ctrl.admmCtrl.maxIter = maxIter;
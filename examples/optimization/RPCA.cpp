@@ -69,6 +69,12 @@ main( int argc, char* argv[] )
             Input("--usePivQR","use pivoted QR approx?",false);
         const Int numPivSteps = 
             Input("--numPivSteps","number of steps of QR",75);
+        const bool useRandomized =
+            Input("--useRandomized","use randomized SVD approx?",false);
+        const Int randRank =
+            Input("--randRank","initial rank of randomized SVD",10);
+        const Int numPowerIts =
+            Input("--numPowerIts","number of randomized power iterations",2);
         const bool useALM = Input("--useALM","use ALM algorithm?",true);
         const bool display = Input("--display","display matrices",true);
         const bool print = Input("--print","print matrices",false);
@@ -137,6 +143,9 @@ main( int argc, char* argv[] )
         ctrl.usePivQR = usePivQR;
         ctrl.progress = print;
         ctrl.numPivSteps = numPivSteps;
+        ctrl.useRandomized = useRandomized;
+        ctrl.randomizedCtrl.rank = randRank;
+        ctrl.randomizedCtrl.numPowerIts = numPowerIts;
         ctrl.maxIts = maxIts;
         ctrl.tau = tau;
         ctrl.beta = beta;
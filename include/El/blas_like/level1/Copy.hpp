@@ -242,18 +242,19 @@ void Copy( const SparseMatrix<S>& A, Matrix<T>& B )
     DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
-    const Int numEntries = A.NumEntries();
     const S* AValBuf = A.LockedValueBuffer();
-    const Int* ARowBuf = A.LockedSourceBuffer();
     const Int* AColBuf = A.LockedTargetBuffer();
+    const Int* AOffsetBuf = A.LockedOffsetBuffer();
     
+    B.Resize( m, n );
+    Zero( B );
     T* BBuf = B.Buffer();
     const Int BLDim = B.LDim();
     
-    B.Resize( m, n );
-    Zero( B );
-    for( Int e=0; e<numEntries; ++e )
-        BBuf[ARowBuf[e]+AColBuf[e]*BLDim] = Caster<S,T>::Cast(AValBuf[e]);
+    // Walk the rows so that compressed storage need not be expanded
+    for( Int i=0; i<m; ++i )
+        for( Int e=AOffsetBuf[i]; e<AOffsetBuf[i+1]; ++e )
+            BBuf[i+AColBuf[e]*BLDim] = Caster<S,T>::Cast(AValBuf[e]);
 }
 
 template<typename T>
@@ -12,149 +12,249 @@
 namespace El {
 namespace copy {
 
+// Redistribution plans
+// ====================
+// Since every process can determine the owners of each entry from the
+// distributions of A and B alone, the entries sent from one process to
+// another are packed in a canonical order (column-major over the rows and
+// columns which they share, in increasing global order) so that only the
+// values need to be transmitted. The index lists of each plan are computed
+// in time linear in the local sizes without any communication, and plans are
+// cached for subsequent redistributions between the same layouts.
+
+struct RedistPlan
+{
+    // Only the first member of each redundant team of A (B) sends (receives)
+    bool sending=false, receiving=false;
+
+    // The local rows (columns) of A owned by each process row (column) of B,
+    // and the local rows (columns) of B owned by each process row (column)
+    // of A, in increasing global order
+    vector<vector<Int>> sendRows, sendCols, recvRows, recvCols;
+
+    // The process row and column of B (A) whose portion each member of the
+    // communicator receives (sends), or -1 if it receives (sends) nothing
+    vector<int> destRows, destCols, srcRows, srcCols;
+
+    // The entries kept by this process are copied directly rather than sent
+    vector<int> sendCounts, sendOffs, recvCounts, recvOffs;
+    int totalSend=0, totalRecv=0;
+};
+
+struct RedistPlanKey
+{
+    size_t AGUID, BGUID;
+    vector<Int> meta;
+};
+bool operator<( const RedistPlanKey& a, const RedistPlanKey& b );
+
+// Returns a null pointer if the plan has not been cached
+RedistPlan* FindRedistPlan( const RedistPlanKey& key );
+RedistPlan& NewRedistPlan( const RedistPlanKey& key );
+void ClearRedistPlans();
+
+template<typename S,typename T>
+RedistPlanKey MakeRedistPlanKey
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    RedistPlanKey key;
+    key.AGUID = A.Grid().GUID();
+    key.BGUID = B.Grid().GUID();
+    key.meta =
+      { Int(A.ColDist()), Int(A.RowDist()),
+        A.BlockHeight(), A.BlockWidth(), A.ColCut(), A.RowCut(),
+        A.ColAlign(), A.RowAlign(), A.Root(),
+        Int(B.ColDist()), Int(B.RowDist()),
+        B.BlockHeight(), B.BlockWidth(), B.ColCut(), B.RowCut(),
+        B.ColAlign(), B.RowAlign(), B.Root(),
+        A.Height(), A.Width() };
+    return key;
+}
+
+template<typename S,typename T>
+void BuildRedistPlan
+( const AbstractDistMatrix<S>& A,
+  const AbstractDistMatrix<T>& B,
+  mpi::Comm comm, bool includeViewers, RedistPlan& plan )
+{
+    DEBUG_CSE
+    const Grid& gA = A.Grid();
+    const Grid& gB = B.Grid();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const int AColStride = A.ColStride();
+    const int ARowStride = A.RowStride();
+    const int BColStride = B.ColStride();
+    const int BRowStride = B.RowStride();
+
+    plan.destRows.assign( commSize, -1 );
+    plan.destCols.assign( commSize, -1 );
+    for( int q=0; q<BColStride*BRowStride; ++q )
+    {
+        const int vcOwner =
+          gB.CoordsToVC( B.ColDist(), B.RowDist(), q, B.Root() );
+        const int owner =
+          ( includeViewers ? gB.VCToViewing(vcOwner) : vcOwner );
+        plan.destRows[owner] = q % BColStride;
+        plan.destCols[owner] = q / BColStride;
+    }
+    plan.srcRows.assign( commSize, -1 );
+    plan.srcCols.assign( commSize, -1 );
+    for( int q=0; q<AColStride*ARowStride; ++q )
+    {
+        const int vcOwner =
+          gA.CoordsToVC( A.ColDist(), A.RowDist(), q, A.Root() );
+        const int owner =
+          ( includeViewers ?
+            mpi::Translate( gA.ViewingComm(), gA.VCToViewing(vcOwner), comm ) :
+            vcOwner );
+        plan.srcRows[owner] = q % AColStride;
+        plan.srcCols[owner] = q / AColStride;
+    }
+
+    plan.sending = ( A.Participating() && A.RedundantRank() == 0 );
+    plan.receiving = ( B.Participating() && B.RedundantRank() == 0 );
+    if( plan.sending )
+    {
+        plan.sendRows.assign( BColStride, vector<Int>() );
+        plan.sendCols.assign( BRowStride, vector<Int>() );
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            plan.sendRows[B.RowOwner(A.GlobalRow(iLoc))].push_back( iLoc );
+        for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+            plan.sendCols[B.ColOwner(A.GlobalCol(jLoc))].push_back( jLoc );
+    }
+    if( plan.receiving )
+    {
+        plan.recvRows.assign( AColStride, vector<Int>() );
+        plan.recvCols.assign( ARowStride, vector<Int>() );
+        for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+            plan.recvRows[A.RowOwner(B.GlobalRow(iLoc))].push_back( iLoc );
+        for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+            plan.recvCols[A.ColOwner(B.GlobalCol(jLoc))].push_back( jLoc );
+    }
+
+    plan.sendCounts.assign( commSize, 0 );
+    plan.recvCounts.assign( commSize, 0 );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        if( plan.sending && plan.destRows[q] >= 0 )
+            plan.sendCounts[q] =
+              int(plan.sendRows[plan.destRows[q]].size()*
+                  plan.sendCols[plan.destCols[q]].size());
+        if( plan.receiving && plan.srcRows[q] >= 0 )
+            plan.recvCounts[q] =
+              int(plan.recvRows[plan.srcRows[q]].size()*
+                  plan.recvCols[plan.srcCols[q]].size());
+    }
+    plan.totalSend = Scan( plan.sendCounts, plan.sendOffs );
+    plan.totalRecv = Scan( plan.recvCounts, plan.recvOffs );
+}
+
 template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
 void Helper
 ( const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B ) 
 {
     DEBUG_CSE
-
-    // TODO: Decide whether S or T should be used as the transmission type
-    //       based upon which is smaller. Transmit S by default.
-    const Int height = A.Height();
-    const Int width = A.Width();
     const Grid& g = B.Grid();
-    const Dist colDist=B.ColDist(), rowDist=B.RowDist();
-    const int root = B.Root();
-    B.Resize( height, width );
-    const bool BPartic = B.Participating();
-
+    B.Resize( A.Height(), A.Width() );
     const bool includeViewers = (A.Grid() != B.Grid());
+    if( !includeViewers && !g.InGrid() )
+        return;
+    mpi::Comm comm = ( includeViewers ? g.ViewingComm() : g.VCComm() );
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
 
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
-    auto& ALoc = A.LockedMatrix();
-    auto& BLoc = B.Matrix();
-
-    // TODO: Break into smaller pieces to avoid excessive memory usage?
-    vector<Entry<S>> remoteEntries;
-    vector<int> distOwners;
-    if( A.RedundantRank() == 0 )
+    const auto key = MakeRedistPlanKey( A, B );
+    RedistPlan* planPtr = FindRedistPlan( key );
+    if( planPtr == nullptr )
     {
-        const bool noRedundant = B.RedundantSize() == 1;
-        const int colStride = B.ColStride();
-        const int rowRank = B.RowRank();
-        const int colRank = B.ColRank();
-
-        vector<Int> globalRows(localHeight), localRows(localHeight);
-        vector<int> ownerRows(localHeight);
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Int i = A.GlobalRow(iLoc);
-            const int ownerRow = B.RowOwner(i);
-            globalRows[iLoc] = i;
-            ownerRows[iLoc] = ownerRow;
-            localRows[iLoc] = B.LocalRow(i,ownerRow);
-        }
-
-        remoteEntries.reserve( localHeight*localWidth );
-        distOwners.reserve( localHeight*localWidth );
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const int ownerCol = B.ColOwner(j);
-            const Int localCol = B.LocalCol(j,ownerCol);
-            const bool isLocalCol = ( BPartic && ownerCol == rowRank );
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc ) 
-            {
-                const int ownerRow = ownerRows[iLoc];
-                const Int localRow = localRows[iLoc];
-                const bool isLocalRow = ( BPartic && ownerRow == colRank );
-                const S& alpha = ALoc(iLoc,jLoc);
-                if( noRedundant && isLocalRow && isLocalCol )
-                {
-                    BLoc(localRow,localCol) = Caster<S,T>::Cast(alpha);
-                }
-                else
-                {
-                    remoteEntries.push_back
-                    ( Entry<S>{localRow,localCol,alpha} );
-                    distOwners.push_back( ownerRow + colStride*ownerCol );
-                }
-            }
-        }    
+        planPtr = &NewRedistPlan( key );
+        BuildRedistPlan( A, B, comm, includeViewers, *planPtr );
     }
+    const RedistPlan& plan = *planPtr;
 
-    // Compute the metadata
-    // ====================
-    const Int totalSend = remoteEntries.size();
-    mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
-    if( includeViewers )
-    {
-        comm = g.ViewingComm();
-        const int commSize = mpi::Size( comm );
+    auto& ALoc = A.LockedMatrix();
+    auto& BLoc = B.Matrix();
 
-        vector<int> distMap(commSize);
+    // Pack the data
+    // =============
+    // TODO: Decide whether S or T should be used as the transmission type
+    //       based upon which is smaller. Transmit S by default.
+    vector<S> sendBuf;
+    FastResize( sendBuf, plan.totalSend );
+    if( plan.sending )
+    {
         for( int q=0; q<commSize; ++q )
         {
-            const int vcOwner = g.CoordsToVC(colDist,rowDist,q,root);
-            distMap[q] = g.VCToViewing(vcOwner);
+            if( plan.sendCounts[q] == 0 )
+                continue;
+            const auto& rows = plan.sendRows[plan.destRows[q]];
+            const auto& cols = plan.sendCols[plan.destCols[q]];
+            S* buf = &sendBuf[plan.sendOffs[q]];
+            for( const Int jLoc : cols )
+                for( const Int iLoc : rows )
+                    *buf++ = ALoc(iLoc,jLoc);
         }
-
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
+        if( plan.receiving && plan.destRows[commRank] >= 0 &&
+            plan.srcRows[commRank] >= 0 )
         {
-            owners[k] = distMap[distOwners[k]];
-            ++sendCounts[owners[k]];
+            const auto& sendRows = plan.sendRows[plan.destRows[commRank]];
+            const auto& sendCols = plan.sendCols[plan.destCols[commRank]];
+            const auto& recvRows = plan.recvRows[plan.srcRows[commRank]];
+            const auto& recvCols = plan.recvCols[plan.srcCols[commRank]];
+            const Int numRows = sendRows.size();
+            const Int numCols = sendCols.size();
+            for( Int jj=0; jj<numCols; ++jj )
+                for( Int ii=0; ii<numRows; ++ii )
+                    BLoc(recvRows[ii],recvCols[jj]) =
+                      Caster<S,T>::Cast(ALoc(sendRows[ii],sendCols[jj]));
         }
     }
-    else
-    {
-        if( !g.InGrid() )
-            return;
-        comm = g.VCComm();
-        const int commSize = mpi::Size( comm );
 
-        vector<int> distMap(commSize);
+    // Exchange and unpack the data
+    // ============================
+    vector<S> recvBuf;
+    FastResize( recvBuf, plan.totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), plan.sendCounts.data(), plan.sendOffs.data(),
+      recvBuf.data(), plan.recvCounts.data(), plan.recvOffs.data(), comm );
+    SwapClear( sendBuf );
+    if( plan.receiving )
+    {
         for( int q=0; q<commSize; ++q )
-            distMap[q] = g.CoordsToVC(colDist,rowDist,q,root);
-
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
         {
-            owners[k] = distMap[distOwners[k]];
-            ++sendCounts[owners[k]];
+            if( plan.recvCounts[q] == 0 )
+                continue;
+            const auto& rows = plan.recvRows[plan.srcRows[q]];
+            const auto& cols = plan.recvCols[plan.srcCols[q]];
+            const S* buf = &recvBuf[plan.recvOffs[q]];
+            for( const Int jLoc : cols )
+                for( const Int iLoc : rows )
+                    BLoc(iLoc,jLoc) = Caster<S,T>::Cast(*buf++);
         }
     }
-    SwapClear( distOwners );
-
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan( sendCounts, sendOffs );
-    vector<Entry<S>> sendBuf;
-    FastResize( sendBuf, totalSend );
-    auto offs = sendOffs;
-    for( Int k=0; k<totalSend; ++k )
-        sendBuf[offs[owners[k]]++] = remoteEntries[k];
-    SwapClear( remoteEntries );
-    SwapClear( owners );
+    SwapClear( recvBuf );
 
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
-    if( B.Participating() )
+    // Replicate over the redundant members of B
+    if( B.Participating() && B.RedundantSize() > 1 )
     {
-        Int recvBufSize = recvBuf.size();
-        mpi::Broadcast( recvBufSize, 0, B.RedundantComm() );
-        FastResize( recvBuf, recvBufSize );
-        mpi::Broadcast( recvBuf.data(), recvBufSize, 0, B.RedundantComm() );
-        for( Int k=0; k<recvBufSize; ++k )
-        {
-            const auto& entry = recvBuf[k];
-            BLoc(entry.i,entry.j) = Caster<S,T>::Cast(entry.value);
-        }
+        const Int localHeight = B.LocalHeight();
+        const Int localWidth = B.LocalWidth();
+        vector<T> buf;
+        FastResize( buf, localHeight*localWidth );
+        const bool root = ( B.RedundantRank() == 0 );
+        if( root )
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    buf[iLoc+jLoc*localHeight] = BLoc(iLoc,jLoc);
+        mpi::Broadcast( buf.data(), int(buf.size()), 0, B.RedundantComm() );
+        if( !root )
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    BLoc(iLoc,jLoc) = buf[iLoc+jLoc*localHeight];
     }
 }
 
@@ -26,11 +26,31 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_SUMMA_25D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// The number of layers, c, used by GEMM_SUMMA_25D, which must divide the
+// number of processes. The default of zero selects the largest such c with
+// c^3 <= p, which gives the 3D algorithm when p is a perfect cube.
+void SetGemmDepth( Int depth );
+Int GemmDepth();
+
+namespace gemm {
+
+// Free the layer grids (and communicators) which GEMM_SUMMA_25D caches for
+// each (grid,depth) pair. This is collective over every process which has
+// called GEMM_SUMMA_25D and is performed automatically by Finalize.
+void ClearSUMMA25DCache();
+
+} // namespace gemm
+
+// The blocksize used by the GEMM_SUMMA_DOT variants (by default, 2000)
+void SetGemmDotBlocksize( Int blocksize );
+Int GemmDotBlocksize();
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -53,6 +73,14 @@ void Gemm
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
+// Time each of the applicable algorithms for the given problem on random
+// matrices, record the fastest in the tuning table (which GEMM_DEFAULT
+// consults before falling back to its heuristics), and return it
+template<typename T>
+GemmAlgorithm TuneGemm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& g, Int numReps=1 );
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -17,6 +17,7 @@
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
@@ -205,6 +206,8 @@ template<typename T> struct IsStdScalar<Complex<T>>
 #include <El/core/environment/decl.hpp>
 
 #include <El/core/Timer.hpp>
+#include <El/core/Profiling.hpp>
+#include <El/core/Tuning.hpp>
 #include <El/core/indexing/decl.hpp>
 #include <El/core/imports/blas.hpp>
 #include <El/core/imports/lapack.hpp>
@@ -24,6 +24,13 @@ struct DistGraphMultMeta
                 recvSizes, recvOffs;
     vector<Int> sendInds, colOffs;
 
+    // A persistent halo-exchange plan for split-phase multiplication: the
+    // (remote) processes which we exchange a nonzero number of indices with,
+    // as well as a splitting of the local rows into those whose columns are
+    // all locally owned and those which require ghost entries
+    vector<int> sendRanks, recvRanks;
+    vector<Int> localRows, ghostRows;
+
     DistGraphMultMeta() : ready(false), numRecvInds(0) { }
 
     void Clear()
@@ -36,6 +43,10 @@ struct DistGraphMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        SwapClear( sendRanks );
+        SwapClear( recvRanks );
+        SwapClear( localRows );
+        SwapClear( ghostRows );
     }
 
     const DistGraphMultMeta& operator=( const DistGraphMultMeta& meta )
@@ -48,6 +59,10 @@ struct DistGraphMultMeta
         recvOffs = meta.recvOffs;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        sendRanks = meta.sendRanks;
+        recvRanks = meta.recvRanks;
+        localRows = meta.localRows;
+        ghostRows = meta.ghostRows;
         return *this;
     }
 };
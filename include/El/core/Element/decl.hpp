@@ -159,6 +159,26 @@ template<typename Real> struct PromoteHelper<Complex<Real>>
 
 template<typename F> using Promote = typename PromoteHelper<F>::type;
 
+// Decrease the precision to that of a native floating-point type (if possible)
+// ----------------------------------------------------------------------------
+template<typename F> struct DemoteHelper { typedef F type; };
+template<> struct DemoteHelper<double> { typedef float type; };
+#ifdef EL_HAVE_QD
+template<> struct DemoteHelper<DoubleDouble> { typedef double type; };
+template<> struct DemoteHelper<QuadDouble> { typedef double type; };
+#endif
+#ifdef EL_HAVE_QUAD
+template<> struct DemoteHelper<Quad> { typedef double type; };
+#endif
+#ifdef EL_HAVE_MPC
+template<> struct DemoteHelper<BigFloat> { typedef double type; };
+#endif
+
+template<typename Real> struct DemoteHelper<Complex<Real>>
+{ typedef Complex<typename DemoteHelper<Real>::type> type; };
+
+template<typename F> using Demote = typename DemoteHelper<F>::type;
+
 template<typename S,typename T>
 struct CanCast
 {   
@@ -59,6 +59,9 @@ public:
     // Change the size of the graph
     // ----------------------------
     void Empty( bool clearMemory=true );
+    // Resizing to the current dimensions keeps the edges (and hence any
+    // frozen sparsity); otherwise the edges are dropped and the sparsity is
+    // unfrozen. Neither changes the storage mode.
     void Resize( Int numVertices );
     void Resize( Int numSources, Int numTargets );
 
@@ -74,18 +77,36 @@ public:
     void UnfreezeSparsity() EL_NO_EXCEPT;
     bool FrozenSparsity() const EL_NO_EXCEPT;
 
+    // Compressed storage drops the per-edge sources, which are recovered from
+    // the source offsets. The sources are only held while edges are queued,
+    // and manual construction need only fill the targets and offsets. The
+    // mode persists until UncompressStorage (or Empty) is called.
+    void CompressStorage();
+    void UncompressStorage();
+    bool CompressedStorage() const EL_NO_EXCEPT;
+
     // For appending/removing many edges and then forcing consistency at the end
     void QueueConnection( Int source, Int target ) EL_NO_RELEASE_EXCEPT;
     void QueueDisconnection( Int source, Int target );
     void ProcessQueues();
 
+    // Overwrite the graph with a compressed sparse row structure whose
+    // targets are sorted (and unique) for each source, without sorting
+    void SetCSR
+    ( Int numSources, Int numTargets,
+      const vector<Int>& sourceOffsets, const vector<Int>& targets );
+
     // For manually modifying/accessing the buffers
+    //
+    // With compressed storage, SourceBuffer uncompresses the storage (and may
+    // therefore allocate), while LockedSourceBuffer throws, as the sources are
+    // not stored; const readers should instead walk the source offsets.
     void ForceNumEdges( Int numEdges );
     void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
-    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* SourceBuffer();
     Int* TargetBuffer() EL_NO_EXCEPT;
     Int* OffsetBuffer() EL_NO_EXCEPT;
-    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const;
     const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
     const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
     void ComputeSourceOffsets();
@@ -111,13 +132,23 @@ public:
 private:
     Int numSources_, numTargets_;
     bool frozenSparsity_ = false;
-    vector<Int> sources_, targets_;
-    set<pair<Int,Int>> markedForRemoval_;
+    bool compressed_ = false;
+    // With compressed storage, the sources are only held while edges are
+    // queued
+    vector<Int> sources_;
+    vector<Int> targets_;
+    vector<pair<Int,Int>> markedForRemoval_;
 
     // Helpers for local indexing
     bool consistent_=true;
     vector<Int> sourceOffsets_;
 
+    // Return the (sorted) order of the queued edges which were not marked for
+    // removal, along with the offsets into it of each run of duplicates
+    void SortQueues( vector<Int>& order, vector<Int>& uniqueOffsets );
+
+    void ExpandSources();
+
     friend class DistGraph;
     template<typename F> friend class SparseMatrix;
 
@@ -84,6 +84,11 @@ public:
     EL_NO_RELEASE_EXCEPT;
     int VCToViewing( int VCRank ) const EL_NO_EXCEPT;
 
+    // An identifier which is unique to each grid constructed by this process
+    // (e.g., so that cached communication plans are never reused by a new
+    // grid occupying the memory of a destroyed one)
+    size_t GUID() const EL_NO_EXCEPT;
+
     static int FindFactor( int p ) EL_NO_EXCEPT;
 
     // To be used internally by Elemental
@@ -96,8 +101,10 @@ private:
     int height_, size_, gcd_;
     bool inGrid_;
     GridOrder order_;
+    size_t guid_;
 
     static Grid* defaultGrid;
+    static size_t numGrids;
 
     vector<int> diagsAndRanks_;
     vector<int> vcToViewing_;
@@ -11,6 +11,57 @@
 
 namespace El {
 
+namespace memory {
+
+// All buffers returned by Allocate are aligned to this many bytes
+const size_t ALIGNMENT = 64;
+
+// Buffers are rounded up to a size class (a quarter of a power of two) and,
+// when pooling is enabled, freed buffers are cached (up to PoolLimit() bytes)
+// so that subsequent requests for the same size class can reuse them. When
+// huge pages are enabled, buffers of at least HUGE_PAGE_SIZE bytes are
+// advised to be backed by transparent huge pages (where supported).
+const size_t HUGE_PAGE_SIZE = 2*1024*1024;
+
+void* Allocate( size_t numBytes );
+void Deallocate( void* ptr, size_t numBytes ) EL_NO_EXCEPT;
+
+void SetPooling( bool pooling );
+bool Pooling();
+void SetPoolLimit( size_t numBytes );
+size_t PoolLimit();
+void SetHugePages( bool hugePages );
+bool HugePages();
+
+// Return all cached buffers to the system
+void ReleasePool();
+
+// Replace the routines used to request memory from (and return memory to) the
+// system; the allocation routine must return ALIGNMENT-aligned buffers and
+// throw std::bad_alloc on failure. This must not be called while any buffers
+// produced by the previous allocator are still live.
+typedef void* (*AllocateFunction)( size_t numBytes );
+typedef void (*DeallocateFunction)( void* ptr, size_t numBytes );
+void SetSystemAllocator
+( AllocateFunction allocate, DeallocateFunction deallocate );
+void ResetSystemAllocator();
+
+struct Statistics
+{
+    size_t liveBytes=0;      // currently held by Memory objects
+    size_t peakBytes=0;      // high-water mark of liveBytes
+    size_t pooledBytes=0;    // currently cached in the pool
+    size_t systemBytes=0;    // cumulative bytes requested from the system
+    size_t reusedBytes=0;    // cumulative bytes served from the pool
+    size_t numAllocations=0; // cumulative calls to Allocate
+    size_t numReuses=0;      // cumulative calls served from the pool
+};
+
+Statistics GetStatistics();
+void ResetStatistics();
+
+} // namespace memory
+
 template<typename G>
 class Memory
 {
@@ -14,13 +14,33 @@ namespace {
 template<typename G>
 static G* New( size_t size )
 {
-    return new G[size];
+    G* ptr = static_cast<G*>(memory::Allocate( size*sizeof(G) ));
+    size_t i=0;
+    try
+    {
+        for( ; i<size; ++i )
+            new (ptr+i) G;
+    }
+    catch( ... )
+    {
+        // Destroy the constructed prefix and return the block before rethrowing
+        while( i > 0 )
+            ptr[--i].~G();
+        memory::Deallocate( ptr, size*sizeof(G) );
+        throw;
+    }
+    return ptr;
 }
 
 template<typename G>
-static void Delete( G*& ptr )
+static void Delete( G*& ptr, size_t size )
 {
-    delete[] ptr;
+    if( ptr != nullptr )
+    {
+        for( size_t i=0; i<size; ++i )
+            ptr[i].~G();
+        memory::Deallocate( ptr, size*sizeof(G) );
+    }
     ptr = nullptr;
 }
 
@@ -56,7 +76,7 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
 }
 
 template<typename G>
@@ -70,13 +90,14 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Delete( rawBuffer_, size_ );
+        buffer_ = nullptr;
+        size_ = 0;
 
 #ifndef EL_RELEASE
         try {
 #endif
 
-            // TODO: Optionally overallocate to force alignment of buffer_
             rawBuffer_ = New<G>( size );
             buffer_ = rawBuffer_;
 
@@ -110,7 +131,7 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
     buffer_ = nullptr;
     size_ = 0;
 }
@@ -0,0 +1,68 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PROFILING_HPP
+#define EL_PROFILING_HPP
+
+namespace El {
+
+// A hierarchical region profiler: each region accumulates its number of calls,
+// wall-clock time, flops, and bytes communicated, with nesting following the
+// order in which regions are entered (as with the call stack). Only the main
+// thread records regions.
+
+namespace profiling {
+// Read by ProfileRegion on every construction, and so exposed for inlining
+extern bool enabled;
+}
+
+// If 'trace' is true, the start and end of every region are also recorded
+// (up to the specified number of events) for WriteProfileTrace
+void EnableProfiling( bool trace=false, Int maxTraceEvents=1000000 );
+void DisableProfiling();
+inline bool Profiling() EL_NO_EXCEPT { return profiling::enabled; }
+
+// Discard all of the recorded regions
+void ResetProfile();
+
+void PushProfileRegion( const char* name );
+void PopProfileRegion();
+
+// Attribute work to the currently open region (if profiling)
+void AddProfileFlops( double flops );
+void AddProfileBytes( double bytes );
+
+// The name of the innermost open region (empty if there is none)
+const string& CurrentProfileRegion();
+
+class ProfileRegion
+{
+public:
+    ProfileRegion( const char* name )
+    : active_(Profiling())
+    { if( active_ ) PushProfileRegion( name ); }
+
+    ~ProfileRegion()
+    { if( active_ ) PopProfileRegion(); }
+
+private:
+    bool active_;
+};
+
+// Write the region tree (as seen by the root process), with the minimum,
+// maximum, and average of each statistic over the processes in 'comm', to a
+// JSON file. Regions which were not entered by the root are not reported.
+void WriteProfileJSON( const string filename, mpi::Comm comm=mpi::COMM_WORLD );
+
+// Write the recorded events of this process in the Chrome trace-event format
+// (viewable with chrome://tracing) to "<basename>-<rank>.json"
+void WriteProfileTrace( const string basename );
+
+} // namespace El
+
+#endif // ifndef EL_PROFILING_HPP
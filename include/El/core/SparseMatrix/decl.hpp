@@ -46,6 +46,12 @@ public:
     void UnfreezeSparsity() EL_NO_EXCEPT;
     bool FrozenSparsity() const EL_NO_EXCEPT;
 
+    // Drop the per-entry row indices, which are then recovered from the row
+    // offsets (see Graph::CompressStorage)
+    void CompressStorage();
+    void UncompressStorage();
+    bool CompressedStorage() const EL_NO_EXCEPT;
+
     // Expensive independent updates and explicit zeroing
     // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
     void Update( const Entry<T>& entry );
@@ -59,6 +65,14 @@ public:
     void QueueZero( Int row, Int col ) EL_NO_RELEASE_EXCEPT;
     void ProcessQueues();
 
+    // Overwrite the matrix with compressed sparse row data whose column
+    // indices are sorted (and unique) within each row, without sorting
+    void SetCSR
+    ( Int height, Int width,
+      const vector<Int>& rowOffsets,
+      const vector<Int>& colIndices,
+      const vector<T>& values );
+
     // Operator overloading
     // ====================
 
@@ -93,11 +107,12 @@ public:
     // For manually modifying data
     void ForceNumEntries( Int numEntries );
     void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
-    Int* SourceBuffer() EL_NO_EXCEPT;
+    // (see Graph for the behavior of the source buffers under compression)
+    Int* SourceBuffer();
     Int* TargetBuffer() EL_NO_EXCEPT;
     Int* OffsetBuffer() EL_NO_EXCEPT;
     T* ValueBuffer() EL_NO_EXCEPT;
-    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const;
     const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
     const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
     const T* LockedValueBuffer() const EL_NO_EXCEPT;
@@ -132,12 +147,6 @@ private:
     El::Graph graph_;
     vector<T> vals_;
 
-    struct CompareEntriesFunctor
-    {
-        bool operator()(const Entry<T>& a, const Entry<T>& b ) 
-        { return a.i < b.i || (a.i == b.i && a.j < b.j); }
-    };
-
     template<typename U> friend class DistSparseMatrix;
     template<typename U> 
     friend void CopyFromRoot
@@ -92,6 +92,20 @@ template<typename T>
 bool SparseMatrix<T>::FrozenSparsity() const EL_NO_EXCEPT
 { return graph_.frozenSparsity_; }
 
+template<typename T>
+void SparseMatrix<T>::CompressStorage()
+{
+    DEBUG_CSE
+    ProcessQueues();
+    graph_.CompressStorage();
+}
+template<typename T>
+void SparseMatrix<T>::UncompressStorage()
+{ graph_.UncompressStorage(); }
+template<typename T>
+bool SparseMatrix<T>::CompressedStorage() const EL_NO_EXCEPT
+{ return graph_.compressed_; }
+
 template<typename T>
 void SparseMatrix<T>::Update( Int row, Int col, T value )
 {
@@ -364,7 +378,7 @@ void SparseMatrix<T>::Set( Int row, Int col, T val) EL_NO_RELEASE_EXCEPT
 }
 
 template<typename T>
-Int* SparseMatrix<T>::SourceBuffer() EL_NO_EXCEPT
+Int* SparseMatrix<T>::SourceBuffer()
 { return graph_.SourceBuffer(); }
 template<typename T>
 Int* SparseMatrix<T>::TargetBuffer() EL_NO_EXCEPT
@@ -377,7 +391,7 @@ T* SparseMatrix<T>::ValueBuffer() EL_NO_EXCEPT
 { return vals_.data(); }
 
 template<typename T>
-const Int* SparseMatrix<T>::LockedSourceBuffer() const EL_NO_EXCEPT
+const Int* SparseMatrix<T>::LockedSourceBuffer() const
 { return graph_.LockedSourceBuffer(); }
 template<typename T>
 const Int* SparseMatrix<T>::LockedTargetBuffer() const EL_NO_EXCEPT
@@ -397,6 +411,20 @@ void SparseMatrix<T>::ForceNumEntries( Int numEntries )
     vals_.resize( numEntries );
 }
 
+template<typename T>
+void SparseMatrix<T>::SetCSR
+( Int height, Int width,
+  const vector<Int>& rowOffsets,
+  const vector<Int>& colIndices,
+  const vector<T>& values )
+{
+    DEBUG_CSE
+    if( values.size() != colIndices.size() )
+        LogicError("Expected as many values as column indices");
+    graph_.SetCSR( height, width, rowOffsets, colIndices );
+    vals_ = values;
+}
+
 template<typename T>
 void SparseMatrix<T>::ForceConsistency( bool consistent ) EL_NO_EXCEPT
 { graph_.ForceConsistency( consistent ); }
@@ -409,70 +437,41 @@ void SparseMatrix<T>::ProcessQueues()
 {
     DEBUG_CSE
     DEBUG_ONLY(
-      if( graph_.sources_.size() != graph_.targets_.size() || 
+      if( (!graph_.compressed_ &&
+           graph_.sources_.size() != graph_.targets_.size()) ||
           graph_.targets_.size() != vals_.size() )
           LogicError("Inconsistent sparse matrix buffer sizes");
     )
     if( graph_.consistent_ )
         return;
+    if( graph_.compressed_ )
+        graph_.ExpandSources();
 
-    Int numRemoved = 0;
-    const Int numEntries = vals_.size();
-    vector<Entry<T>> entries( numEntries );
-    if( graph_.markedForRemoval_.size() != 0 )
-    {
-        for( Int s=0; s<numEntries; ++s )
-        {
-            pair<Int,Int> candidate(graph_.sources_[s],graph_.targets_[s]);
-            if( graph_.markedForRemoval_.find(candidate) == 
-                graph_.markedForRemoval_.end() )
-            {
-                entries[s-numRemoved].i = graph_.sources_[s];
-                entries[s-numRemoved].j = graph_.targets_[s];
-                entries[s-numRemoved].value = vals_[s];
-            }
-            else
-            {
-                ++numRemoved;
-            }
-        }
-        graph_.markedForRemoval_.clear();
-        entries.resize( numEntries-numRemoved );
-    }
-    else
-    {
-        for( Int s=0; s<numEntries; ++s )
-            entries[s] = 
-              Entry<T>{graph_.sources_[s],graph_.targets_[s],vals_[s]};
-    }
-    CompareEntriesFunctor comparer;
-    std::sort( entries.begin(), entries.end(), comparer );
-    const Int numSorted = entries.size();
-
-    // Compress out duplicates
-    Int lastUnique=0;
-    for( Int s=1; s<numSorted; ++s )
-    {
-        if( entries[s].i != entries[lastUnique].i ||
-            entries[s].j != entries[lastUnique].j )
-            entries[++lastUnique] = entries[s];
-        else
-            entries[lastUnique].value += entries[s].value;
-    }
-    const Int numUnique = lastUnique+1;
-    entries.resize( numUnique );
+    vector<Int> order, uniqueOffsets;
+    graph_.SortQueues( order, uniqueOffsets );
+    const Int numUnique = uniqueOffsets.size()-1;
 
-    graph_.sources_.resize( numUnique );
-    graph_.targets_.resize( numUnique );
-    vals_.resize( numUnique );
+    // Sum the values of each run of duplicates
+    vector<Int> newSources( numUnique ), newTargets( numUnique );
+    vector<T> newVals( numUnique );
+    EL_PARALLEL_FOR
     for( Int s=0; s<numUnique; ++s )
     {
-        graph_.sources_[s] = entries[s].i;
-        graph_.targets_[s] = entries[s].j;
-        vals_[s] = entries[s].value;
+        const Int sOld = order[uniqueOffsets[s]];
+        newSources[s] = graph_.sources_[sOld];
+        newTargets[s] = graph_.targets_[sOld];
+        T value = vals_[sOld];
+        for( Int k=uniqueOffsets[s]+1; k<uniqueOffsets[s+1]; ++k )
+            value += vals_[order[k]];
+        newVals[s] = value;
     }
+    graph_.sources_.swap( newSources );
+    graph_.targets_.swap( newTargets );
+    vals_.swap( newVals );
 
     graph_.ComputeSourceOffsets();
+    if( graph_.compressed_ )
+        SwapClear( graph_.sources_ );
     graph_.consistent_ = true;
 }
 
@@ -0,0 +1,61 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TUNING_HPP
+#define EL_TUNING_HPP
+
+namespace El {
+
+class Grid;
+
+// A table of tuned parameters (e.g., an algorithm or a blocksize) for each
+// routine, scalar type, process grid shape, and size bucket, where the bucket
+// of each problem dimension is the floor of its base-two logarithm. Lookups
+// fall back to the entry with the nearest buckets for the same routine, type,
+// grid shape, and parameter, so long as the buckets differ by at most two in
+// total (e.g., a factor of four in one dimension). Callers must check that a
+// tuned choice applies to their particular problem.
+//
+// Every process of a grid must make the same choices, so the tables should be
+// identical on each process: LoadTuning broadcasts the file from the root and
+// the tuning routines use the maximum time over the grid.
+
+void SetTuningParameter
+( const string& routine, const string& type, const Grid& g,
+  const vector<Int>& dims, const string& param, Int value );
+
+// Returns false if there is no entry for the routine, type, grid shape, and
+// parameter with nearby buckets
+bool TuningParameter
+( const string& routine, const string& type, const Grid& g,
+  const vector<Int>& dims, const string& param, Int& value );
+
+void ClearTuning();
+
+// Entries are stored one per line as
+//   routine type gridHeight gridWidth numDims bucket_0 ... param value
+// and loading merges a file into the current table
+void LoadTuning( const string filename, mpi::Comm comm=mpi::COMM_WORLD );
+void SaveTuning( const string filename, mpi::Comm comm=mpi::COMM_WORLD );
+
+// The tuned blocksize of a routine for an n x n problem, or Blocksize()
+template<typename T>
+Int TunedBlocksize( const string& routine, const Grid& g, Int n );
+
+// The maximum time over the grid of the fastest of 'numReps' runs
+double TuningTime( const Grid& g, function<void()> run, Int numReps=1 );
+
+// Time a routine (for an n x n problem) with each candidate blocksize, which
+// is made available to it through TunedBlocksize, and record the fastest
+Int TuneBlocksize
+( const string& routine, const string& type, const Grid& g, Int n,
+  const vector<Int>& candidates, function<void()> run, Int numReps=1 );
+
+} // namespace El
+
+#endif // ifndef EL_TUNING_HPP
@@ -389,7 +389,14 @@ Int Find( const vector<Int>& sortedInds, Int index );
  LogicError(EL_FUNCTION," in ",__FILE__,"@",__LINE__,": ",__VA_ARGS__);
 #define RUNTIME_ERROR(...) \
  RuntimeError(EL_FUNCTION," in ",__FILE__,"@",__LINE__,": ",__VA_ARGS__);
-#define DEBUG_CSE DEBUG_ONLY(CSE cse(EL_FUNCTION))
+// When configured with EL_PROFILE, every DEBUG_CSE scope (even in release
+// builds) is also a profiling region
+#ifdef EL_PROFILE
+# define EL_PROFILE_CSE El::ProfileRegion profileRegion(EL_FUNCTION);
+#else
+# define EL_PROFILE_CSE
+#endif
+#define DEBUG_CSE DEBUG_ONLY(CSE cse(EL_FUNCTION)) EL_PROFILE_CSE
 
 } // namespace El
 
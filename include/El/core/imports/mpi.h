@@ -34,6 +34,20 @@ EL_EXPORT ElError ElMPIWorldSize( int* size );
 
 EL_EXPORT ElError ElMPITime( double* time );
 
+/* Communication statistics (see El::mpi::EnableCommStats).
+   ElMPINumCommStats takes a snapshot of the statistics of this process, whose
+   entries are then returned by ElMPICommStat; the strings remain valid until
+   the next snapshot. */
+EL_EXPORT ElError ElMPIEnableCommStats( const char* filename );
+EL_EXPORT ElError ElMPIDisableCommStats();
+EL_EXPORT ElError ElMPICommStatsEnabled( bool* enabled );
+EL_EXPORT ElError ElMPIResetCommStats();
+EL_EXPORT ElError ElMPINumCommStats( ElInt* numStats );
+EL_EXPORT ElError ElMPICommStat
+( ElInt index, const char** op, const char** comm, const char** site,
+  ElInt* numCalls, double* bytes, double* time );
+EL_EXPORT ElError ElMPIWriteCommStats( const char* filename, MPI_Comm comm );
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
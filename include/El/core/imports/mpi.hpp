@@ -13,6 +13,8 @@
 namespace El {
 
 using std::function;
+using std::ostream;
+using std::string;
 using std::vector;
 
 namespace mpi {
@@ -1084,6 +1086,52 @@ void CreateBigFloatFamily();
 void DestroyBigFloatFamily();
 #endif
 
+// Communication statistics
+// ========================
+// An opt-in record, kept by the above wrappers (rather than through the PMPI
+// profiling layer), of the number of calls, the bytes contributed by this
+// process, and the time spent within MPI for each combination of operation,
+// communicator, and call site (the innermost open profiling region). Only
+// the main thread records statistics.
+
+namespace comm_stats {
+// Read by every wrapper, and so exposed for inlining
+extern bool enabled;
+}
+
+struct CommStat
+{
+    string op;
+    // The communicator is described by its size, the COMM_WORLD rank of its
+    // root, and a hash of the sorted COMM_WORLD ranks of its members, e.g.,
+    // "4@2#9e3779b9", which is the same on every member
+    string comm;
+    string site;
+    Int numCalls;
+    double bytes;
+    double time;
+};
+
+// If 'filename' is nonempty, the report written at Finalize is sent there
+// rather than to the standard output of the root process
+void EnableCommStats( const string filename="" );
+void DisableCommStats();
+inline bool CommStatsEnabled() EL_NO_EXCEPT { return comm_stats::enabled; }
+void ResetCommStats();
+
+void RecordCommStat( const char* op, Comm comm, double bytes, double time );
+vector<CommStat> LocalCommStats();
+
+// Summarize the statistics of every process in 'comm' (the number of
+// participating processes, the total calls and bytes, the average and maximum
+// time, and the imbalance max/avg of the time) on its root. Both routines are
+// collective over 'comm'.
+void WriteCommStats( ostream& os, Comm comm=COMM_WORLD );
+void WriteCommStats( const string filename, Comm comm=COMM_WORLD );
+
+// Called by El::Finalize
+void FinalizeCommStats();
+
 // Convenience functions which might not be very useful
 int Comm::Rank() const EL_NO_RELEASE_EXCEPT { return mpi::Rank(*this); }
 int Comm::Size() const EL_NO_RELEASE_EXCEPT { return mpi::Size(*this); }
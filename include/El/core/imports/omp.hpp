@@ -39,4 +39,28 @@
 # define EL_OUTER_PARALLEL_FOR_COLLAPSE2 EL_PARALLEL_FOR_COLLAPSE2
 #endif
 
+namespace El {
+
+// The number of threads that a parallel region may use and the index of the
+// calling thread within its team (always 1 and 0 outside of hybrid mode)
+inline int MaxThreads()
+{
+#ifdef EL_HYBRID
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+inline int ThreadNum()
+{
+#ifdef EL_HYBRID
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+} // namespace El
+
 #endif // ifndef EL_IMPORTS_OMP_HPP
@@ -99,6 +99,59 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>> 
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based random number generation
+// --------------------------------------
+// Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3")
+// maps a 128-bit counter and a 64-bit key to four 32-bit words, so that each
+// entry of a matrix can be sampled as a function of its global indices,
+// independently of the order of generation, the number of threads, and the
+// shape of the process grid.
+typedef std::array<std::uint32_t,4> PhiloxBits;
+typedef std::array<std::uint32_t,2> PhiloxKey;
+
+PhiloxBits Philox4x32( PhiloxBits counter, PhiloxKey key );
+
+// The seed shared by all processes for counter-based generation. Setting it
+// also restarts the sequence of keys returned below.
+std::uint32_t CounterSeed();
+void SetCounterSeed( std::uint32_t seed );
+
+// Return the key for the next process-local fill (which differs between
+// processes) or for the next collective fill over the given communicator
+// (which is identical on all of its processes)
+PhiloxKey LocalCounterKey();
+PhiloxKey DistCounterKey( mpi::Comm comm );
+
+// Whether or not samples of the given type are drawn using counter-based
+// generation within matrix generators
+template<typename T>
+struct IsCounterSampled
+{
+    static const bool value = std::is_same<Base<T>,float>::value ||
+                              std::is_same<Base<T>,double>::value;
+};
+
+// Convert the bits of a counter-based sample into a sample from a uniform PDF
+// over a ball or from a normal PDF (cf. SampleBall and SampleNormal)
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+Real CounterSampleBall
+( const PhiloxBits& bits, const Real& center, const Real& radius );
+template<typename F,typename=EnableIf<IsComplex<F>>,typename=void>
+F CounterSampleBall
+( const PhiloxBits& bits, const F& center, const Base<F>& radius );
+template<typename F>
+F CounterSampleNormal
+( const PhiloxBits& bits, const F& mean, const Base<F>& stddev );
+
+// Set the local entry (iLoc,jLoc) of A to sample(bits), where the bits are
+// generated from the key and the global indices
+// (colShift+iLoc*colStride,rowShift+jLoc*rowStride)
+template<typename T,typename Sampler>
+void CounterFill
+( Matrix<T>& A, const PhiloxKey& key,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  const Sampler& sample );
+
 // To be used internally by Elemental
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
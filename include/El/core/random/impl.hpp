@@ -223,6 +223,112 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform(center-radius,center+radius); }
 
+inline PhiloxBits Philox4x32( PhiloxBits counter, PhiloxKey key )
+{
+    const std::uint32_t M0=0xD2511F53, M1=0xCD9E8D57;
+    const std::uint32_t W0=0x9E3779B9, W1=0xBB67AE85;
+    for( int round=0; round<10; ++round )
+    {
+        const std::uint64_t prod0 = std::uint64_t(M0)*counter[0];
+        const std::uint64_t prod1 = std::uint64_t(M1)*counter[2];
+        counter[0] = std::uint32_t(prod1>>32) ^ counter[1] ^ key[0];
+        counter[1] = std::uint32_t(prod1);
+        counter[2] = std::uint32_t(prod0>>32) ^ counter[3] ^ key[1];
+        counter[3] = std::uint32_t(prod0);
+        key[0] += W0;
+        key[1] += W1;
+    }
+    return counter;
+}
+
+namespace counter_rng {
+
+// Map one or two words onto [0,1) using the full precision of Real
+template<typename Real>
+inline Real Uniform01( std::uint32_t high, std::uint32_t low );
+
+template<>
+inline float Uniform01( std::uint32_t high, std::uint32_t low )
+{ return float(high>>8)*(1.f/16777216.f); }
+
+template<>
+inline double Uniform01( std::uint32_t high, std::uint32_t low )
+{
+    const std::uint64_t bits = (std::uint64_t(high)<<21) | (low>>11);
+    return double(bits)*(1./9007199254740992.);
+}
+
+} // namespace counter_rng
+
+template<typename Real,typename>
+Real CounterSampleBall
+( const PhiloxBits& bits, const Real& center, const Real& radius )
+{
+    const Real u = counter_rng::Uniform01<Real>( bits[0], bits[1] );
+    return center + radius*(2*u-1);
+}
+
+template<typename F,typename,typename>
+F CounterSampleBall
+( const PhiloxBits& bits, const F& center, const Base<F>& radius )
+{
+    typedef Base<F> Real;
+    const Real r = radius*counter_rng::Uniform01<Real>( bits[0], bits[1] );
+    const Real angle =
+      2*Pi<Real>()*counter_rng::Uniform01<Real>( bits[2], bits[3] );
+    return center + F(r*Cos(angle),r*Sin(angle));
+}
+
+template<typename F>
+F CounterSampleNormal
+( const PhiloxBits& bits, const F& mean, const Base<F>& stddev )
+{
+    typedef Base<F> Real;
+    // Box-Muller (with the radial uniform sample drawn from (0,1])
+    const Real u0 = 1 - counter_rng::Uniform01<Real>( bits[0], bits[1] );
+    const Real u1 = counter_rng::Uniform01<Real>( bits[2], bits[3] );
+    const Real radius = Sqrt(-2*Log(u0));
+    const Real angle = 2*Pi<Real>()*u1;
+    F sample;
+    if( IsComplex<F>::value )
+    {
+        const Real stddevAdj = stddev / Sqrt(Real(2));
+        SetRealPart( sample, RealPart(mean)+stddevAdj*radius*Cos(angle) );
+        SetImagPart( sample, ImagPart(mean)+stddevAdj*radius*Sin(angle) );
+    }
+    else
+        SetRealPart( sample, RealPart(mean)+stddev*radius*Cos(angle) );
+    return sample;
+}
+
+template<typename T,typename Sampler>
+void CounterFill
+( Matrix<T>& A, const PhiloxKey& key,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  const Sampler& sample )
+{
+    DEBUG_CSE
+    const Int localHeight = A.Height();
+    const Int localWidth = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const std::uint64_t j = rowShift + jLoc*rowStride;
+        PhiloxBits counter;
+        counter[2] = std::uint32_t(j);
+        counter[3] = std::uint32_t(j>>32);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const std::uint64_t i = colShift + iLoc*colStride;
+            counter[0] = std::uint32_t(i);
+            counter[1] = std::uint32_t(i>>32);
+            ABuf[iLoc+jLoc*ALDim] = sample( Philox4x32( counter, key ) );
+        }
+    }
+}
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
@@ -127,6 +127,38 @@ template<typename T>
 void Read
 ( DistSparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
 
+// MappedMatrix
+// ============
+// A read-only view of the payload of a BINARY or BINARY_FLAT file which, when
+// mmap is available, is memory-mapped rather than copied (so that several
+// processes on a node can share a single page-cache copy). The dimensions
+// must be specified for the BINARY_FLAT format.
+template<typename T>
+class MappedMatrix
+{
+public:
+    MappedMatrix() { }
+    MappedMatrix
+    ( const string filename, FileFormat format=AUTO,
+      Int height=0, Int width=0 );
+    ~MappedMatrix();
+
+    void MapRead
+    ( const string filename, FileFormat format=AUTO,
+      Int height=0, Int width=0 );
+    void Unmap();
+
+    const Matrix<T>& LockedMatrix() const EL_NO_EXCEPT { return A_; }
+
+private:
+    Matrix<T> A_;
+    void* map_=nullptr;
+    size_t mapSize_=0;
+
+    MappedMatrix( const MappedMatrix<T>& A );
+    const MappedMatrix<T>& operator=( const MappedMatrix<T>& A );
+};
+
 // Spy
 // ===
 template<typename T>
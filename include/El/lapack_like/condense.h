@@ -115,6 +115,8 @@ typedef struct {
   ElHermitianTridiagApproach approach;
   ElGridOrderType order;
   ElSymvCtrl symvCtrl;
+  bool twoStage;
+  ElInt bandwidth;
 } ElHermitianTridiagCtrl;
 EL_EXPORT ElError 
 ElHermitianTridiagCtrlDefault_s( ElHermitianTridiagCtrl* ctrl );
@@ -147,6 +149,19 @@ EL_EXPORT ElError ElHermitianTridiagDist_z
 
 /* Expert version
    ^^^^^^^^^^^^^^ */
+EL_EXPORT ElError ElHermitianTridiagX_s
+( ElUpperOrLower uplo, ElMatrix_s A, ElMatrix_s t,
+  ElHermitianTridiagCtrl ctrl );
+EL_EXPORT ElError ElHermitianTridiagX_d
+( ElUpperOrLower uplo, ElMatrix_d A, ElMatrix_d t,
+  ElHermitianTridiagCtrl ctrl );
+EL_EXPORT ElError ElHermitianTridiagX_c
+( ElUpperOrLower uplo, ElMatrix_c A, ElMatrix_c t,
+  ElHermitianTridiagCtrl ctrl );
+EL_EXPORT ElError ElHermitianTridiagX_z
+( ElUpperOrLower uplo, ElMatrix_z A, ElMatrix_z t,
+  ElHermitianTridiagCtrl ctrl );
+
 EL_EXPORT ElError ElHermitianTridiagXDist_s
 ( ElUpperOrLower uplo, ElDistMatrix_s A, ElDistMatrix_s t, 
   ElHermitianTridiagCtrl ctrl );
@@ -178,6 +193,15 @@ EL_EXPORT ElError ElHermitianTridiagOnlyDist_z
 
 /* Expert version
    ^^^^^^^^^^^^^^ */
+EL_EXPORT ElError ElHermitianTridiagOnlyX_s
+( ElUpperOrLower uplo, ElMatrix_s A, ElHermitianTridiagCtrl ctrl );
+EL_EXPORT ElError ElHermitianTridiagOnlyX_d
+( ElUpperOrLower uplo, ElMatrix_d A, ElHermitianTridiagCtrl ctrl );
+EL_EXPORT ElError ElHermitianTridiagOnlyX_c
+( ElUpperOrLower uplo, ElMatrix_c A, ElHermitianTridiagCtrl ctrl );
+EL_EXPORT ElError ElHermitianTridiagOnlyX_z
+( ElUpperOrLower uplo, ElMatrix_z A, ElHermitianTridiagCtrl ctrl );
+
 EL_EXPORT ElError ElHermitianTridiagOnlyXDist_s
 ( ElUpperOrLower uplo, ElDistMatrix_s A, ElHermitianTridiagCtrl ctrl );
 EL_EXPORT ElError ElHermitianTridiagOnlyXDist_d
@@ -215,6 +239,44 @@ EL_EXPORT ElError ElApplyQAfterHermitianTridiagDist_z
 ( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, 
   ElConstDistMatrix_z A, ElConstDistMatrix_z t, ElDistMatrix_z B );
 
+/* Expert version
+   ^^^^^^^^^^^^^^
+   The control structure must match the one used for the reduction, as the
+   two-stage reduction packs its reflectors differently */
+EL_EXPORT ElError ElApplyQAfterHermitianTridiagX_s
+( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, 
+  ElConstMatrix_s A, ElConstMatrix_s t, ElMatrix_s B,
+  ElHermitianTridiagCtrl ctrl );
+EL_EXPORT ElError ElApplyQAfterHermitianTridiagX_d
+( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, 
+  ElConstMatrix_d A, ElConstMatrix_d t, ElMatrix_d B,
+  ElHermitianTridiagCtrl ctrl );
+EL_EXPORT ElError ElApplyQAfterHermitianTridiagX_c
+( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, 
+  ElConstMatrix_c A, ElConstMatrix_c t, ElMatrix_c B,
+  ElHermitianTridiagCtrl ctrl );
+EL_EXPORT ElError ElApplyQAfterHermitianTridiagX_z
+( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, 
+  ElConstMatrix_z A, ElConstMatrix_z t, ElMatrix_z B,
+  ElHermitianTridiagCtrl ctrl );
+
+EL_EXPORT ElError ElApplyQAfterHermitianTridiagXDist_s
+( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, 
+  ElConstDistMatrix_s A, ElConstDistMatrix_s t, ElDistMatrix_s B,
+  ElHermitianTridiagCtrl ctrl );
+EL_EXPORT ElError ElApplyQAfterHermitianTridiagXDist_d
+( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, 
+  ElConstDistMatrix_d A, ElConstDistMatrix_d t, ElDistMatrix_d B,
+  ElHermitianTridiagCtrl ctrl );
+EL_EXPORT ElError ElApplyQAfterHermitianTridiagXDist_c
+( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, 
+  ElConstDistMatrix_c A, ElConstDistMatrix_c t, ElDistMatrix_c B,
+  ElHermitianTridiagCtrl ctrl );
+EL_EXPORT ElError ElApplyQAfterHermitianTridiagXDist_z
+( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, 
+  ElConstDistMatrix_z A, ElConstDistMatrix_z t, ElDistMatrix_z B,
+  ElHermitianTridiagCtrl ctrl );
+
 /* Hessenberg
    ========== */
 
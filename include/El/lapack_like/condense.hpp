@@ -86,6 +86,62 @@ void ApplyP
   const ElementalMatrix<F>& phase,
         ElementalMatrix<F>& B );
 
+// Two-stage reduction to bidiagonal form
+// --------------------------------------
+// A is first reduced to band form with the given bandwidth (with the default
+// of zero selecting the algorithmic blocksize) and then chased down to
+// bidiagonal form, with the reflectors of the second stage returned in the
+// square matrix 'chase' of order Min(m,n). The same bandwidth must be passed
+// to the corresponding ApplyQ and ApplyP.
+template<typename F>
+void TwoStage
+( Matrix<F>& A,
+  Matrix<F>& phaseP,
+  Matrix<F>& phaseQ,
+  Matrix<F>& chase,
+  Int bandwidth=0 );
+template<typename F>
+void TwoStage
+( ElementalMatrix<F>& A,
+  ElementalMatrix<F>& phaseP,
+  ElementalMatrix<F>& phaseQ,
+  ElementalMatrix<F>& chase,
+  Int bandwidth=0 );
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& phase,
+  const Matrix<F>& chase,
+        Matrix<F>& B,
+  Int bandwidth=0 );
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& phase,
+  const ElementalMatrix<F>& chase,
+        ElementalMatrix<F>& B,
+  Int bandwidth=0 );
+
+template<typename F>
+void ApplyP
+( LeftOrRight side, Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& phase,
+  const Matrix<F>& chase,
+        Matrix<F>& B,
+  Int bandwidth=0 );
+template<typename F>
+void ApplyP
+( LeftOrRight side, Orientation orientation,
+  const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& phase,
+  const ElementalMatrix<F>& chase,
+        ElementalMatrix<F>& B,
+  Int bandwidth=0 );
+
 } // namespace bidiag
 
 // HermitianTridiag
@@ -107,10 +163,22 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<F> symvCtrl;
+
+    // Reduce to a band matrix with level-3 operations and then chase the band
+    // down to tridiagonal form (the reflectors of the second stage are stored
+    // in the opposite triangle of A, so the same control structure must be
+    // passed to herm_tridiag::ApplyQ)
+    bool twoStage=false;
+    // The bandwidth of the intermediate band matrix (Blocksize() if zero)
+    Int bandwidth=0;
 };
 
 template<typename F>
-void HermitianTridiag( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& phase );
+void HermitianTridiag
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& phase,
+  const HermitianTridiagCtrl<F>& ctrl=HermitianTridiagCtrl<F>() );
 template<typename F>
 void HermitianTridiag
 ( UpperOrLower uplo,
@@ -121,24 +189,30 @@ void HermitianTridiag
 namespace herm_tridiag {
 
 template<typename F>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A );
+void ExplicitCondensed
+( UpperOrLower uplo, Matrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl=HermitianTridiagCtrl<F>() );
 template<typename F>
 void ExplicitCondensed
 ( UpperOrLower uplo, ElementalMatrix<F>& A,
   const HermitianTridiagCtrl<F>& ctrl=HermitianTridiagCtrl<F>() );
 
+// The control structure must be the one which was passed to HermitianTridiag,
+// as the one-stage and two-stage reductions pack their reflectors differently
 template<typename F>
 void ApplyQ
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
   const Matrix<F>& A,
   const Matrix<F>& phase,
-        Matrix<F>& B );
+        Matrix<F>& B,
+  const HermitianTridiagCtrl<F>& ctrl );
 template<typename F>
 void ApplyQ
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
   const ElementalMatrix<F>& A,
   const ElementalMatrix<F>& phase, 
-        ElementalMatrix<F>& B );
+        ElementalMatrix<F>& B,
+  const HermitianTridiagCtrl<F>& ctrl );
 
 } // namespace herm_tridiag
 
@@ -454,25 +454,76 @@ Int SolveAfter
         ldl::DistMultiVecNodeMeta& meta,
   const RegSolveCtrl<Base<F>>& ctrl );
 
+// Mixed-precision variants of the above, where 'front' holds a factorization
+// of the (equilibrated and regularized) matrix in the reduced precision
+// Demote<F>. Each application of the preconditioner casts its residual down
+// to the factored precision and its correction back up, while the iterative
+// refinement and the outer Krylov solver (FGMRES or LGMRES) run as in
+// SolveAfter, in at least the working precision, F, so that the accuracy of
+// the result is not limited by that of the factorization.
+template<typename F>
+Int MixedSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl );
+template<typename F>
+Int MixedSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl );
+template<typename F>
+Int MixedSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  const RegSolveCtrl<Base<F>>& ctrl );
+
 } // namespace reg_ldl
 
 // LU
 // ==
 
-// NOTE: This is not yet made use of, but the fully-pivoted version of LU
-//       should (soon?) accept it as an argument and potentially return one or
-//       more of the permutation matrices as the identity
+// NOTE: Only LU_PARTIAL, LU_TOURNAMENT, and LU_WITHOUT_PIVOTING are accepted
+//       by the LUCtrl interface; the fully-pivoted version of LU should
+//       (soon?) accept it as an argument and potentially return one or more
+//       of the permutation matrices as the identity
 namespace LUPivotTypeNS {
 enum LUPivotType
 {
     LU_PARTIAL, 
     LU_FULL,
     LU_ROOK, /* not yet supported */
-    LU_WITHOUT_PIVOTING
+    LU_WITHOUT_PIVOTING,
+    LU_TOURNAMENT
 };
 }
 using namespace LUPivotTypeNS;
 
+// LU_TOURNAMENT selects the pivots of each distributed panel with a reduction
+// tree over the process column (communication-avoiding LU, or CALU) rather
+// than with one allreduce per column. The pivots are in general different
+// from those of partial pivoting, but the factorization is similarly stable
+// in practice. Sequential factorizations treat it as LU_PARTIAL.
+struct LUCtrl
+{
+    LUPivotType pivotType=LU_PARTIAL;
+};
+
 // LU without pivoting
 // -------------------
 template<typename F>
@@ -489,6 +540,13 @@ void LU( Matrix<F>& A, Permutation& P );
 template<typename F>
 void LU( ElementalMatrix<F>& A, DistPermutation& P );
 
+// LU with the pivoting strategy chosen by the control structure
+// -------------------------------------------------------------
+template<typename F>
+void LU( Matrix<F>& A, Permutation& P, const LUCtrl& ctrl );
+template<typename F>
+void LU( ElementalMatrix<F>& A, DistPermutation& P, const LUCtrl& ctrl );
+
 // LU with full pivoting
 // ---------------------
 // P A Q^T = L U
@@ -395,6 +395,22 @@ struct DistFront
     ( const DistNodeInfo& info, bool computeRecvInds ) const;
 };
 
+// In hybrid builds, sibling subtrees of the sequential portion of the
+// elimination tree are factored as concurrent OpenMP tasks. Subtrees requiring
+// fewer than SubtreeTaskCutoff() flops are processed inline, and a child is
+// only spawned as a task if its update matrix fits within the remaining
+// budget of SubtreeTaskMemoryLimit() entries of concurrently live updates.
+// Only the updates of spawned children are charged against this budget (the
+// updates of children processed inline and the parent fronts are not), so it
+// bounds the extra memory due to concurrency rather than the total.
+// SubtreeTaskMemoryPeak() returns the largest number of entries that were
+// simultaneously reserved during the most recent tasked factorization.
+void SetSubtreeTaskCutoff( double flops );
+double SubtreeTaskCutoff();
+void SetSubtreeTaskMemoryLimit( Int numEntries );
+Int SubtreeTaskMemoryLimit();
+Int SubtreeTaskMemoryPeak();
+
 template<typename F>
 void ChangeFrontType( Front<F>& front, LDLFrontType type, bool recurse=true );
 template<typename F>
@@ -781,6 +781,9 @@ typedef struct {
   double valChanRatio;
   double fullChanRatio;
 
+  bool twoStageBidiag;
+  ElInt bidiagBandwidth;
+
   ElBidiagSVDCtrl_s bidiagSVDCtrl;
 } ElSVDCtrl_s;
 EL_EXPORT ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl );
@@ -795,10 +798,22 @@ typedef struct {
   double valChanRatio;
   double fullChanRatio;
 
+  bool twoStageBidiag;
+  ElInt bidiagBandwidth;
+
   ElBidiagSVDCtrl_d bidiagSVDCtrl;
 } ElSVDCtrl_d;
 EL_EXPORT ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl );
 
+/* RandomizedSVDCtrl */
+typedef struct {
+  ElInt rank;
+  ElInt oversample;
+  ElInt numPowerIts;
+  bool seedWithV;
+} ElRandomizedSVDCtrl;
+EL_EXPORT ElError ElRandomizedSVDCtrlDefault( ElRandomizedSVDCtrl* ctrl );
+
 /* Compute the singular values
    --------------------------- */
 EL_EXPORT ElError ElSingularValues_s( ElConstMatrix_s A, ElMatrix_s s );
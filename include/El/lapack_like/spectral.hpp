@@ -700,6 +700,10 @@ struct HessenbergSchurCtrl
     // note that LAPACK's hard minimum of 12 does not apply to us
     Int minAEDSize = 75;
 
+    // The number of chains of bulges which the distributed sweeps chase
+    // concurrently; zero selects one chain per process
+    Int numBulgeChains = 0;
+
     function<Int(Int,Int)> numShifts =
       function<Int(Int,Int)>(hess_schur::aed::NumShifts);
 
@@ -738,6 +742,34 @@ HessenbergSchur
   Matrix<Complex<Real>>& Z,
   const HessenbergSchurCtrl& ctrl=HessenbergSchurCtrl() );
 
+template<typename Real>
+HessenbergSchurInfo
+HessenbergSchur
+( ElementalMatrix<Real>& H,
+  ElementalMatrix<Complex<Real>>& w,
+  const HessenbergSchurCtrl& ctrl=HessenbergSchurCtrl() );
+template<typename Real>
+HessenbergSchurInfo
+HessenbergSchur
+( ElementalMatrix<Real>& H,
+  ElementalMatrix<Complex<Real>>& w,
+  ElementalMatrix<Real>& Z,
+  const HessenbergSchurCtrl& ctrl=HessenbergSchurCtrl() );
+
+template<typename Real>
+HessenbergSchurInfo
+HessenbergSchur
+( ElementalMatrix<Complex<Real>>& H,
+  ElementalMatrix<Complex<Real>>& w,
+  const HessenbergSchurCtrl& ctrl=HessenbergSchurCtrl() );
+template<typename Real>
+HessenbergSchurInfo
+HessenbergSchur
+( ElementalMatrix<Complex<Real>>& H,
+  ElementalMatrix<Complex<Real>>& w,
+  ElementalMatrix<Complex<Real>>& Z,
+  const HessenbergSchurCtrl& ctrl=HessenbergSchurCtrl() );
+
 // Schur decomposition
 // ===================
 // Forward declaration
@@ -1171,6 +1203,14 @@ struct SVDCtrl
     // decomposition when computing a full SVD
     double fullChanRatio=1.5;
 
+    // Golub-Reinsch
+    // -------------
+
+    // Reduce to bidiagonal form in two stages (first to a band matrix with
+    // the given bandwidth, where zero selects the algorithmic blocksize)?
+    bool twoStageBidiag=false;
+    Int bidiagBandwidth=0;
+
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
 };
 
@@ -1288,6 +1328,62 @@ SVDInfo TSQR
 
 } // namespace svd
 
+// Randomized SVD
+// ==============
+// Approximate the leading singular triplets of A from an orthonormal basis
+// for the range of a Gaussian sketch, A Omega, refined by power iterations.
+// Cf. Halko, Martinsson, and Tropp's "Finding structure with randomness:
+// Probabilistic algorithms for constructing approximate matrix
+// decompositions" [CITATION].
+
+struct RandomizedSVDCtrl
+{
+    // The number of singular triplets to approximate
+    Int rank=10;
+
+    // The number of sketch columns beyond the rank
+    Int oversample=10;
+
+    // The number of (reorthogonalized) applications of A A^H to the sketch
+    Int numPowerIts=2;
+
+    // Seed the sketch with the columns of V on entry (e.g., the right
+    // singular vectors of a nearby matrix) rather than only Gaussian columns?
+    bool seedWithV=false;
+};
+
+// Overwrite Q with an orthonormal basis for the range of A Omega, where
+// Omega consists of the columns of 'guess' followed by Gaussian columns
+template<typename F>
+void RandomizedRange
+( const Matrix<F>& A,
+  const Matrix<F>& guess,
+        Matrix<F>& Q,
+        Int numCols,
+        Int numPowerIts=2 );
+template<typename F>
+void RandomizedRange
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& guess,
+        ElementalMatrix<F>& Q,
+        Int numCols,
+        Int numPowerIts=2 );
+
+template<typename F>
+void RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+template<typename F>
+void RandomizedSVD
+( const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& U,
+        ElementalMatrix<Base<F>>& s,
+        ElementalMatrix<F>& V,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+
 // Hermitian SVD
 // =============
 
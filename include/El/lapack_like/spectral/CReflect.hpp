@@ -681,6 +681,8 @@ inline SVDCtrl<float> CReflect( const ElSVDCtrl_s& ctrlC )
     ctrl.useScaLAPACK = ctrlC.useScaLAPACK;
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
+    ctrl.twoStageBidiag = ctrlC.twoStageBidiag;
+    ctrl.bidiagBandwidth = ctrlC.bidiagBandwidth;
     ctrl.bidiagSVDCtrl = CReflect(ctrlC.bidiagSVDCtrl);
     return ctrl;
 }
@@ -694,6 +696,8 @@ inline SVDCtrl<double> CReflect( const ElSVDCtrl_d& ctrlC )
     ctrl.useScaLAPACK = ctrlC.useScaLAPACK;
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
+    ctrl.twoStageBidiag = ctrlC.twoStageBidiag;
+    ctrl.bidiagBandwidth = ctrlC.bidiagBandwidth;
     ctrl.bidiagSVDCtrl = CReflect(ctrlC.bidiagSVDCtrl);
     return ctrl;
 }
@@ -707,6 +711,8 @@ inline ElSVDCtrl_s CReflect( const SVDCtrl<float>& ctrl )
     ctrlC.useScaLAPACK = ctrl.useScaLAPACK;
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
+    ctrlC.twoStageBidiag = ctrl.twoStageBidiag;
+    ctrlC.bidiagBandwidth = ctrl.bidiagBandwidth;
     ctrlC.bidiagSVDCtrl = CReflect(ctrl.bidiagSVDCtrl);
     return ctrlC;
 }
@@ -720,10 +726,33 @@ inline ElSVDCtrl_d CReflect( const SVDCtrl<double>& ctrl )
     ctrlC.useScaLAPACK = ctrl.useScaLAPACK;
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
+    ctrlC.twoStageBidiag = ctrl.twoStageBidiag;
+    ctrlC.bidiagBandwidth = ctrl.bidiagBandwidth;
     ctrlC.bidiagSVDCtrl = CReflect(ctrl.bidiagSVDCtrl);
     return ctrlC;
 }
 
+/* RandomizedSVDCtrl */
+inline ElRandomizedSVDCtrl CReflect( const RandomizedSVDCtrl& ctrl )
+{
+    ElRandomizedSVDCtrl ctrlC;
+    ctrlC.rank = ctrl.rank;
+    ctrlC.oversample = ctrl.oversample;
+    ctrlC.numPowerIts = ctrl.numPowerIts;
+    ctrlC.seedWithV = ctrl.seedWithV;
+    return ctrlC;
+}
+
+inline RandomizedSVDCtrl CReflect( const ElRandomizedSVDCtrl& ctrlC )
+{
+    RandomizedSVDCtrl ctrl;
+    ctrl.rank = ctrlC.rank;
+    ctrl.oversample = ctrlC.oversample;
+    ctrl.numPowerIts = ctrlC.numPowerIts;
+    ctrl.seedWithV = ctrlC.seedWithV;
+    return ctrl;
+}
+
 /* HessQRCtrl */
 inline ElHessQRCtrl CReflect( const HessQRCtrl& ctrl )
 {
@@ -34,6 +34,12 @@ struct EnumCtrl
     // Explicitly transpose 'N' to encourage unit-stride access
     bool explicitTranspose=true;
 
+    // In hybrid builds, split the enumeration tree 'splitDepth' levels beneath
+    // its root into subtrees which are traversed by a team of threads (and,
+    // for GNR_ENUM, run batches of randomized trials concurrently)
+    bool parallel=false;
+    Int splitDepth=8;
+
     // GNR_ENUM
     // --------
     // TODO: Add ability to further tune the bounding function
@@ -72,6 +78,8 @@ struct EnumCtrl
         progress = ctrl.progress;
         innerProgress = ctrl.innerProgress;
         explicitTranspose = ctrl.explicitTranspose;
+        parallel = ctrl.parallel;
+        splitDepth = ctrl.splitDepth;
 
         // GNR_ENUM
         // --------
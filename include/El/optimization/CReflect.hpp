@@ -36,12 +36,18 @@ inline ElMehrotraCtrl_s CReflect( const MehrotraCtrl<float>& ctrl )
     ctrlC.maxStepRatio  = ctrl.maxStepRatio;
     ctrlC.system        = CReflect(ctrl.system);
     ctrlC.mehrotra      = ctrl.mehrotra;
+    ctrlC.maxGondzioCorrectors  = ctrl.maxGondzioCorrectors;
+    ctrlC.gondzioStepIncrease   = ctrl.gondzioStepIncrease;
+    ctrlC.gondzioMinImprovement = ctrl.gondzioMinImprovement;
+    ctrlC.gondzioLowerRatio     = ctrl.gondzioLowerRatio;
+    ctrlC.gondzioUpperRatio     = ctrl.gondzioUpperRatio;
     ctrlC.forceSameStep = ctrl.forceSameStep;
     ctrlC.solveCtrl     = CReflect(ctrl.solveCtrl);
     ctrlC.resolveReg    = ctrl.resolveReg;
+    ctrlC.mixedPrecision = ctrl.mixedPrecision;
     ctrlC.outerEquil    = ctrl.outerEquil;
     ctrlC.basisSize     = ctrl.basisSize;
-    ctrlC.print         = ctrl.print;
+    ctrlC.print            = ctrl.print;
     ctrlC.time          = ctrl.time;
     ctrlC.wSafeMaxNorm  = ctrl.wSafeMaxNorm;
     ctrlC.wMaxLimit     = ctrl.wMaxLimit;
@@ -70,12 +76,18 @@ inline ElMehrotraCtrl_d CReflect( const MehrotraCtrl<double>& ctrl )
     ctrlC.maxStepRatio  = ctrl.maxStepRatio;
     ctrlC.system        = CReflect(ctrl.system);
     ctrlC.mehrotra      = ctrl.mehrotra;
+    ctrlC.maxGondzioCorrectors  = ctrl.maxGondzioCorrectors;
+    ctrlC.gondzioStepIncrease   = ctrl.gondzioStepIncrease;
+    ctrlC.gondzioMinImprovement = ctrl.gondzioMinImprovement;
+    ctrlC.gondzioLowerRatio     = ctrl.gondzioLowerRatio;
+    ctrlC.gondzioUpperRatio     = ctrl.gondzioUpperRatio;
     ctrlC.forceSameStep = ctrl.forceSameStep;
     ctrlC.solveCtrl     = CReflect(ctrl.solveCtrl);
     ctrlC.resolveReg    = ctrl.resolveReg;
+    ctrlC.mixedPrecision = ctrl.mixedPrecision;
     ctrlC.outerEquil    = ctrl.outerEquil;
     ctrlC.basisSize     = ctrl.basisSize;
-    ctrlC.print         = ctrl.print;
+    ctrlC.print            = ctrl.print;
     ctrlC.time          = ctrl.time;
     ctrlC.wSafeMaxNorm  = ctrl.wSafeMaxNorm;
     ctrlC.wMaxLimit     = ctrl.wMaxLimit;
@@ -104,12 +116,18 @@ inline MehrotraCtrl<float> CReflect( const ElMehrotraCtrl_s& ctrlC )
     ctrl.maxStepRatio  = ctrlC.maxStepRatio;
     ctrl.system        = CReflect(ctrlC.system);
     ctrl.mehrotra      = ctrlC.mehrotra;
+    ctrl.maxGondzioCorrectors  = ctrlC.maxGondzioCorrectors;
+    ctrl.gondzioStepIncrease   = ctrlC.gondzioStepIncrease;
+    ctrl.gondzioMinImprovement = ctrlC.gondzioMinImprovement;
+    ctrl.gondzioLowerRatio     = ctrlC.gondzioLowerRatio;
+    ctrl.gondzioUpperRatio     = ctrlC.gondzioUpperRatio;
     ctrl.forceSameStep = ctrlC.forceSameStep;
     ctrl.solveCtrl     = CReflect(ctrlC.solveCtrl);
     ctrl.resolveReg    = ctrlC.resolveReg;
+    ctrl.mixedPrecision = ctrlC.mixedPrecision;
     ctrl.outerEquil    = ctrlC.outerEquil;
     ctrl.basisSize     = ctrlC.basisSize;
-    ctrl.print         = ctrlC.print;
+    ctrl.print            = ctrlC.print;
     ctrl.time          = ctrlC.time;
     ctrl.wSafeMaxNorm  = ctrlC.wSafeMaxNorm;
     ctrl.wMaxLimit     = ctrlC.wMaxLimit;
@@ -138,12 +156,18 @@ inline MehrotraCtrl<double> CReflect( const ElMehrotraCtrl_d& ctrlC )
     ctrl.maxStepRatio  = ctrlC.maxStepRatio;
     ctrl.system        = CReflect(ctrlC.system);
     ctrl.mehrotra      = ctrlC.mehrotra;
+    ctrl.maxGondzioCorrectors  = ctrlC.maxGondzioCorrectors;
+    ctrl.gondzioStepIncrease   = ctrlC.gondzioStepIncrease;
+    ctrl.gondzioMinImprovement = ctrlC.gondzioMinImprovement;
+    ctrl.gondzioLowerRatio     = ctrlC.gondzioLowerRatio;
+    ctrl.gondzioUpperRatio     = ctrlC.gondzioUpperRatio;
     ctrl.forceSameStep = ctrlC.forceSameStep;
     ctrl.solveCtrl     = CReflect(ctrlC.solveCtrl);
     ctrl.resolveReg    = ctrlC.resolveReg;
+    ctrl.mixedPrecision = ctrlC.mixedPrecision;
     ctrl.outerEquil    = ctrlC.outerEquil;
     ctrl.basisSize     = ctrlC.basisSize;
-    ctrl.print         = ctrlC.print;
+    ctrl.print            = ctrlC.print;
     ctrl.time          = ctrlC.time;
     ctrl.wSafeMaxNorm  = ctrlC.wSafeMaxNorm;
     ctrl.wMaxLimit     = ctrlC.wMaxLimit;
@@ -173,7 +197,7 @@ inline ElADMMCtrl_s CReflect( const ADMMCtrl<float>& ctrl )
     ctrlC.absTol  = ctrl.absTol;
     ctrlC.relTol  = ctrl.relTol;
     ctrlC.inv     = ctrl.inv;
-    ctrlC.print   = ctrl.print;
+    ctrlC.print            = ctrl.print;
     return ctrlC;
 }
 inline ElADMMCtrl_d CReflect( const ADMMCtrl<double>& ctrl )
@@ -185,7 +209,7 @@ inline ElADMMCtrl_d CReflect( const ADMMCtrl<double>& ctrl )
     ctrlC.absTol  = ctrl.absTol;
     ctrlC.relTol  = ctrl.relTol;
     ctrlC.inv     = ctrl.inv;
-    ctrlC.print   = ctrl.print;
+    ctrlC.print            = ctrl.print;
     return ctrlC;
 }
 inline ADMMCtrl<float> CReflect( const ElADMMCtrl_s& ctrlC )
@@ -197,7 +221,7 @@ inline ADMMCtrl<float> CReflect( const ElADMMCtrl_s& ctrlC )
     ctrl.absTol  = ctrlC.absTol;
     ctrl.relTol  = ctrlC.relTol;
     ctrl.inv     = ctrlC.inv;
-    ctrl.print   = ctrlC.print;
+    ctrl.print            = ctrlC.print;
     return ctrl;
 }
 inline ADMMCtrl<double> CReflect( const ElADMMCtrl_d& ctrlC )
@@ -209,7 +233,48 @@ inline ADMMCtrl<double> CReflect( const ElADMMCtrl_d& ctrlC )
     ctrl.absTol  = ctrlC.absTol;
     ctrl.relTol  = ctrlC.relTol;
     ctrl.inv     = ctrlC.inv;
-    ctrl.print   = ctrlC.print;
+    ctrl.print            = ctrlC.print;
+    return ctrl;
+}
+
+inline ElPresolveCtrl_s CReflect( const PresolveCtrl<float>& ctrl )
+{
+    ElPresolveCtrl_s ctrlC;
+    ctrlC.enable           = ctrl.enable;
+    ctrlC.maxPasses        = ctrl.maxPasses;
+    ctrlC.maxGatherEntries = ctrl.maxGatherEntries;
+    ctrlC.tol              = ctrl.tol;
+    ctrlC.print            = ctrl.print;
+    return ctrlC;
+}
+inline ElPresolveCtrl_d CReflect( const PresolveCtrl<double>& ctrl )
+{
+    ElPresolveCtrl_d ctrlC;
+    ctrlC.enable           = ctrl.enable;
+    ctrlC.maxPasses        = ctrl.maxPasses;
+    ctrlC.maxGatherEntries = ctrl.maxGatherEntries;
+    ctrlC.tol              = ctrl.tol;
+    ctrlC.print            = ctrl.print;
+    return ctrlC;
+}
+inline PresolveCtrl<float> CReflect( const ElPresolveCtrl_s& ctrlC )
+{
+    PresolveCtrl<float> ctrl;
+    ctrl.enable           = ctrlC.enable;
+    ctrl.maxPasses        = ctrlC.maxPasses;
+    ctrl.maxGatherEntries = ctrlC.maxGatherEntries;
+    ctrl.tol              = ctrlC.tol;
+    ctrl.print            = ctrlC.print;
+    return ctrl;
+}
+inline PresolveCtrl<double> CReflect( const ElPresolveCtrl_d& ctrlC )
+{
+    PresolveCtrl<double> ctrl;
+    ctrl.enable           = ctrlC.enable;
+    ctrl.maxPasses        = ctrlC.maxPasses;
+    ctrl.maxGatherEntries = ctrlC.maxGatherEntries;
+    ctrl.tol              = ctrlC.tol;
+    ctrl.print            = ctrlC.print;
     return ctrl;
 }
 
@@ -228,6 +293,7 @@ inline ElLPDirectCtrl_s CReflect( const lp::direct::Ctrl<float>& ctrl )
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.admmCtrl     = CReflect(ctrl.admmCtrl);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolveCtrl = CReflect(ctrl.presolveCtrl);
     return ctrlC;
 }
 inline ElLPDirectCtrl_d CReflect( const lp::direct::Ctrl<double>& ctrl )
@@ -236,6 +302,7 @@ inline ElLPDirectCtrl_d CReflect( const lp::direct::Ctrl<double>& ctrl )
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.admmCtrl     = CReflect(ctrl.admmCtrl);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolveCtrl = CReflect(ctrl.presolveCtrl);
     return ctrlC;
 }
 inline lp::direct::Ctrl<float> CReflect( const ElLPDirectCtrl_s& ctrlC )
@@ -244,6 +311,7 @@ inline lp::direct::Ctrl<float> CReflect( const ElLPDirectCtrl_s& ctrlC )
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.admmCtrl     = CReflect(ctrlC.admmCtrl);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolveCtrl = CReflect(ctrlC.presolveCtrl);
     return ctrl;
 }
 inline lp::direct::Ctrl<double> CReflect( const ElLPDirectCtrl_d& ctrlC )
@@ -252,6 +320,7 @@ inline lp::direct::Ctrl<double> CReflect( const ElLPDirectCtrl_d& ctrlC )
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.admmCtrl     = CReflect(ctrlC.admmCtrl);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolveCtrl = CReflect(ctrlC.presolveCtrl);
     return ctrl;
 }
 
@@ -300,6 +369,7 @@ inline ElQPDirectCtrl_s CReflect( const qp::direct::Ctrl<float>& ctrl )
     ElQPDirectCtrl_s ctrlC;
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolveCtrl = CReflect(ctrl.presolveCtrl);
     return ctrlC;
 }
 inline ElQPDirectCtrl_d CReflect( const qp::direct::Ctrl<double>& ctrl )
@@ -307,6 +377,7 @@ inline ElQPDirectCtrl_d CReflect( const qp::direct::Ctrl<double>& ctrl )
     ElQPDirectCtrl_d ctrlC;
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolveCtrl = CReflect(ctrl.presolveCtrl);
     return ctrlC;
 }
 inline qp::direct::Ctrl<float> CReflect( const ElQPDirectCtrl_s& ctrlC )
@@ -314,6 +385,7 @@ inline qp::direct::Ctrl<float> CReflect( const ElQPDirectCtrl_s& ctrlC )
     qp::direct::Ctrl<float> ctrl;
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolveCtrl = CReflect(ctrlC.presolveCtrl);
     return ctrl;
 }
 inline qp::direct::Ctrl<double> CReflect( const ElQPDirectCtrl_d& ctrlC )
@@ -321,6 +393,7 @@ inline qp::direct::Ctrl<double> CReflect( const ElQPDirectCtrl_d& ctrlC )
     qp::direct::Ctrl<double> ctrl;
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolveCtrl = CReflect(ctrlC.presolveCtrl);
     return ctrl;
 }
 
@@ -745,7 +818,9 @@ inline ElRPCACtrl_s CReflect( const RPCACtrl<float>& ctrl )
     ctrlC.tau         = ctrl.tau;
     ctrlC.beta        = ctrl.beta;
     ctrlC.rho         = ctrl.rho;
-    ctrlC.tol         = ctrl.tol;
+    ctrlC.tol              = ctrl.tol;
+    ctrlC.useRandomized  = ctrl.useRandomized;
+    ctrlC.randomizedCtrl = CReflect(ctrl.randomizedCtrl);
     return ctrlC;
 }
 
@@ -760,7 +835,9 @@ inline ElRPCACtrl_d CReflect( const RPCACtrl<double>& ctrl )
     ctrlC.tau         = ctrl.tau;
     ctrlC.beta        = ctrl.beta;
     ctrlC.rho         = ctrl.rho;
-    ctrlC.tol         = ctrl.tol;
+    ctrlC.tol              = ctrl.tol;
+    ctrlC.useRandomized  = ctrl.useRandomized;
+    ctrlC.randomizedCtrl = CReflect(ctrl.randomizedCtrl);
     return ctrlC;
 }
 
@@ -775,7 +852,9 @@ inline RPCACtrl<float> CReflect( const ElRPCACtrl_s& ctrlC )
     ctrl.tau         = ctrlC.tau;
     ctrl.beta        = ctrlC.beta;
     ctrl.rho         = ctrlC.rho;
-    ctrl.tol         = ctrlC.tol;
+    ctrl.tol              = ctrlC.tol;
+    ctrl.useRandomized  = ctrlC.useRandomized;
+    ctrl.randomizedCtrl = CReflect(ctrlC.randomizedCtrl);
     return ctrl;
 }
 
@@ -790,7 +869,9 @@ inline RPCACtrl<double> CReflect( const ElRPCACtrl_d& ctrlC )
     ctrl.tau         = ctrlC.tau;
     ctrl.beta        = ctrlC.beta;
     ctrl.rho         = ctrlC.rho;
-    ctrl.tol         = ctrlC.tol;
+    ctrl.tol              = ctrlC.tol;
+    ctrl.useRandomized  = ctrlC.useRandomized;
+    ctrl.randomizedCtrl = CReflect(ctrlC.randomizedCtrl);
     return ctrl;
 }
 
@@ -1006,24 +1006,28 @@ typedef struct {
   bool useALM;
   bool usePivQR;
   bool progress;
+  bool useRandomized;
   ElInt numPivSteps;
   ElInt maxIts;
   float tau;
   float beta;
   float rho;
   float tol;
+  ElRandomizedSVDCtrl randomizedCtrl;
 } ElRPCACtrl_s;
 
 typedef struct {
   bool useALM;
   bool usePivQR;
   bool progress;
+  bool useRandomized;
   ElInt numPivSteps;
   ElInt maxIts;
   double tau;
   double beta;
   double rho;
   double tol;
+  ElRandomizedSVDCtrl randomizedCtrl;
 } ElRPCACtrl_d;
 
 EL_EXPORT ElError ElRPCACtrlDefault_s( ElRPCACtrl_s* ctrl );
@@ -525,6 +525,10 @@ struct RPCACtrl
     bool usePivQR=false;
     bool progress=true;
 
+    // Approximate each singular-value thresholding with a randomized SVD,
+    // reusing the previous iteration's right singular subspace
+    bool useRandomized=false;
+
     Int numPivSteps=75;
     Int maxIts=1000;
 
@@ -532,6 +536,8 @@ struct RPCACtrl
     Real beta=Real(1);
     Real rho=Real(6);
     Real tol=Real(1e-5);
+
+    RandomizedSVDCtrl randomizedCtrl;
 };
 
 template<typename F>
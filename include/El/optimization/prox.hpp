@@ -110,6 +110,17 @@ Int PivotedQR
 template<typename F>
 Int TSQR( ElementalMatrix<F>& A, Base<F> rho, bool relative=false );
 
+// Approximate the SVD via a randomized SVD whose rank adapts to the
+// threshold; V carries the right singular subspace between calls
+template<typename F>
+Int Randomized
+( Matrix<F>& A, Base<F> rho, Matrix<F>& V,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl(), bool relative=false );
+template<typename F>
+Int Randomized
+( ElementalMatrix<F>& A, Base<F> rho, ElementalMatrix<F>& V,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl(), bool relative=false );
+
 } // namespace svt
 
 // Soft-thresholding
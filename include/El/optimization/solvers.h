@@ -30,9 +30,15 @@ typedef struct {
   float maxStepRatio;
   ElKKTSystem system;
   bool mehrotra;
+  ElInt maxGondzioCorrectors;
+  float gondzioStepIncrease;
+  float gondzioMinImprovement;
+  float gondzioLowerRatio;
+  float gondzioUpperRatio;
   bool forceSameStep;
   ElRegSolveCtrl_s solveCtrl;
   bool resolveReg;
+  bool mixedPrecision;
   bool outerEquil;
   ElInt basisSize;
   bool print;
@@ -60,9 +66,15 @@ typedef struct {
   double maxStepRatio;
   ElKKTSystem system;
   bool mehrotra;
+  ElInt maxGondzioCorrectors;
+  double gondzioStepIncrease;
+  double gondzioMinImprovement;
+  double gondzioLowerRatio;
+  double gondzioUpperRatio;
   bool forceSameStep;
   ElRegSolveCtrl_d solveCtrl;
   bool resolveReg;
+  bool mixedPrecision;
   bool outerEquil;
   ElInt basisSize;
   bool print;
@@ -110,6 +122,27 @@ typedef struct {
 EL_EXPORT ElError ElADMMCtrlDefault_s( ElADMMCtrl_s* ctrl );
 EL_EXPORT ElError ElADMMCtrlDefault_d( ElADMMCtrl_d* ctrl );
 
+/* Presolve
+   ======== */
+typedef struct {
+  bool enable;
+  ElInt maxPasses;
+  ElInt maxGatherEntries;
+  float tol;
+  bool print;
+} ElPresolveCtrl_s;
+
+typedef struct {
+  bool enable;
+  ElInt maxPasses;
+  ElInt maxGatherEntries;
+  double tol;
+  bool print;
+} ElPresolveCtrl_d;
+
+EL_EXPORT ElError ElPresolveCtrlDefault_s( ElPresolveCtrl_s* ctrl );
+EL_EXPORT ElError ElPresolveCtrlDefault_d( ElPresolveCtrl_d* ctrl );
+
 /* Linear programs
    =============== */
 typedef enum {
@@ -185,11 +218,13 @@ typedef struct {
   ElLPApproach approach;  
   ElADMMCtrl_s admmCtrl;
   ElMehrotraCtrl_s mehrotraCtrl;
+  ElPresolveCtrl_s presolveCtrl;
 } ElLPDirectCtrl_s;
 typedef struct {
   ElLPApproach approach;  
   ElADMMCtrl_d admmCtrl;
   ElMehrotraCtrl_d mehrotraCtrl;
+  ElPresolveCtrl_d presolveCtrl;
 } ElLPDirectCtrl_d;
 
 EL_EXPORT ElError ElLPDirectCtrlDefault_s
@@ -539,10 +574,12 @@ EL_EXPORT ElError ElQPDirectDistSparse_d
 typedef struct {
   ElQPApproach approach;  
   ElMehrotraCtrl_s mehrotraCtrl;
+  ElPresolveCtrl_s presolveCtrl;
 } ElQPDirectCtrl_s;
 typedef struct {
   ElQPApproach approach;  
   ElMehrotraCtrl_d mehrotraCtrl;
+  ElPresolveCtrl_d presolveCtrl;
 } ElQPDirectCtrl_d;
 
 EL_EXPORT ElError ElQPDirectCtrlDefault_s( ElQPDirectCtrl_s* ctrl );
@@ -73,9 +73,25 @@ struct MehrotraCtrl
     KKTSystem system=FULL_KKT;
 
     // Use Mehrotra's second-order corrector?
-    // TODO: Add support for Gondzio's correctors
     bool mehrotra=true;
 
+    // The rule for choosing the centrality parameter, sigma, from
+    // (mu,muAff,alphaAffPri,alphaAffDual)
+    function<Real(Real,Real,Real,Real)> centralityRule =
+      function<Real(Real,Real,Real,Real)>(StepLengthCentrality<Real>);
+
+    // The maximum number of Gondzio's multiple centrality correctors to
+    // apply after the combined direction. Each reuses the factorization of
+    // the KKT system and is only kept if it lengthens the step by at least
+    // 'gondzioMinImprovement*gondzioStepIncrease'; the complementarity products
+    // of the trial point are pushed into the interval
+    // [gondzioLowerRatio,gondzioUpperRatio]*sigma*mu.
+    Int maxGondzioCorrectors=0;
+    Real gondzioStepIncrease=Real(0.1);
+    Real gondzioMinImprovement=Real(0.1);
+    Real gondzioLowerRatio=Real(0.1);
+    Real gondzioUpperRatio=Real(10);
+
     // Force the primal and dual step lengths to be the same size?
     bool forceSameStep=true;
 
@@ -88,6 +104,14 @@ struct MehrotraCtrl
     //       cost and number of iterations.
     bool resolveReg=true;
 
+    // Factor the KKT systems in the reduced precision Demote<Real> (e.g.,
+    // double for DoubleDouble, QuadDouble, Quad, and BigFloat) and recover
+    // the working precision with iterative refinement and the Krylov solver
+    // selected by 'solveCtrl' (which is then always used to resolve the
+    // regularization). This currently only applies to the sparse
+    // FULL_KKT and AUGMENTED_KKT systems of the 'direct' LP and QP solvers.
+    bool mixedPrecision=false;
+
     // Wrap the Interior Point Method with an equilibration.
     // This should almost always be set to true.
     bool outerEquil=true;
@@ -143,9 +167,6 @@ struct MehrotraCtrl
     Real reg0Perm = Pow(limits::Epsilon<Real>(),Real(0.35));
     Real reg1Perm = Pow(limits::Epsilon<Real>(),Real(0.35));
     Real reg2Perm = Pow(limits::Epsilon<Real>(),Real(0.35));
-
-    // TODO: Add a user-definable (muAff,mu) -> sigma function to replace
-    //       the default, (muAff/mu)^3 
 };
 
 // Alternating Direction Method of Multipliers
@@ -163,6 +184,29 @@ struct ADMMCtrl
     bool print=true;
 };
 
+// Presolve
+// ========
+// Reductions of sparse "direct" conic-form LPs and QPs (singleton, forcing,
+// duplicate, and empty rows as well as empty and dominated columns) which are
+// applied before, and undone after, an Interior Point Method.
+//
+// The reductions are sequential, so the distributed solvers gather the entire
+// problem onto the root process in order to presolve and postsolve it, and
+// only the reduced problem is solved in parallel. Since this does not scale in
+// memory, presolve is skipped for distributed problems whose constraint and
+// Hessian matrices together have more than 'maxGatherEntries' nonzeros (a
+// negative value removes the limit).
+template<typename Real>
+struct PresolveCtrl
+{
+    bool enable=false;
+    Int maxPasses=10;
+    Int maxGatherEntries=10000000;
+    // The relative tolerance for treating residuals and coefficients as zero
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.75));
+    bool print=false;
+};
+
 // Linear program
 // ==============
 
@@ -195,6 +239,8 @@ struct Ctrl
     LPApproach approach=LP_MEHROTRA;
     ADMMCtrl<Real> admmCtrl;
     MehrotraCtrl<Real> mehrotraCtrl;
+    // Only used by the sparse solvers
+    PresolveCtrl<Real> presolveCtrl;
 
     Ctrl( bool isSparse ) 
     { mehrotraCtrl.system = ( isSparse ? AUGMENTED_KKT : NORMAL_KKT ); }
@@ -347,6 +393,8 @@ struct Ctrl
 {
     QPApproach approach=QP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
+    // Only used by the sparse solvers
+    PresolveCtrl<Real> presolveCtrl;
 
     Ctrl() { mehrotraCtrl.system = AUGMENTED_KKT; }
 };
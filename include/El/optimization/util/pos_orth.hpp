@@ -45,6 +45,49 @@ Real MaxStep
   const DistMultiVec<Real>& ds, 
   Real upperBound=std::numeric_limits<Real>::max() );
 
+// Gondzio's multiple centrality corrector
+// =======================================
+// Form the change, t, in the complementarity products of the trial point
+// (s + alphaPri ds, z + alphaDual dz) needed to move each product into
+// [lowerRatio,upperRatio]*mu (products above the upper bound are only
+// pulled down by at most upperRatio*mu).
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void GondzioCorrection
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real mu,
+  Real lowerRatio,
+  Real upperRatio,
+        Matrix<Real>& t );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void GondzioCorrection
+( const ElementalMatrix<Real>& s,
+  const ElementalMatrix<Real>& ds,
+  const ElementalMatrix<Real>& z,
+  const ElementalMatrix<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real mu,
+  Real lowerRatio,
+  Real upperRatio,
+        ElementalMatrix<Real>& t );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void GondzioCorrection
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real mu,
+  Real lowerRatio,
+  Real upperRatio,
+        DistMultiVec<Real>& t );
+
 // Number of members outside of cone
 // =================================
 template<typename Real,typename=EnableIf<IsReal<Real>>>
@@ -804,6 +804,8 @@ class SVDCtrl_s(ctypes.Structure):
               ("useScaLAPACK",bType),
               ("valChanRatio",dType),
               ("fullChanRatio",dType),
+              ("twoStageBidiag",bType),
+              ("bidiagBandwidth",iType),
               ("bidiagSVDCtrl",BidiagSVDCtrl_s)]
   def __init__(self):
     lib.ElSVDCtrlDefault_s(pointer(self))
@@ -815,10 +817,21 @@ class SVDCtrl_d(ctypes.Structure):
               ("useScaLAPACK",bType),
               ("valChanRatio",dType),
               ("fullChanRatio",dType),
+              ("twoStageBidiag",bType),
+              ("bidiagBandwidth",iType),
               ("bidiagSVDCtrl",BidiagSVDCtrl_d)]
   def __init__(self):
     lib.ElSVDCtrlDefault_d(pointer(self))
 
+lib.ElRandomizedSVDCtrlDefault.argtypes = [c_void_p]
+class RandomizedSVDCtrl(ctypes.Structure):
+  _fields_ = [("rank",iType),
+              ("oversample",iType),
+              ("numPowerIts",iType),
+              ("seedWithV",bType)]
+  def __init__(self):
+    lib.ElRandomizedSVDCtrlDefault(pointer(self))
+
 lib.ElSingularValues_s.argtypes = \
 lib.ElSingularValues_d.argtypes = \
 lib.ElSingularValues_c.argtypes = \
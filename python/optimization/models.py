@@ -8,6 +8,7 @@
 #
 from El.core import *
 from solvers import *
+from El.lapack_like.spectral import RandomizedSVDCtrl
 
 from ctypes import CFUNCTYPE
 
@@ -1078,14 +1079,18 @@ lib.ElRPCACtrlDefault_d.argtypes = \
   [c_void_p]
 class RPCACtrl_s(ctypes.Structure):
   _fields_ = [("useALM",bType),("usePivQR",bType),("progress",bType),
+              ("useRandomized",bType),
               ("numPivSteps",iType),("maxIts",iType),
-              ("tau",sType),("beta",sType),("rho",sType),("tol",sType)]
+              ("tau",sType),("beta",sType),("rho",sType),("tol",sType),
+              ("randomizedCtrl",RandomizedSVDCtrl)]
   def __init__(self):
     lib.ElRPCACtrlDefault_s(pointer(self))
 class RPCACtrl_d(ctypes.Structure):
   _fields_ = [("useALM",bType),("usePivQR",bType),("progress",bType),
+              ("useRandomized",bType),
               ("numPivSteps",iType),("maxIts",iType),
-              ("tau",dType),("beta",dType),("rho",dType),("tol",dType)]
+              ("tau",dType),("beta",dType),("rho",dType),("tol",dType),
+              ("randomizedCtrl",RandomizedSVDCtrl)]
   def __init__(self):
     lib.ElRPCACtrlDefault_d(pointer(self))
 
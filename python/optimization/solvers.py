@@ -23,9 +23,13 @@ class MehrotraCtrl_s(ctypes.Structure):
               ("maxStepRatio",sType),
               ("system",c_uint),
               ("mehrotra",bType),
+              ("maxGondzioCorrectors",iType),
+              ("gondzioStepIncrease",sType),("gondzioMinImprovement",sType),
+              ("gondzioLowerRatio",sType),("gondzioUpperRatio",sType),
               ("forceSameStep",bType),
               ("solveCtrl",RegSolveCtrl_s),
               ("resolveReg",bType),
+              ("mixedPrecision",bType),
               ("outerEquil",bType),
               ("basisSize",iType),
               ("progress",bType),
@@ -47,9 +51,13 @@ class MehrotraCtrl_d(ctypes.Structure):
               ("maxStepRatio",dType),
               ("system",c_uint),
               ("mehrotra",bType),
+              ("maxGondzioCorrectors",iType),
+              ("gondzioStepIncrease",dType),("gondzioMinImprovement",dType),
+              ("gondzioLowerRatio",dType),("gondzioUpperRatio",dType),
               ("forceSameStep",bType),
               ("solveCtrl",RegSolveCtrl_d),
               ("resolveReg",bType),
+              ("mixedPrecision",bType),
               ("outerEquil",bType),
               ("basisSize",iType),
               ("progress",bType),
@@ -85,6 +93,24 @@ class ADMMCtrl_d(ctypes.Structure):
   def __init__(self):
     lib.ElADMMCtrlDefault_d(pointer(self))
 
+# Presolve
+# ========
+lib.ElPresolveCtrlDefault_s.argtypes = \
+lib.ElPresolveCtrlDefault_d.argtypes = \
+  [c_void_p]
+class PresolveCtrl_s(ctypes.Structure):
+  _fields_ = [("enable",bType),("maxPasses",iType),
+              ("maxGatherEntries",iType),
+              ("tol",sType),("print",bType)]
+  def __init__(self):
+    lib.ElPresolveCtrlDefault_s(pointer(self))
+class PresolveCtrl_d(ctypes.Structure):
+  _fields_ = [("enable",bType),("maxPasses",iType),
+              ("maxGatherEntries",iType),
+              ("tol",dType),("print",bType)]
+  def __init__(self):
+    lib.ElPresolveCtrlDefault_d(pointer(self))
+
 # Linear program
 # ==============
 
@@ -97,12 +123,14 @@ lib.ElLPDirectCtrlDefault_d.argtypes = \
   [c_void_p,bType]
 class LPDirectCtrl_s(ctypes.Structure):
   _fields_ = [("approach",c_uint),("admmCtrl",ADMMCtrl_s),
-              ("mehrotraCtrl",MehrotraCtrl_s)]
+              ("mehrotraCtrl",MehrotraCtrl_s),
+              ("presolveCtrl",PresolveCtrl_s)]
   def __init__(self,isSparse=True):
     lib.ElLPDirectCtrlDefault_s(pointer(self),isSparse)
 class LPDirectCtrl_d(ctypes.Structure):
   _fields_ = [("approach",c_uint),("admmCtrl",ADMMCtrl_d),
-              ("mehrotraCtrl",MehrotraCtrl_d)]
+              ("mehrotraCtrl",MehrotraCtrl_d),
+              ("presolveCtrl",PresolveCtrl_d)]
   def __init__(self,isSparse=True):
     lib.ElLPDirectCtrlDefault_d(pointer(self),isSparse)
 
@@ -290,12 +318,14 @@ lib.ElQPDirectCtrlDefault_d.argtypes = \
   [c_void_p]
 class QPDirectCtrl_s(ctypes.Structure):
   _fields_ = [("approach",c_uint),
-              ("mehrotraCtrl",MehrotraCtrl_s)]
+              ("mehrotraCtrl",MehrotraCtrl_s),
+              ("presolveCtrl",PresolveCtrl_s)]
   def __init__(self):
     lib.ElQPDirectCtrlDefault_s(pointer(self))
 class QPDirectCtrl_d(ctypes.Structure):
   _fields_ = [("approach",c_uint),
-              ("mehrotraCtrl",MehrotraCtrl_d)]
+              ("mehrotraCtrl",MehrotraCtrl_d),
+              ("presolveCtrl",PresolveCtrl_d)]
   def __init__(self):
     lib.ElQPDirectCtrlDefault_d(pointer(self))
 
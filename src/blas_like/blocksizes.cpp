@@ -15,6 +15,9 @@ using namespace El;
 
 std::stack<Int> blocksizeStack;
 
+Int gemmDepth = 0;
+Int gemmDotBlocksize = 2000;
+
 template<typename T>
 struct LocalSymvBlocksizeHelper { static Int value; };
 template<typename T>
@@ -70,6 +73,26 @@ void EmptyBlocksizeStack()
         ::blocksizeStack.pop();
 }
 
+void SetGemmDepth( Int depth )
+{
+    if( depth < 0 )
+        LogicError("Gemm depth must be non-negative");
+    ::gemmDepth = depth;
+}
+
+Int GemmDepth()
+{ return ::gemmDepth; }
+
+void SetGemmDotBlocksize( Int blocksize )
+{
+    if( blocksize <= 0 )
+        LogicError("Gemm dot blocksize must be positive");
+    ::gemmDotBlocksize = blocksize;
+}
+
+Int GemmDotBlocksize()
+{ return ::gemmDotBlocksize; }
+
 template<typename T>
 void SetLocalSymvBlocksize( Int blocksize )
 { LocalSymvBlocksizeHelper<T>::value = blocksize; }
@@ -8,9 +8,46 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
+#include <map>
+
+namespace {
+
+// The number of cached redistribution plans before the cache is flushed
+const size_t maxRedistPlans = 64;
+
+std::map<El::copy::RedistPlanKey,El::copy::RedistPlan> redistPlans;
+
+} // anonymous namespace
 
 namespace El {
 
+namespace copy {
+
+bool operator<( const RedistPlanKey& a, const RedistPlanKey& b )
+{
+    if( a.AGUID != b.AGUID ) return a.AGUID < b.AGUID;
+    if( a.BGUID != b.BGUID ) return a.BGUID < b.BGUID;
+    return a.meta < b.meta;
+}
+
+RedistPlan* FindRedistPlan( const RedistPlanKey& key )
+{
+    auto it = ::redistPlans.find( key );
+    return ( it == ::redistPlans.end() ? nullptr : &it->second );
+}
+
+RedistPlan& NewRedistPlan( const RedistPlanKey& key )
+{
+    if( ::redistPlans.size() >= ::maxRedistPlans )
+        ::redistPlans.clear();
+    return ::redistPlans[key];
+}
+
+void ClearRedistPlans()
+{ ::redistPlans.clear(); }
+
+} // namespace copy
+
 void Copy( const Graph& A, Graph& B )
 {
     DEBUG_CSE
@@ -19,9 +56,13 @@ void Copy( const Graph& A, Graph& B )
 
     B.Resize( numSources, numTargets );
     // Directly assign instead of queueing up the individual edges
-    B.sources_ = A.sources_;
+    if( A.compressed_ && A.consistent_ )
+        SwapClear( B.sources_ );
+    else
+        B.sources_ = A.sources_;
     B.targets_ = A.targets_;
     B.consistent_ = A.consistent_;
+    B.compressed_ = A.compressed_;
     B.sourceOffsets_ = A.sourceOffsets_;
     B.ProcessQueues();
 }
@@ -35,7 +76,15 @@ void Copy( const Graph& A, DistGraph& B )
     B.SetComm( mpi::COMM_SELF );
     B.Resize( numSources, numTargets );
     // Directly assign instead of queueing up the individual edges
-    B.sources_ = A.sources_;
+    if( A.compressed_ && A.consistent_ )
+    {
+        B.sources_.resize( A.NumEdges() );
+        for( Int s=0; s<numSources; ++s )
+            for( Int e=A.SourceOffset(s); e<A.SourceOffset(s+1); ++e )
+                B.sources_[e] = s;
+    }
+    else
+        B.sources_ = A.sources_;
     B.targets_ = A.targets_;
     B.locallyConsistent_ = A.consistent_;
     B.localSourceOffsets_ = A.sourceOffsets_;
@@ -56,6 +105,7 @@ void Copy( const DistGraph& A, Graph& B )
     B.sources_ = A.sources_;
     B.targets_ = A.targets_;
     B.consistent_ = A.locallyConsistent_;
+    B.compressed_ = false;
     B.sourceOffsets_ = A.localSourceOffsets_;
     B.ProcessQueues();
 }
@@ -8,14 +8,103 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
+#include <El/matrices.hpp>
+#include <map>
 
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/SUMMA25D.hpp"
 
 namespace El {
 
+namespace gemm {
+
+inline string TuningRoutine( Orientation orientA, Orientation orientB )
+{
+    return BuildString
+    ("Gemm",(orientA==NORMAL ? 'N' : 'T'),(orientB==NORMAL ? 'N' : 'T'));
+}
+
+// Whether an algorithm can form the given product on the grid g, where k is
+// the summation dimension
+inline bool Applicable
+( GemmAlgorithm alg, Orientation orientA, Orientation orientB,
+  const Grid& g, Int k )
+{
+    switch( alg )
+    {
+    case GEMM_DEFAULT:
+    case GEMM_SUMMA_A:
+    case GEMM_SUMMA_B:
+    case GEMM_SUMMA_C:
+    case GEMM_SUMMA_DOT:
+        return true;
+    case GEMM_CANNON:
+        return orientA == NORMAL && orientB == NORMAL &&
+               g.Height() == g.Width() && k % g.Height() == 0;
+    case GEMM_SUMMA_25D:
+        return SUMMA25DDepth(g.Size()) > 1 &&
+               g.Size() == mpi::Size(g.ViewingComm());
+    default:
+        return false;
+    }
+}
+
+namespace {
+
+std::map<std::pair<size_t,Int>,unique_ptr<SUMMA25DLayers>> summa25DLayers;
+
+} // anonymous namespace
+
+SUMMA25DLayers::~SUMMA25DLayers()
+{
+    if( depthComm != mpi::COMM_NULL )
+        mpi::Free( depthComm );
+}
+
+const SUMMA25DLayers& GetSUMMA25DLayers( const Grid& g, Int c )
+{
+    DEBUG_CSE
+    auto& entry = summa25DLayers[std::make_pair(g.GUID(),c)];
+    if( entry )
+        return *entry;
+
+    entry.reset( new SUMMA25DLayers );
+    SUMMA25DLayers& layers = *entry;
+    const Int p = g.Size();
+    const Int layerSize = p / c;
+    const Int layerHeight = Grid::FindFactor( layerSize );
+    mpi::Group viewingGroup;
+    mpi::CommGroup( g.ViewingComm(), viewingGroup );
+    layers.grids.resize( c );
+    vector<int> ranks(layerSize);
+    for( Int l=0; l<c; ++l )
+    {
+        for( Int q=0; q<layerSize; ++q )
+            ranks[q] = g.VCToViewing( l*layerSize+q );
+        mpi::Group owners;
+        mpi::Incl( viewingGroup, layerSize, ranks.data(), owners );
+        layers.grids[l].reset
+        ( new Grid( g.ViewingComm(), owners, layerHeight ) );
+        mpi::Free( owners );
+    }
+    mpi::Free( viewingGroup );
+
+    // Corresponding processes of the layers share their VC rank modulo the
+    // layer size
+    mpi::Split
+    ( g.VCComm(), g.VCRank() % layerSize, g.VCRank() / layerSize,
+      layers.depthComm );
+    return layers;
+}
+
+void ClearSUMMA25DCache()
+{ summa25DLayers.clear(); }
+
+} // namespace gemm
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -59,6 +148,8 @@ void Gemm
     const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
     if( k != 0 )
     {
+        AddProfileFlops
+        ( (IsComplex<T>::value ? 8. : 2.)*double(m)*double(n)*double(k) );
         blas::Gemm
         ( transA, transB, m, n, k,
           alpha, A.LockedBuffer(), A.LDim(),
@@ -95,8 +186,29 @@ void Gemm
   GemmAlgorithm alg )
 {
     DEBUG_CSE
+    if( alg == GEMM_DEFAULT )
+    {
+        Int tunedAlg;
+        const Int m = C.Height();
+        const Int n = C.Width();
+        const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+        // The entry may have been tuned for a nearby shape (or loaded from a
+        // file), so it is only used if it applies to this product, and the
+        // SUMMA heuristics are used otherwise
+        if( TuningParameter
+            ( gemm::TuningRoutine(orientA,orientB), TypeName<T>(), C.Grid(),
+              {m,n,k}, "algorithm", tunedAlg ) &&
+            gemm::Applicable
+            ( static_cast<GemmAlgorithm>(tunedAlg), orientA, orientB,
+              C.Grid(), k ) )
+            alg = static_cast<GemmAlgorithm>(tunedAlg);
+    }
     C *= beta;
-    if( orientA == NORMAL && orientB == NORMAL )
+    if( alg == GEMM_SUMMA_25D )
+    {
+        gemm::SUMMA25D( orientA, orientB, alpha, A, B, C );
+    }
+    else if( orientA == NORMAL && orientB == NORMAL )
     {
         if( alg == GEMM_CANNON )
             gemm::Cannon_NN( alpha, A, B, C );
@@ -132,6 +244,49 @@ void Gemm
     Gemm( orientA, orientB, alpha, A, B, T(0), C, alg );
 }
 
+template<typename T>
+GemmAlgorithm TuneGemm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& g, Int numReps )
+{
+    DEBUG_CSE
+    vector<GemmAlgorithm> algs;
+    for( const auto alg :
+         { GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_C, GEMM_SUMMA_DOT,
+           GEMM_CANNON, GEMM_SUMMA_25D } )
+        if( gemm::Applicable( alg, orientA, orientB, g, k ) )
+            algs.push_back( alg );
+
+    DistMatrix<T> A(g), B(g), C(g);
+    if( orientA == NORMAL )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( orientB == NORMAL )
+        Uniform( B, k, n );
+    else
+        Uniform( B, n, k );
+    Zeros( C, m, n );
+
+    GemmAlgorithm bestAlg = algs[0];
+    double bestTime = -1;
+    for( const auto alg : algs )
+    {
+        const double time = TuningTime
+        ( g, [&]() { Gemm( orientA, orientB, T(1), A, B, T(0), C, alg ); },
+          numReps );
+        if( bestTime < 0 || time < bestTime )
+        {
+            bestTime = time;
+            bestAlg = alg;
+        }
+    }
+    SetTuningParameter
+    ( gemm::TuningRoutine(orientA,orientB), TypeName<T>(), g, {m,n,k},
+      "algorithm", Int(bestAlg) );
+    return bestAlg;
+}
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -279,6 +434,9 @@ void LocalGemm
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
                    AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
+  template GemmAlgorithm TuneGemm<T> \
+  ( Orientation orientA, Orientation orientB, Int m, Int n, Int k, \
+    const Grid& g, Int numReps ); \
   template void LocalGemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
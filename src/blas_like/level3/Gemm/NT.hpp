@@ -230,8 +230,7 @@ void SUMMA_NT
     const double weightTowardsC = 2.;
     const double weightAwayFromDot = 10.;
 
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const Int blockSizeDot = GemmDotBlocksize();
 
     switch( alg )
     {
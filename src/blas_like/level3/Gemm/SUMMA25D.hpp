@@ -0,0 +1,146 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// The number of layers to use for p processes: either the requested depth
+// or, by default, the largest divisor c of p with c^3 <= p (the 3D limit)
+inline Int SUMMA25DDepth( Int p )
+{
+    const Int depth = GemmDepth();
+    if( depth > 0 )
+    {
+        if( p % depth != 0 )
+            LogicError
+            ("Gemm depth, ",depth,", does not divide the grid size, ",p);
+        return depth;
+    }
+    Int c = 1;
+    for( Int d=2; d*d*d<=p; ++d )
+        if( p % d == 0 )
+            c = d;
+    return c;
+}
+
+// The grids of the c layers of a grid, and the communicator between the
+// corresponding processes of the layers, are collective to form and so are
+// cached for each (grid,depth) pair (see ClearSUMMA25DCache)
+struct SUMMA25DLayers
+{
+    vector<unique_ptr<Grid>> grids;
+    mpi::Comm depthComm=mpi::COMM_NULL;
+
+    ~SUMMA25DLayers();
+};
+
+const SUMMA25DLayers& GetSUMMA25DLayers( const Grid& g, Int c );
+
+// 2.5D SUMMA: the p processes are split into c layers, each forming a grid of
+// p/c processes, and layer l forms the contribution of the l'th of c slices
+// of the summation dimension with a 2D SUMMA. The partial products are then
+// summed over the layers, so that each process communicates a factor of
+// sqrt(c) fewer words than with a 2D SUMMA over all p processes, at the cost
+// of c times the memory for the products.
+//
+// C := alpha op(A) op(B) + C
+template<typename T>
+void SUMMA25D
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    DEBUG_CSE
+    const Grid& g = APre.Grid();
+    const Int p = g.Size();
+    const Int c = SUMMA25DDepth( p );
+    // Layers are formed from the owners of the grid, so every member of the
+    // viewing communicator must own a portion of it
+    // (an explicit algorithm is requested so that a tuned default cannot
+    // select this routine again)
+    if( c == 1 || p != mpi::Size(g.ViewingComm()) )
+    {
+        Gemm( orientA, orientB, alpha, APre, BPre, T(1), CPre, GEMM_SUMMA_C );
+        return;
+    }
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+
+    // Each layer is a grid formed from consecutive VC ranks of g
+    const Int layerSize = p / c;
+    const Int layer = g.VCRank() / layerSize;
+    const SUMMA25DLayers& layers = GetSUMMA25DLayers( g, c );
+    const auto& layerGrids = layers.grids;
+
+    // Hand layer l its slice of the summation dimension
+    DistMatrix<T> ALayer(*layerGrids[layer]), BLayer(*layerGrids[layer]),
+                  CLayer(*layerGrids[layer]);
+    DistMatrix<T> AL(g), BL(g);
+    for( Int l=0; l<c; ++l )
+    {
+        const Range<Int> ind( (l*k)/c, ((l+1)*k)/c );
+        if( orientA == NORMAL )
+            LockedView( AL, A, ALL, ind );
+        else
+            LockedView( AL, A, ind, ALL );
+        if( orientB == NORMAL )
+            LockedView( BL, B, ind, ALL );
+        else
+            LockedView( BL, B, ALL, ind );
+        if( l == layer )
+        {
+            Copy( AL, ALayer );
+            Copy( BL, BLayer );
+        }
+        else
+        {
+            // This process only views the layer's grid
+            DistMatrix<T> ALTrans(*layerGrids[l]), BLTrans(*layerGrids[l]);
+            Copy( AL, ALTrans );
+            Copy( BL, BLTrans );
+        }
+    }
+
+    // Form the partial products with a 2D algorithm within each layer
+    Gemm( orientA, orientB, alpha, ALayer, BLayer, CLayer, GEMM_SUMMA_C );
+    ALayer.Empty();
+    BLayer.Empty();
+
+    // Sum the partial products onto the first layer. Since every layer grid
+    // has the same shape and the products are unaligned, corresponding
+    // processes of the layers own identical portions of the products.
+    Matrix<T> CLoc;
+    Copy( CLayer.LockedMatrix(), CLoc );
+    mpi::Reduce
+    ( CLoc.Buffer(), CLoc.Height()*CLoc.Width(), mpi::SUM, 0,
+      layers.depthComm );
+    if( layer == 0 )
+        Copy( CLoc, CLayer.Matrix() );
+
+    // Accumulate the sum into C
+    DistMatrix<T> CFirst(*layerGrids[0]), CSum(g);
+    if( layer != 0 )
+        CFirst.Resize( m, n );
+    Copy( layer == 0 ? CLayer : CFirst, CSum );
+    Axpy( T(1), CSum, C );
+}
+
+} // namespace gemm
+} // namespace El
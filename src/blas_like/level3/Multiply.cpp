@@ -14,369 +14,290 @@
 namespace El {
 
 namespace {
-/**
- * MultiplyCSR specialization where the CSR matrix happens to have all nonzeros = 1.
- */
+
+// Accessors for the nonzero values of a CSR matrix so that the kernels below
+// can be shared between sparse matrices, their conjugates, and graphs (whose
+// nonzeros are implicitly equal to one)
 template<typename T>
-void MultiplyCSR
-( Orientation orientation,
-  Int m, Int n,
-  T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   x,
-  T beta,
-        T*   y )
+struct CSRValues
+{
+    const T* values;
+    T operator()( Int e ) const { return values[e]; }
+};
+
+template<typename T>
+struct CSRConjValues
+{
+    const T* values;
+    T operator()( Int e ) const { return Conj(values[e]); }
+};
+
+template<typename T>
+struct CSRUnitValues
+{
+    T operator()( Int e ) const { return T(1); }
+};
+
+// The number of right-hand sides whose partial sums are simultaneously held
+// in registers during a non-transposed product
+const Int csrRHSBlocksize = 4;
+
+// A subset of the rows of a CSR matrix: either the first 'numRows' rows (when
+// 'rows' is null) or the explicit list rows[0:numRows]
+struct CSRRowSet
+{
+    Int numRows;
+    const Int* rows;
+    Int operator()( Int r ) const { return ( rows==nullptr ? r : rows[r] ); }
+};
+
+// Split the row set into contiguous chunks containing roughly equal numbers of
+// nonzeros so that threads are balanced even for highly irregular matrices.
+// 'entryOffs' is a prefix sum of the number of nonzeros in the row set.
+void BalancedRowPartition
+( Int numRows, const Int* entryOffs, Int numParts, vector<Int>& partOffs )
 {
     DEBUG_CSE
-    if( orientation == NORMAL )
+    partOffs.resize( numParts+1 );
+    const Int numEntries = entryOffs[numRows];
+    partOffs[0] = 0;
+    for( Int p=1; p<numParts; ++p )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
+        const Int target = (numEntries*p) / numParts;
+        const Int r =
+          std::lower_bound( entryOffs, entryOffs+numRows+1, target ) -
+          entryOffs;
+        partOffs[p] = Max( partOffs[p-1], Min(r,numRows) );
     }
-    else
+    partOffs[numParts] = numRows;
+}
+
+// Decide upon the number of threads to split the row set over and form the
+// corresponding partition
+template<typename T>
+Int PartitionRowSet
+( const CSRRowSet& rowSet, const Int* rowOffsets, vector<Int>& partOffs )
+{
+    DEBUG_CSE
+    const Int numRows = rowSet.numRows;
+    vector<Int> entryOffsList;
+    const Int* entryOffs = rowOffsets;
+    if( rowSet.rows != nullptr )
     {
-        for( Int j=0; j<n; ++j ){
-            y[j] *= beta;
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*x[i];         
-            }
-	}
+        entryOffsList.resize( numRows+1 );
+        entryOffsList[0] = 0;
+        for( Int r=0; r<numRows; ++r )
+        {
+            const Int i = rowSet.rows[r];
+            entryOffsList[r+1] =
+              entryOffsList[r] + (rowOffsets[i+1]-rowOffsets[i]);
+        }
+        entryOffs = entryOffsList.data();
     }
+
+    // Types such as BigFloat rely upon global state and are not threaded,
+    // and tiny products are not worth the overhead of a parallel region
+    const Int minEntriesPerThread = 4096;
+    Int numParts = 1;
+    if( IsPacked<T>::value )
+        numParts =
+          Max( Min( Int(MaxThreads()), entryOffs[numRows]/minEntriesPerThread ),
+               Int(1) );
+    BalancedRowPartition( numRows, entryOffs, numParts, partOffs );
+    return numParts;
 }
 
-template<typename T,typename=DisableIf<IsBlasScalar<T>>>
-void MultiplyCSR
-( Orientation orientation,
-  Int m, Int n,
+// Y(rows,:) := alpha A(rows,:) X + beta Y(rows,:), where entry (i,k) of X
+// lives at X[i*XRowStride+k*XColStride] (and likewise for Y). Both
+// column-major and interleaved (row-major) multivectors are thus supported by
+// one kernel.
+template<typename T,typename ValueAccessor>
+void MultiplyCSRNormal
+( const CSRRowSet& rowSet, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const T*   values,
-  const T*   x,
+  const ValueAccessor& value,
+  const T* X, Int XRowStride, Int XColStride,
   T beta,
-        T*   y )
+        T* Y, Int YRowStride, Int YColStride )
 {
     DEBUG_CSE
-    if( orientation == NORMAL )
+    vector<Int> partOffs;
+    const Int numParts = PartitionRowSet<T>( rowSet, rowOffsets, partOffs );
+
+    EL_PARALLEL_FOR
+    for( Int part=0; part<numParts; ++part )
     {
-        for( Int i=0; i<m; ++i )
+        T sums[csrRHSBlocksize];
+        for( Int r=partOffs[part]; r<partOffs[part+1]; ++r )
         {
-            T sum = 0;
+            const Int i = rowSet(r);
             const Int eStart = rowOffsets[i];
             const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
+            for( Int kOff=0; kOff<numRHS; kOff+=csrRHSBlocksize )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
+                const Int kb = Min(csrRHSBlocksize,numRHS-kOff);
+                for( Int t=0; t<kb; ++t )
+                    sums[t] = 0;
                 for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
+                {
+                    const T A_ij = value(e);
+                    const T* XRow =
+                      &X[colIndices[e]*XRowStride+kOff*XColStride];
+                    for( Int t=0; t<kb; ++t )
+                        sums[t] += A_ij*XRow[t*XColStride];
+                }
+                T* YRow = &Y[i*YRowStride+kOff*YColStride];
+                for( Int t=0; t<kb; ++t )
+                    YRow[t*YColStride] =
+                      alpha*sums[t] + beta*YRow[t*YColStride];
             }
         }
     }
 }
 
-template<typename T,typename=EnableIf<IsBlasScalar<T>>,typename=void>
-void MultiplyCSR
-( Orientation orientation,
-  Int m, Int n,
+// Y := alpha op(A(rows,:)) X(rows,:) + beta Y, where op(A) is either A^T or A^H
+// (as decided by the value accessor). Each thread scatters the updates from
+// its own block of rows into a private accumulation buffer so that no two
+// threads ever write to the same location; the buffers are then summed into Y.
+template<typename T,typename ValueAccessor>
+void MultiplyCSRTrans
+( const CSRRowSet& rowSet, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const T*   values,
-  const T*   x,
+  const ValueAccessor& value,
+  const T* X, Int XRowStride, Int XColStride,
   T beta,
-        T*   y )
+        T* Y, Int YRowStride, Int YColStride )
 {
     DEBUG_CSE
-#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
-    char matDescrA[6];
-    matDescrA[0] = 'G';
-    matDescrA[3] = 'C';
-    mkl::csrmv
-    ( orientation, m, n, alpha, matDescrA, 
-      values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
-#else
-    if( orientation == NORMAL )
+    if( beta != T(1) )
+        for( Int k=0; k<numRHS; ++k )
+            for( Int j=0; j<n; ++j )
+                Y[j*YRowStride+k*YColStride] *= beta;
+
+    vector<Int> partOffs;
+    const Int numParts = PartitionRowSet<T>( rowSet, rowOffsets, partOffs );
+    if( numParts == 1 )
     {
-        for( Int i=0; i<m; ++i )
+        for( Int r=0; r<rowSet.numRows; ++r )
         {
-            T sum = 0;
+            const Int i = rowSet(r);
             const Int eStart = rowOffsets[i];
             const Int eStop = rowOffsets[i+1];
             for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
             {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
+                const T prod = alpha*value(e);
+                const Int j = colIndices[e];
+                for( Int k=0; k<numRHS; ++k )
+                    Y[j*YRowStride+k*YColStride] +=
+                      prod*X[i*XRowStride+k*XColStride];
             }
         }
-        else
+        return;
+    }
+
+    // Each part accumulates into an interleaved n x numRHS buffer
+    vector<T> updates( numParts*n*numRHS, T(0) );
+    EL_PARALLEL_FOR
+    for( Int part=0; part<numParts; ++part )
+    {
+        T* partUpdates = &updates[part*n*numRHS];
+        for( Int r=partOffs[part]; r<partOffs[part+1]; ++r )
         {
-            for( Int i=0; i<m; ++i )
+            const Int i = rowSet(r);
+            const Int eStart = rowOffsets[i];
+            const Int eStop = rowOffsets[i+1];
+            for( Int e=eStart; e<eStop; ++e )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
+                const T prod = alpha*value(e);
+                T* updateRow = &partUpdates[colIndices[e]*numRHS];
+                for( Int k=0; k<numRHS; ++k )
+                    updateRow[k] += prod*X[i*XRowStride+k*XColStride];
             }
         }
     }
-#endif
+
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+        for( Int part=0; part<numParts; ++part )
+            for( Int k=0; k<numRHS; ++k )
+                Y[j*YRowStride+k*YColStride] +=
+                  updates[(part*n+j)*numRHS+k];
 }
 
-template<typename T>
-void MultiplyCSR
+template<typename T,typename=DisableIf<IsBlasScalar<T>>>
+bool VendorMultiplyCSR
 ( Orientation orientation,
-  Int m, Int n, Int numRHS,
+  Int m, Int n,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X, Int ldX,
+  const T*   x,
   T beta,
-        T*   Y, Int ldY )
-{
-    DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-    }
-}
+        T*   y )
+{ return false; }
 
-template<typename T>
-void MultiplyCSR
+template<typename T,typename=EnableIf<IsBlasScalar<T>>,typename=void>
+bool VendorMultiplyCSR
 ( Orientation orientation,
-  Int m, Int n, Int numRHS,
+  Int m, Int n,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const T*   X, Int ldX,
+  const T*   values,
+  const T*   x,
   T beta,
-        T*   Y, Int ldY )
+        T*   y )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        for( Int k=0; k<numRHS; ++k )
-	{
-            for( Int j=0; j<n; ++j )
-	    {
-                Y[j+k*ldY] *= beta;
-            	for( Int i=0; i<m; ++i )
-            	{
-            	    const Int eStart = rowOffsets[i];
-            	    const Int eStop = rowOffsets[i+1];
-            	    for( Int e=eStart; e<eStop; ++e )
-            	    {
-            	        for( Int k=0; k<numRHS; ++k ){
-            	            Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX]; 
-			}	    
-            	    }
-            	}
-            }
-        }
-    }
+#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
+    char matDescrA[6];
+    matDescrA[0] = 'G';
+    matDescrA[3] = 'C';
+    mkl::csrmv
+    ( orientation, m, n, alpha, matDescrA, 
+      values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
+    return true;
+#else
+    return false;
+#endif
 }
 
-template<typename T>
-void MultiplyCSRInterX
+template<typename T,typename ValueAccessor,typename ConjValueAccessor>
+void MultiplyCSRStrided
 ( Orientation orientation,
-  Int m, Int n, Int numRHS,
+  const CSRRowSet& rowSet, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const T*   values,
-  const T*   X,
+  const ValueAccessor& value,
+  const ConjValueAccessor& conjValue,
+  const T* X, Int XRowStride, Int XColStride,
   T beta,
-        T*   Y, Int ldY )
+        T* Y, Int YRowStride, Int YColStride )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
     if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
+        MultiplyCSRNormal
+        ( rowSet, numRHS, alpha, rowOffsets, colIndices, value,
+          X, XRowStride, XColStride, beta, Y, YRowStride, YColStride );
+    else if( orientation == TRANSPOSE )
+        MultiplyCSRTrans
+        ( rowSet, n, numRHS, alpha, rowOffsets, colIndices, value,
+          X, XRowStride, XColStride, beta, Y, YRowStride, YColStride );
     else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
-                }
-            }
-        }
-    }
+        MultiplyCSRTrans
+        ( rowSet, n, numRHS, alpha, rowOffsets, colIndices, conjValue,
+          X, XRowStride, XColStride, beta, Y, YRowStride, YColStride );
 }
 
+// Y := alpha op(A) X + beta Y, with X and Y stored in column-major order
 template<typename T>
-void MultiplyCSRInterY
+void MultiplyCSR
 ( Orientation orientation,
   Int m, Int n, Int numRHS,
   T alpha,
@@ -385,140 +306,39 @@ void MultiplyCSRInterY
   const T*   values,
   const T*   X, Int ldX,
   T beta,
-        T*   Y )
+        T*   Y, Int ldY )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
+    if( numRHS == 1 &&
+        VendorMultiplyCSR
+        ( orientation, m, n, alpha,
+          rowOffsets, colIndices, values, X, beta, Y ) )
         return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-    }
+    MultiplyCSRStrided
+    ( orientation, CSRRowSet{m,nullptr}, n, numRHS, alpha,
+      rowOffsets, colIndices,
+      CSRValues<T>{values}, CSRConjValues<T>{values},
+      X, 1, ldX, beta, Y, 1, ldY );
 }
 
+// The same as above, but for a graph (i.e., a matrix of ones)
 template<typename T>
-void MultiplyCSRInter
+void MultiplyCSR
 ( Orientation orientation,
   Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const T*   values,
-  const T*   X,
+  const T*   X, Int ldX,
   T beta,
-        T*   Y )
+        T*   Y, Int ldY )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            for( Int k=0; k<numRHS; ++k )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k]; 
-                }
-            }
-        }
-    }
+    MultiplyCSRStrided
+    ( orientation, CSRRowSet{m,nullptr}, n, numRHS, alpha,
+      rowOffsets, colIndices,
+      CSRUnitValues<T>(), CSRUnitValues<T>(),
+      X, 1, ldX, beta, Y, 1, ldY );
 }
 
 } // anonymous namespace
@@ -586,7 +406,6 @@ void Multiply
     mpi::Comm comm = A.Comm();
     const int commSize = mpi::Size( comm );
     const int commRank = mpi::Rank( comm );
-    // TODO: Use sequential implementation if commSize = 1?
 
     Timer totalTimer, timer;
     if( time && commRank == 0 )
@@ -611,6 +430,17 @@ void Multiply
         sendOffs[q] *= b;
     }
 
+    // The multiplication is split into two phases using the halo-exchange
+    // plan: the rows whose columns are all locally owned are processed while
+    // the point-to-point messages for the ghost entries are in flight
+    const CSRRowSet localRowSet{ Int(meta.localRows.size()),
+                                 meta.localRows.data() };
+    const CSRRowSet ghostRowSet{ Int(meta.ghostRows.size()),
+                                 meta.ghostRows.data() };
+    const Int numNeighbors = meta.sendRanks.size() + meta.recvRanks.size();
+    vector<mpi::Request<T>> requests( numNeighbors );
+    const Int numSendInds = meta.sendInds.size();
+
     if( orientation == NORMAL )
     {
         if( A.Height() != Y.Height() )
@@ -619,7 +449,6 @@ void Multiply
             LogicError("The width of A must match the height of X");
 
         // Pack the send values
-        const Int numSendInds = meta.sendInds.size();
         const Int firstLocalRow = X.FirstLocalRow();
         vector<T> sendVals;
         FastResize( sendVals, numSendInds*b );
@@ -633,24 +462,50 @@ void Multiply
                 sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
         }
 
-        // Now send them
+        // Start exchanging the ghost entries
         vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
-     
-        // Perform the local multiply-accumulate, y := alpha A x + y
+        Int requestInd = 0;
+        for( const int& q : meta.recvRanks )
+            mpi::IRecv
+            ( &recvVals[recvOffs[q]], recvSizes[q], q, comm,
+              requests[requestInd++] );
+        for( const int& q : meta.sendRanks )
+            mpi::ISend
+            ( &sendVals[sendOffs[q]], sendSizes[q], q, comm,
+              requests[requestInd++] );
+        std::copy
+        ( sendVals.begin()+sendOffs[commRank],
+          sendVals.begin()+sendOffs[commRank]+sendSizes[commRank],
+          recvVals.begin()+recvOffs[commRank] );
+
+        // Perform the local multiply-accumulate, y := alpha A x + y, starting
+        // with the rows which do not depend upon ghost entries
+        if( time && commRank == 0 )
+            timer.Start();
+        MultiplyCSRStrided
+        ( NORMAL, localRowSet, meta.numRecvInds, b,
+          alpha, A.LockedOffsetBuffer(),
+                 meta.colOffs.data(),
+                 CSRValues<T>{A.LockedValueBuffer()},
+                 CSRConjValues<T>{A.LockedValueBuffer()},
+                 recvVals.data(), b, 1,
+          T(1),  Y.Matrix().Buffer(), 1, Y.Matrix().LDim() );
+        if( time && commRank == 0 )
+            Output("  Local rows time: ",timer.Stop());
+
+        mpi::WaitAll( numNeighbors, requests.data() );
         if( time && commRank == 0 )
             timer.Start();
-        MultiplyCSRInterX
-        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(), 
+        MultiplyCSRStrided
+        ( NORMAL, ghostRowSet, meta.numRecvInds, b,
+          alpha, A.LockedOffsetBuffer(),
                  meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 recvVals.data(), 
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
+                 CSRValues<T>{A.LockedValueBuffer()},
+                 CSRConjValues<T>{A.LockedValueBuffer()},
+                 recvVals.data(), b, 1,
+          T(1),  Y.Matrix().Buffer(), 1, Y.Matrix().LDim() );
         if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+            Output("  Ghost rows time: ",timer.Stop());
     }
     else
     {
@@ -659,38 +514,76 @@ void Multiply
         if( A.Height() != X.Height() )
             LogicError("The height of A must match the height of X");
 
-        // Form and pack the updates to Y
+        // Form and pack the updates to Y from the rows which touch ghost
+        // entries so that they can be sent as early as possible
         if( time && commRank == 0 )
             timer.Start();
-        vector<T> sendVals( meta.numRecvInds*b, 0 );
-        MultiplyCSRInterY
-        ( orientation, A.LocalHeight(), meta.numRecvInds, b,
+        const T* XBuffer = X.LockedMatrix().LockedBuffer();
+        const Int ldX = X.LockedMatrix().LDim();
+        vector<T> sendVals( meta.numRecvInds*b, T(0) );
+        MultiplyCSRStrided
+        ( orientation, ghostRowSet, meta.numRecvInds, b,
           alpha, A.LockedOffsetBuffer(),
                  meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
-          T(1),  sendVals.data() );
+                 CSRValues<T>{A.LockedValueBuffer()},
+                 CSRConjValues<T>{A.LockedValueBuffer()},
+                 XBuffer, 1, ldX,
+          T(1),  sendVals.data(), b, 1 );
         if( time && commRank == 0 )
-            Output("  MultiplyCSRInterY time: ",timer.Stop());
+            Output("  Ghost rows time: ",timer.Stop());
 
         // Inject the updates to Y into the network
-        const Int numRecvInds = meta.sendInds.size();
         vector<T> recvVals;
-        FastResize( recvVals, numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), recvSizes.data(), recvOffs.data(),
-          recvVals.data(), sendSizes.data(), sendOffs.data(), comm );
-     
-        // Accumulate the received indices onto Y
+        FastResize( recvVals, numSendInds*b );
+        Int requestInd = 0;
+        for( const int& q : meta.sendRanks )
+            mpi::IRecv
+            ( &recvVals[sendOffs[q]], sendSizes[q], q, comm,
+              requests[requestInd++] );
+        for( const int& q : meta.recvRanks )
+            mpi::ISend
+            ( &sendVals[recvOffs[q]], recvSizes[q], q, comm,
+              requests[requestInd++] );
+
+        // The remaining rows only update locally-owned entries of Y. They are
+        // accumulated into a separate buffer so that the send buffer is left
+        // untouched while it is in flight.
+        if( time && commRank == 0 )
+            timer.Start();
+        vector<T> localVals( meta.numRecvInds*b, T(0) );
+        MultiplyCSRStrided
+        ( orientation, localRowSet, meta.numRecvInds, b,
+          alpha, A.LockedOffsetBuffer(),
+                 meta.colOffs.data(),
+                 CSRValues<T>{A.LockedValueBuffer()},
+                 CSRConjValues<T>{A.LockedValueBuffer()},
+                 XBuffer, 1, ldX,
+          T(1),  localVals.data(), b, 1 );
+        if( time && commRank == 0 )
+            Output("  Local rows time: ",timer.Stop());
+
+        // Accumulate the locally-owned updates onto Y
         const Int firstLocalRow = Y.FirstLocalRow();
         T* YBuffer = Y.Matrix().Buffer(); 
         const Int ldY = Y.Matrix().LDim();
-        for( Int s=0; s<numRecvInds; ++s )
+        for( Int t=0; t<sendSizes[commRank]; ++t )
         {
-            const Int i = meta.sendInds[s];
+            const Int i = meta.sendInds[(sendOffs[commRank]+t)/b];
             const Int iLoc = i - firstLocalRow;
-            for( Int t=0; t<b; ++t )
-                YBuffer[iLoc+t*ldY] += recvVals[s*b+t];
+            const Int recvInd = recvOffs[commRank] + t;
+            YBuffer[iLoc+(t%b)*ldY] += sendVals[recvInd] + localVals[recvInd];
+        }
+
+        // Accumulate the received updates onto Y
+        mpi::WaitAll( numNeighbors, requests.data() );
+        for( const int& q : meta.sendRanks )
+        {
+            for( Int t=sendOffs[q]; t<sendOffs[q]+sendSizes[q]; ++t )
+            {
+                const Int i = meta.sendInds[t/b];
+                const Int iLoc = i - firstLocalRow;
+                YBuffer[iLoc+(t%b)*ldY] += recvVals[t];
+            }
         }
     }
     if( time && commRank == 0 )
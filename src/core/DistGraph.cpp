@@ -748,6 +748,42 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
       meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(),
       comm );
 
+    // Build the halo-exchange plan
+    meta.sendRanks.clear();
+    meta.recvRanks.clear();
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank_ )
+            continue;
+        if( meta.sendSizes[q] > 0 )
+            meta.sendRanks.push_back( q );
+        if( meta.recvSizes[q] > 0 )
+            meta.recvRanks.push_back( q );
+    }
+    const Int localRecvBeg = meta.recvOffs[commRank_];
+    const Int localRecvEnd = localRecvBeg + meta.recvSizes[commRank_];
+    const Int* offsetBuf = LockedOffsetBuffer();
+    const Int numLocalSources = NumLocalSources();
+    meta.localRows.clear();
+    meta.ghostRows.clear();
+    for( Int iLoc=0; iLoc<numLocalSources; ++iLoc )
+    {
+        bool local = true;
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+        {
+            if( meta.colOffs[e] < localRecvBeg ||
+                meta.colOffs[e] >= localRecvEnd )
+            {
+                local = false;
+                break;
+            }
+        }
+        if( local )
+            meta.localRows.push_back( iLoc );
+        else
+            meta.ghostRows.push_back( iLoc );
+    }
+
     meta.numRecvInds = numRecvInds;
     meta.ready = true;
 
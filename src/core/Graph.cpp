@@ -117,6 +117,7 @@ void Graph::Empty( bool clearMemory )
     numTargets_ = 0;
     consistent_ = true;
     frozenSparsity_ = false;
+    compressed_ = false;
     if( clearMemory )
     {
         SwapClear( sources_ );
@@ -157,6 +158,8 @@ void Graph::Resize( Int numSources, Int numTargets )
 // --------
 void Graph::Reserve( Int numEdges )
 { 
+    if( compressed_ )
+        ExpandSources();
     const Int currSize = sources_.size();
     sources_.reserve( currSize+numEdges );
     targets_.reserve( currSize+numEdges );
@@ -180,6 +183,25 @@ void Graph::FreezeSparsity() EL_NO_EXCEPT { frozenSparsity_ = true; }
 void Graph::UnfreezeSparsity() EL_NO_EXCEPT { frozenSparsity_ = false; }
 bool Graph::FrozenSparsity() const EL_NO_EXCEPT { return frozenSparsity_; }
 
+void Graph::CompressStorage()
+{
+    DEBUG_CSE
+    ProcessQueues();
+    compressed_ = true;
+    SwapClear( sources_ );
+}
+
+void Graph::UncompressStorage()
+{
+    DEBUG_CSE
+    if( !compressed_ )
+        return;
+    ExpandSources();
+    compressed_ = false;
+}
+
+bool Graph::CompressedStorage() const EL_NO_EXCEPT { return compressed_; }
+
 void Graph::QueueConnection( Int source, Int target )
 {
     DEBUG_CSE
@@ -199,6 +221,8 @@ void Graph::QueueConnection( Int source, Int target )
     )
     if( !FrozenSparsity() )
     {
+        if( compressed_ )
+            ExpandSources();
         sources_.push_back( source );
         targets_.push_back( target );
         consistent_ = false;
@@ -212,7 +236,9 @@ void Graph::QueueDisconnection( Int source, Int target )
     if( target == END ) target = numTargets_ - 1;
     if( !FrozenSparsity() )
     {
-        markedForRemoval_.insert( pair<Int,Int>(source,target) );
+        if( compressed_ )
+            ExpandSources();
+        markedForRemoval_.emplace_back( source, target );
         consistent_ = false;
     }
 }
@@ -221,54 +247,68 @@ void Graph::ProcessQueues()
 {
     DEBUG_CSE
     DEBUG_ONLY(
-      if( sources_.size() != targets_.size() )
+      if( !compressed_ && sources_.size() != targets_.size() )
           LogicError("Inconsistent graph buffer sizes");
     )
     if( consistent_ )
         return;
+    if( compressed_ )
+        ExpandSources();
 
-    Int numRemoved=0;
-    const Int numEdges = sources_.size();
-    vector<pair<Int,Int>> pairs( numEdges );
-    if( markedForRemoval_.size() != 0 )
-    {
-        for( Int e=0; e<numEdges; ++e )
-        {
-            pair<Int,Int> candidate(sources_[e],targets_[e]);
-            if( markedForRemoval_.find(candidate) == markedForRemoval_.end() )
-                pairs[e-numRemoved] = candidate;
-            else
-                ++numRemoved;
-        }
-        markedForRemoval_.clear();
-        pairs.resize( numEdges-numRemoved );
-    }
-    else
-    {
-        for( Int e=0; e<numEdges; ++e )
-            pairs[e] = pair<Int,Int>{sources_[e],targets_[e]};
-    }
-    std::sort( pairs.begin(), pairs.end() );
-    const Int numSorted = pairs.size();
-
-    // Compress out duplicates
-    Int lastUnique=0;
-    for( Int e=1; e<numSorted; ++e )
-        if( pairs[e] != pairs[lastUnique] )
-            pairs[++lastUnique] = pairs[e];
-    const Int numUnique = lastUnique+1;
-    pairs.resize( numUnique );
-
-    sources_.resize( numUnique );
-    targets_.resize( numUnique );
+    vector<Int> order, uniqueOffsets;
+    SortQueues( order, uniqueOffsets );
+    const Int numUnique = uniqueOffsets.size()-1;
+
+    vector<Int> newSources( numUnique ), newTargets( numUnique );
+    EL_PARALLEL_FOR
     for( Int e=0; e<numUnique; ++e )
     {
-        sources_[e] = pairs[e].first;
-        targets_[e] = pairs[e].second;
+        const Int eOld = order[uniqueOffsets[e]];
+        newSources[e] = sources_[eOld];
+        newTargets[e] = targets_[eOld];
     }
+    sources_.swap( newSources );
+    targets_.swap( newTargets );
 
     ComputeSourceOffsets();
+    if( compressed_ )
+        SwapClear( sources_ );
+    consistent_ = true;
+}
+
+void Graph::SetCSR
+( Int numSources, Int numTargets,
+  const vector<Int>& sourceOffsets, const vector<Int>& targets )
+{
+    DEBUG_CSE
+    if( FrozenSparsity() )
+        LogicError("Cannot overwrite a graph with frozen sparsity");
+    if( Int(sourceOffsets.size()) != numSources+1 )
+        LogicError("Expected ",numSources+1," source offsets");
+    if( sourceOffsets[0] != 0 ||
+        sourceOffsets[numSources] != Int(targets.size()) )
+        LogicError("Source offsets were inconsistent with the targets");
+    DEBUG_ONLY(
+      for( Int s=0; s<numSources; ++s )
+          for( Int e=sourceOffsets[s]; e<sourceOffsets[s+1]; ++e )
+              if( targets[e] < 0 || targets[e] >= numTargets ||
+                  (e > sourceOffsets[s] && targets[e] <= targets[e-1]) )
+                  LogicError("Targets of source ",s," were not sorted");
+    )
+    numSources_ = numSources;
+    numTargets_ = numTargets;
+    markedForRemoval_.clear();
+
+    targets_ = targets;
+    sourceOffsets_ = sourceOffsets;
     consistent_ = true;
+    if( compressed_ )
+        SwapClear( sources_ );
+    else
+    {
+        sources_.clear();
+        ExpandSources();
+    }
 }
 
 // Queries
@@ -280,12 +320,14 @@ Int Graph::NumTargets() const EL_NO_EXCEPT { return numTargets_; }
 Int Graph::NumEdges() const EL_NO_EXCEPT
 {
     DEBUG_CSE
-    return sources_.size();
+    return targets_.size();
 }
 
 Int Graph::Capacity() const EL_NO_EXCEPT
 {
     DEBUG_CSE
+    if( compressed_ )
+        return targets_.capacity();
     return Min(sources_.capacity(),targets_.capacity());
 }
 
@@ -295,9 +337,16 @@ Int Graph::Source( Int edge ) const EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     DEBUG_ONLY(
-      if( edge < 0 || edge >= (Int)sources_.size() )
+      if( edge < 0 || edge >= (Int)targets_.size() )
           LogicError("Edge number out of bounds");
     )
+    if( sources_.size() != targets_.size() )
+    {
+        // Find the last source whose offset does not exceed the edge
+        auto it = std::upper_bound
+          ( sourceOffsets_.cbegin(), sourceOffsets_.cend(), edge );
+        return (it-sourceOffsets_.cbegin()) - 1;
+    }
     return sources_[edge];
 }
 
@@ -359,14 +408,21 @@ Int Graph::NumConnections( Int source ) const EL_NO_RELEASE_EXCEPT
     return SourceOffset(source+1) - SourceOffset(source);
 }
 
-Int* Graph::SourceBuffer() EL_NO_EXCEPT { return sources_.data(); }
+Int* Graph::SourceBuffer()
+{
+    UncompressStorage();
+    return sources_.data();
+}
 Int* Graph::TargetBuffer() EL_NO_EXCEPT { return targets_.data(); }
 Int* Graph::OffsetBuffer() EL_NO_EXCEPT { return sourceOffsets_.data(); }
 
 void Graph::ForceNumEdges( Int numEdges )
 {
     DEBUG_CSE
-    sources_.resize( numEdges ); 
+    if( compressed_ )
+        SwapClear( sources_ );
+    else
+        sources_.resize( numEdges );
     targets_.resize( numEdges );
     consistent_ = false;
 }
@@ -374,8 +430,16 @@ void Graph::ForceNumEdges( Int numEdges )
 void Graph::ForceConsistency( bool consistent ) EL_NO_EXCEPT
 { consistent_ = consistent; }
 
-const Int* Graph::LockedSourceBuffer() const EL_NO_EXCEPT
-{ return sources_.data(); }
+const Int* Graph::LockedSourceBuffer() const
+{
+    // Materializing the sources here would make concurrent const readers race
+    // and would silently undo the compression
+    if( sources_.size() != targets_.size() )
+        LogicError
+        ("The sources of a graph with compressed storage are not stored; "
+         "call UncompressStorage() or use SourceOffset()");
+    return sources_.data();
+}
 const Int* Graph::LockedTargetBuffer() const EL_NO_EXCEPT
 { return targets_.data(); }
 const Int* Graph::LockedOffsetBuffer() const EL_NO_EXCEPT
@@ -384,6 +448,109 @@ const Int* Graph::LockedOffsetBuffer() const EL_NO_EXCEPT
 // Auxiliary functions
 // ===================
 
+namespace {
+
+// A stable counting sort of the indices 'in' by the keys keys[in[k]], which
+// lie in [0,numKeys). Contiguous chunks of the input are counted and
+// scattered in parallel, each with its own histogram; the number of chunks is
+// limited so that the histograms never outweigh the input.
+void CountingSort
+( const vector<Int>& keys, Int numKeys,
+  const vector<Int>& in, vector<Int>& out )
+{
+    DEBUG_CSE
+    const Int n = in.size();
+    const Int numChunks =
+      Max(Min(Int(MaxThreads()),n/Max(numKeys,Int(1))),Int(1));
+    const Int chunkSize = (n+numChunks-1) / numChunks;
+
+    vector<Int> offsets( numChunks*numKeys, 0 );
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numChunks; ++c )
+    {
+        Int* chunkOffsets = &offsets[c*numKeys];
+        const Int kEnd = Min(n,(c+1)*chunkSize);
+        for( Int k=c*chunkSize; k<kEnd; ++k )
+            ++chunkOffsets[keys[in[k]]];
+    }
+
+    // Convert the counts into offsets ordered by key and then by chunk
+    Int offset = 0;
+    for( Int key=0; key<numKeys; ++key )
+    {
+        for( Int c=0; c<numChunks; ++c )
+        {
+            const Int count = offsets[c*numKeys+key];
+            offsets[c*numKeys+key] = offset;
+            offset += count;
+        }
+    }
+
+    out.resize( n );
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numChunks; ++c )
+    {
+        Int* chunkOffsets = &offsets[c*numKeys];
+        const Int kEnd = Min(n,(c+1)*chunkSize);
+        for( Int k=c*chunkSize; k<kEnd; ++k )
+            out[chunkOffsets[keys[in[k]]]++] = in[k];
+    }
+}
+
+} // anonymous namespace
+
+void Graph::SortQueues( vector<Int>& order, vector<Int>& uniqueOffsets )
+{
+    DEBUG_CSE
+    const Int numEdges = sources_.size();
+    DEBUG_ONLY(
+      for( Int e=0; e<numEdges; ++e )
+          if( sources_[e] < 0 || sources_[e] >= numSources_ ||
+              targets_[e] < 0 || targets_[e] >= numTargets_ )
+              LogicError
+              ("Edge (",sources_[e],",",targets_[e],") was out of bounds");
+    )
+
+    // A least-significant-digit radix sort: a stable sort by target followed
+    // by a stable sort by source, for a total cost linear in the number of
+    // edges and vertices
+    {
+        vector<Int> identity( numEdges ), byTarget;
+        EL_PARALLEL_FOR
+        for( Int e=0; e<numEdges; ++e )
+            identity[e] = e;
+        CountingSort( targets_, numTargets_, identity, byTarget );
+        SwapClear( identity );
+        CountingSort( sources_, numSources_, byTarget, order );
+    }
+
+    // Drop the edges marked for removal by walking through them in the same
+    // order, and mark the start of each run of duplicates
+    std::sort( markedForRemoval_.begin(), markedForRemoval_.end() );
+    auto removal = markedForRemoval_.cbegin();
+    const auto removalEnd = markedForRemoval_.cend();
+    Int numKept = 0;
+    uniqueOffsets.resize( 0 );
+    for( Int k=0; k<numEdges; ++k )
+    {
+        const Int e = order[k];
+        const pair<Int,Int> edge( sources_[e], targets_[e] );
+        while( removal != removalEnd && *removal < edge )
+            ++removal;
+        if( removal != removalEnd && *removal == edge )
+            continue;
+        if( numKept == 0 ||
+            edge.first != sources_[order[numKept-1]] ||
+            edge.second != targets_[order[numKept-1]] )
+            uniqueOffsets.push_back( numKept );
+        order[numKept++] = e;
+    }
+    order.resize( numKept );
+    uniqueOffsets.push_back( numKept );
+    SwapClear( markedForRemoval_ );
+}
+
+
 void Graph::ComputeSourceOffsets()
 {
     DEBUG_CSE
@@ -391,10 +558,9 @@ void Graph::ComputeSourceOffsets()
     Int prevSource = -1;
     sourceOffsets_.resize( numSources_+1 );
     const Int numEdges = NumEdges();
-    const Int* sourceBuf = LockedSourceBuffer();
     for( Int e=0; e<numEdges; ++e )
     {
-        const Int source = sourceBuf[e];
+        const Int source = sources_[e];
         DEBUG_ONLY(
           if( source < prevSource )
               RuntimeError("sources were not properly sorted");
@@ -406,6 +572,19 @@ void Graph::ComputeSourceOffsets()
         sourceOffsets_[sourceOffset] = numEdges;
 }
 
+void Graph::ExpandSources()
+{
+    DEBUG_CSE
+    const Int numEdges = targets_.size();
+    if( Int(sources_.size()) == numEdges )
+        return;
+    sources_.resize( numEdges );
+    EL_PARALLEL_FOR
+    for( Int s=0; s<numSources_; ++s )
+        for( Int e=sourceOffsets_[s]; e<sourceOffsets_[s+1]; ++e )
+            sources_[e] = s;
+}
+
 void Graph::AssertConsistent() const
 { 
     if( !consistent_ )
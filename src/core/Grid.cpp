@@ -12,6 +12,7 @@
 namespace El {
 
 Grid* Grid::defaultGrid = 0;
+size_t Grid::numGrids = 0;
 
 void Grid::InitializeDefault()
 {
@@ -88,6 +89,7 @@ void Grid::SetUpGrid()
     if( size_ % height_ != 0 )
         LogicError
         ("Grid height, ",height_,", does not evenly divide grid size, ",size_);
+    guid_ = numGrids++;
     owningRank_ = mpi::Rank( owningGroup_ );
     viewingRank_ = mpi::Rank( viewingComm_ );
     inGrid_ = ( owningRank_ != mpi::UNDEFINED );
@@ -260,6 +262,8 @@ int Grid::Rank()   const EL_NO_RELEASE_EXCEPT { return OwningRank(); }
 
 GridOrder Grid::Order() const EL_NO_EXCEPT { return order_; }
 
+size_t Grid::GUID() const EL_NO_EXCEPT { return guid_; }
+
 int Grid::Row() const EL_NO_RELEASE_EXCEPT { return MCRank(); }
 int Grid::Col() const EL_NO_RELEASE_EXCEPT { return MRRank(); }
 mpi::Comm Grid::ColComm() const EL_NO_EXCEPT { return MCComm(); }
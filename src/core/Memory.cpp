@@ -0,0 +1,225 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#ifdef EL_HAVE_MMAP
+# include <sys/mman.h>
+#endif
+
+namespace {
+using namespace El;
+using El::memory::ALIGNMENT;
+using El::memory::HUGE_PAGE_SIZE;
+
+// Over-allocate in order to align the buffer, storing the original pointer
+// directly before the aligned buffer
+void* AlignedAllocate( size_t numBytes, size_t alignment )
+{
+    void* rawPtr = std::malloc( numBytes+alignment );
+    if( rawPtr == nullptr )
+        throw std::bad_alloc();
+    const std::uintptr_t rawAddress = reinterpret_cast<std::uintptr_t>(rawPtr);
+    const std::uintptr_t address = (rawAddress+alignment) & ~(alignment-1);
+    void* ptr = reinterpret_cast<void*>(address);
+    static_cast<void**>(ptr)[-1] = rawPtr;
+    return ptr;
+}
+
+void AlignedDeallocate( void* ptr )
+{ std::free( static_cast<void**>(ptr)[-1] ); }
+
+bool hugePages = false;
+
+void* DefaultAllocate( size_t numBytes )
+{
+    if( hugePages && numBytes >= HUGE_PAGE_SIZE )
+    {
+        void* ptr = AlignedAllocate( numBytes, HUGE_PAGE_SIZE );
+#if defined(EL_HAVE_MMAP) && defined(MADV_HUGEPAGE)
+        // This is only advice, so failure is not an error
+        madvise( ptr, numBytes, MADV_HUGEPAGE );
+#endif
+        return ptr;
+    }
+    return AlignedAllocate( numBytes, ALIGNMENT );
+}
+
+void DefaultDeallocate( void* ptr, size_t numBytes )
+{ AlignedDeallocate( ptr ); }
+
+// Round small requests up to a multiple of the alignment and larger requests
+// up to a multiple of a quarter of the next smaller power of two (so that at
+// most 25% of a buffer is wasted)
+size_t SizeClass( size_t numBytes )
+{
+    if( numBytes <= 4*ALIGNMENT )
+        return Max(((numBytes+ALIGNMENT-1)/ALIGNMENT)*ALIGNMENT,ALIGNMENT);
+    size_t power = 4*ALIGNMENT;
+    while( 2*power < numBytes )
+        power *= 2;
+    const size_t step = power/4;
+    return ((numBytes+step-1)/step)*step;
+}
+
+struct Pool
+{
+    std::mutex mutex;
+    std::unordered_map<size_t,vector<void*>> buffers;
+    bool pooling = true;
+    size_t limit = size_t(256)*1024*1024;
+    memory::AllocateFunction allocate = DefaultAllocate;
+    memory::DeallocateFunction deallocate = DefaultDeallocate;
+    memory::Statistics stats;
+
+    void ReleaseBuffers()
+    {
+        for( auto& entry : buffers )
+        {
+            for( void* ptr : entry.second )
+                deallocate( ptr, entry.first );
+            stats.pooledBytes -= entry.first*entry.second.size();
+        }
+        buffers.clear();
+    }
+};
+
+// The pool is intentionally never destroyed so that Memory objects with static
+// storage duration may safely be freed at exit
+Pool& ThePool()
+{
+    static Pool* pool = new Pool;
+    return *pool;
+}
+
+} // anonymous namespace
+
+namespace El {
+namespace memory {
+
+void* Allocate( size_t numBytes )
+{
+    const size_t sizeClass = SizeClass( numBytes );
+    Pool& pool = ThePool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+
+    void* ptr = nullptr;
+    auto it = pool.buffers.find( sizeClass );
+    if( it != pool.buffers.end() && !it->second.empty() )
+    {
+        ptr = it->second.back();
+        it->second.pop_back();
+        pool.stats.pooledBytes -= sizeClass;
+        pool.stats.reusedBytes += sizeClass;
+        ++pool.stats.numReuses;
+    }
+    else
+    {
+        ptr = pool.allocate( sizeClass );
+        pool.stats.systemBytes += sizeClass;
+    }
+    ++pool.stats.numAllocations;
+    pool.stats.liveBytes += sizeClass;
+    pool.stats.peakBytes = Max(pool.stats.peakBytes,pool.stats.liveBytes);
+    return ptr;
+}
+
+void Deallocate( void* ptr, size_t numBytes ) EL_NO_EXCEPT
+{
+    if( ptr == nullptr )
+        return;
+    const size_t sizeClass = SizeClass( numBytes );
+    Pool& pool = ThePool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+
+    pool.stats.liveBytes -= sizeClass;
+    if( pool.pooling && pool.stats.pooledBytes+sizeClass <= pool.limit )
+    {
+        pool.buffers[sizeClass].push_back( ptr );
+        pool.stats.pooledBytes += sizeClass;
+    }
+    else
+        pool.deallocate( ptr, sizeClass );
+}
+
+void SetPooling( bool pooling )
+{
+    Pool& pool = ThePool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    pool.pooling = pooling;
+    if( !pooling )
+        pool.ReleaseBuffers();
+}
+
+bool Pooling()
+{ return ThePool().pooling; }
+
+void SetPoolLimit( size_t numBytes )
+{
+    Pool& pool = ThePool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    pool.limit = numBytes;
+    if( pool.stats.pooledBytes > numBytes )
+        pool.ReleaseBuffers();
+}
+
+size_t PoolLimit()
+{ return ThePool().limit; }
+
+void SetHugePages( bool usingHugePages )
+{ ::hugePages = usingHugePages; }
+
+bool HugePages()
+{ return ::hugePages; }
+
+void ReleasePool()
+{
+    Pool& pool = ThePool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    pool.ReleaseBuffers();
+}
+
+void SetSystemAllocator
+( AllocateFunction allocate, DeallocateFunction deallocate )
+{
+    Pool& pool = ThePool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    // Cached buffers must be returned to the allocator which produced them
+    pool.ReleaseBuffers();
+    pool.allocate = allocate;
+    pool.deallocate = deallocate;
+}
+
+void ResetSystemAllocator()
+{ SetSystemAllocator( DefaultAllocate, DefaultDeallocate ); }
+
+Statistics GetStatistics()
+{
+    Pool& pool = ThePool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    return pool.stats;
+}
+
+void ResetStatistics()
+{
+    Pool& pool = ThePool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    const size_t liveBytes = pool.stats.liveBytes;
+    const size_t pooledBytes = pool.stats.pooledBytes;
+    pool.stats = Statistics();
+    pool.stats.liveBytes = liveBytes;
+    pool.stats.peakBytes = liveBytes;
+    pool.stats.pooledBytes = pooledBytes;
+}
+
+} // namespace memory
+} // namespace El
@@ -0,0 +1,313 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <tuple>
+
+namespace {
+using namespace El;
+
+typedef std::tuple<string,string,string> Key;
+
+struct Value
+{
+    Int numCalls=0;
+    double bytes=0, time=0;
+};
+
+std::map<Key,Value> records;
+
+// The label of each communicator is cached as an attribute so that it is
+// released along with the communicator (and so that a handle which is reused
+// after a communicator is freed is not confused with the original)
+int labelKeyval = MPI_KEYVAL_INVALID;
+
+string reportFile;
+
+int DeleteLabel( MPI_Comm comm, int keyval, void* attr, void* extraState )
+{
+    delete static_cast<string*>(attr);
+    return MPI_SUCCESS;
+}
+
+const string& CommLabel( MPI_Comm comm )
+{
+    static const string nullLabel = "-";
+    if( comm == MPI_COMM_NULL )
+        return nullLabel;
+
+    // Use the raw MPI interface throughout so that nothing is recorded
+    if( ::labelKeyval == MPI_KEYVAL_INVALID )
+        MPI_Comm_create_keyval
+        ( MPI_COMM_NULL_COPY_FN, DeleteLabel, &::labelKeyval, nullptr );
+    void* attr;
+    int found;
+    MPI_Comm_get_attr( comm, ::labelKeyval, &attr, &found );
+    if( found )
+        return *static_cast<string*>(attr);
+
+    // Translate every rank of the communicator to a rank in COMM_WORLD
+    int size;
+    MPI_Group group, worldGroup;
+    MPI_Comm_size( comm, &size );
+    MPI_Comm_group( comm, &group );
+    MPI_Comm_group( MPI_COMM_WORLD, &worldGroup );
+    vector<int> ranks( size ), worldRanks( size );
+    for( int q=0; q<size; ++q )
+        ranks[q] = q;
+    MPI_Group_translate_ranks
+    ( group, size, ranks.data(), worldGroup, worldRanks.data() );
+    MPI_Group_free( &group );
+    MPI_Group_free( &worldGroup );
+    const int worldRoot = worldRanks[0];
+
+    // Every member computes the same label from the sorted set of world
+    // ranks (with a 32-bit FNV-1a hash of the set), without communicating.
+    // Communicators over different sets of processes thus have different
+    // labels, while duplicates of a communicator share its label.
+    std::sort( worldRanks.begin(), worldRanks.end() );
+    std::uint32_t hash = 2166136261u;
+    for( const int worldRank : worldRanks )
+        for( int b=0; b<4; ++b )
+        {
+            hash ^= std::uint32_t((unsigned(worldRank) >> (8*b)) & 0xffu);
+            hash *= 16777619u;
+        }
+    ostringstream os;
+    os << size << "@" << worldRoot << "#" << std::hex << std::setw(8)
+       << std::setfill('0') << hash;
+    string* label = new string( os.str() );
+    MPI_Comm_set_attr( comm, ::labelKeyval, label );
+    return *label;
+}
+
+void SerializeKeys( const vector<Key>& keys, string& str )
+{
+    ostringstream os;
+    for( const auto& key : keys )
+        os << std::get<0>(key) << "\t" << std::get<1>(key) << "\t"
+           << std::get<2>(key) << "\n";
+    str = os.str();
+}
+
+void DeserializeKeys( const vector<byte>& buf, vector<Key>& keys )
+{
+    std::istringstream is( string(buf.begin(),buf.end()) );
+    string op, comm, site;
+    while( std::getline( is, op, '\t' ) &&
+           std::getline( is, comm, '\t' ) &&
+           std::getline( is, site ) )
+        keys.emplace_back( op, comm, site );
+}
+
+// Temporarily disable the recording of statistics (so that the reports do
+// not record their own communication)
+class Pause
+{
+public:
+    Pause() : enabled_(mpi::comm_stats::enabled)
+    { mpi::comm_stats::enabled = false; }
+    ~Pause() { mpi::comm_stats::enabled = enabled_; }
+private:
+    bool enabled_;
+};
+
+} // anonymous namespace
+
+namespace El {
+namespace mpi {
+
+namespace comm_stats {
+bool enabled = false;
+}
+
+void EnableCommStats( const string filename )
+{
+    comm_stats::enabled = true;
+    ::reportFile = filename;
+}
+
+void DisableCommStats()
+{ comm_stats::enabled = false; }
+
+void ResetCommStats()
+{ ::records.clear(); }
+
+void RecordCommStat( const char* op, Comm comm, double bytes, double time )
+{
+    if( !CommStatsEnabled() || ThreadNum() != 0 )
+        return;
+    Value& value =
+      ::records[Key(op,CommLabel(comm.comm),CurrentProfileRegion())];
+    ++value.numCalls;
+    value.bytes += bytes;
+    value.time += time;
+}
+
+vector<CommStat> LocalCommStats()
+{
+    vector<CommStat> stats;
+    for( const auto& record : ::records )
+    {
+        CommStat stat;
+        stat.op = std::get<0>(record.first);
+        stat.comm = std::get<1>(record.first);
+        stat.site = std::get<2>(record.first);
+        stat.numCalls = record.second.numCalls;
+        stat.bytes = record.second.bytes;
+        stat.time = record.second.time;
+        stats.push_back( stat );
+    }
+    return stats;
+}
+
+void WriteCommStats( ostream& os, Comm comm )
+{
+    DEBUG_CSE
+    Pause pause;
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+
+    // Form the union of the keys of every process on the root
+    vector<Key> localKeys;
+    for( const auto& record : ::records )
+        localKeys.push_back( record.first );
+    string localStr;
+    SerializeKeys( localKeys, localStr );
+    int localSize = localStr.size();
+    vector<int> sizes( commSize ), offsets( commSize );
+    Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+    int totalSize = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    vector<byte> gathered( commRank == 0 ? totalSize : 0 );
+    Gather
+    ( (const byte*)localStr.data(), localSize,
+      gathered.data(), sizes.data(), offsets.data(), 0, comm );
+
+    string keysStr;
+    if( commRank == 0 )
+    {
+        vector<Key> keys;
+        DeserializeKeys( gathered, keys );
+        std::sort( keys.begin(), keys.end() );
+        keys.erase( std::unique( keys.begin(), keys.end() ), keys.end() );
+        SerializeKeys( keys, keysStr );
+    }
+    int keysSize = keysStr.size();
+    Broadcast( keysSize, 0, comm );
+    vector<byte> keysBuf( keysSize );
+    if( commRank == 0 )
+        MemCopy( keysBuf.data(), (const byte*)keysStr.data(), keysSize );
+    Broadcast( keysBuf.data(), keysSize, 0, comm );
+    vector<Key> keys;
+    DeserializeKeys( keysBuf, keys );
+    const Int numKeys = keys.size();
+
+    // Reduce (participation, calls, bytes, time) and the maximum time
+    const Int numStats = 4;
+    vector<double> stats( numStats*numKeys, 0. ), maxTimes( numKeys, 0. );
+    for( Int k=0; k<numKeys; ++k )
+    {
+        auto it = ::records.find( keys[k] );
+        if( it == ::records.end() )
+            continue;
+        stats[numStats*k+0] = 1;
+        stats[numStats*k+1] = it->second.numCalls;
+        stats[numStats*k+2] = it->second.bytes;
+        stats[numStats*k+3] = it->second.time;
+        maxTimes[k] = it->second.time;
+    }
+    vector<double> sums( numStats*numKeys ), maxs( numKeys );
+    Reduce( stats.data(), sums.data(), numStats*numKeys, SUM, 0, comm );
+    Reduce( maxTimes.data(), maxs.data(), numKeys, MAX, 0, comm );
+
+    if( commRank == 0 )
+    {
+        // Report the most expensive entries first
+        vector<Int> order( numKeys );
+        for( Int k=0; k<numKeys; ++k )
+            order[k] = k;
+        std::stable_sort
+        ( order.begin(), order.end(),
+          [&]( Int a, Int b ) { return maxs[a] > maxs[b]; } );
+
+        const auto flags = os.flags();
+        const auto precision = os.precision();
+        os << std::left << std::setw(20) << "op" << " "
+           << std::setw(20) << "comm" << " " << std::setw(30) << "site"
+           << std::right << std::setw(6) << "procs" << std::setw(12) << "calls"
+           << std::setw(14) << "bytes" << std::setw(12) << "avg time"
+           << std::setw(12) << "max time" << std::setw(10) << "imbalance"
+           << "\n";
+        os << std::setprecision(4);
+        for( const Int k : order )
+        {
+            const double numProcs = sums[numStats*k+0];
+            const double avgTime = sums[numStats*k+3] / numProcs;
+            const double imbalance = ( avgTime > 0 ? maxs[k]/avgTime : 1 );
+            const string site =
+              std::get<2>(keys[k]).empty() ? "-" : std::get<2>(keys[k]);
+            os << std::left << std::setw(20) << std::get<0>(keys[k]) << " "
+               << std::setw(20) << std::get<1>(keys[k]) << " "
+               << std::setw(30) << site << std::right
+               << std::setw(6) << Int(numProcs)
+               << std::setw(12) << Int(sums[numStats*k+1])
+               << std::setw(14) << sums[numStats*k+2]
+               << std::setw(12) << avgTime
+               << std::setw(12) << maxs[k]
+               << std::setw(10) << imbalance << "\n";
+        }
+        os.flags( flags );
+        os.precision( precision );
+    }
+}
+
+void WriteCommStats( const string filename, Comm comm )
+{
+    DEBUG_CSE
+    std::ofstream file;
+    if( Rank(comm) == 0 )
+    {
+        file.open( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+    }
+    WriteCommStats( file, comm );
+}
+
+void FinalizeCommStats()
+{
+    DEBUG_CSE
+    if( CommStatsEnabled() )
+    {
+        if( ::reportFile.empty() )
+            WriteCommStats( cout, COMM_WORLD );
+        else
+            WriteCommStats( ::reportFile, COMM_WORLD );
+        DisableCommStats();
+    }
+    ::records.clear();
+    if( ::labelKeyval != MPI_KEYVAL_INVALID )
+    {
+        // The labels of the predefined communicators are not otherwise freed
+        MPI_Comm_delete_attr( MPI_COMM_WORLD, ::labelKeyval );
+        MPI_Comm_delete_attr( MPI_COMM_SELF, ::labelKeyval );
+        MPI_Comm_free_keyval( &::labelKeyval );
+    }
+}
+
+} // namespace mpi
+} // namespace El
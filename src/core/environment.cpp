@@ -8,6 +8,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
 
 #include <algorithm>
 #include <set>
@@ -213,6 +214,10 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+        if( !mpi::Finalized() )
+            mpi::FinalizeCommStats();
+        gemm::ClearSUMMA25DCache();
+
         Grid::FinalizeDefault();
        
         // Destroy the types and ops
@@ -41,6 +41,8 @@ void EL_BLAS(zgemm)
 
 } // extern "C"
 
+#include "./Gemm/Packed.hpp"
+
 namespace El {
 namespace blas {
 
@@ -78,6 +80,15 @@ void Gemm
                 C[i+j*CLDim] *= beta;
     }
 
+    // Use the cache-blocked, packed kernel for all but the smallest products
+    const BlasInt minDim = gemm::PackedBlocksizes<T>::minDim;
+    if( m >= minDim && n >= minDim && k >= minDim )
+    {
+        gemm::PackedUpdate
+        ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+        return;
+    }
+
     // Naive implementation
     T gamma, delta;
     if( std::toupper(transA) == 'N' && std::toupper(transB) == 'N' )
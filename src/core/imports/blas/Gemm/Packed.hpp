@@ -0,0 +1,337 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// A cache-blocked, packed GEMM for scalar types which do not have a native
+// BLAS implementation (e.g., DoubleDouble, QuadDouble, Quad, and BigFloat).
+//
+// The structure follows the approach of Goto and van de Geijn: a KC x NC
+// panel of op(B) is packed into row-panels of width NR, an MC x KC block of
+// op(A) is packed into column-panels of height MR, and an MR x NR
+// micro-kernel accumulates rank-KC updates of C within a small workspace
+// before adding it into C. Each MC x NC block of C can be independently
+// updated, and so, in hybrid mode, the loop over the MC blocks is spread
+// over the available threads (when the scalar type is packed, and thus
+// free of hidden global state).
+
+namespace El {
+namespace blas {
+namespace gemm {
+
+template<typename T>
+struct PackedBlocksizes
+{
+    static const BlasInt MR = 4;
+    static const BlasInt NR = 4;
+    static const BlasInt MC = 64;
+    static const BlasInt KC = 128;
+    static const BlasInt NC = 1024;
+
+    // Products with any dimension smaller than this are left to the
+    // unblocked loops since packing would dominate
+    static const BlasInt minDim = 16;
+};
+
+// Pack op(A)(iOff:iOff+mc,lOff:lOff+kc) into column-panels of height MR,
+// where each panel is stored with its MR entries contiguous for each l.
+// Panels which extend past the bottom of op(A) are padded with zeros.
+template<typename T>
+void PackA
+( char transA,
+  BlasInt mc, BlasInt kc, BlasInt iOff, BlasInt lOff,
+  const T* A, BlasInt ALDim,
+        T* APacked )
+{
+    const BlasInt MR = PackedBlocksizes<T>::MR;
+    const char normTransA = std::toupper(transA);
+    for( BlasInt ir=0; ir<mc; ir+=MR )
+    {
+        const BlasInt mr = Min(MR,mc-ir);
+        T* panel = &APacked[ir*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            T* panelCol = &panel[l*MR];
+            if( normTransA == 'N' )
+            {
+                const T* ACol = &A[(iOff+ir)+(lOff+l)*ALDim];
+                for( BlasInt i=0; i<mr; ++i )
+                    panelCol[i] = ACol[i];
+            }
+            else if( normTransA == 'T' )
+            {
+                const T* ARow = &A[(lOff+l)+(iOff+ir)*ALDim];
+                for( BlasInt i=0; i<mr; ++i )
+                    panelCol[i] = ARow[i*ALDim];
+            }
+            else
+            {
+                const T* ARow = &A[(lOff+l)+(iOff+ir)*ALDim];
+                for( BlasInt i=0; i<mr; ++i )
+                    Conj( ARow[i*ALDim], panelCol[i] );
+            }
+            for( BlasInt i=mr; i<MR; ++i )
+                panelCol[i] = 0;
+        }
+    }
+}
+
+// Pack alpha op(B)(lOff:lOff+kc,jOff:jOff+nc) into row-panels of width NR,
+// where each panel is stored with its NR entries contiguous for each l.
+// Panels which extend past the right of op(B) are padded with zeros.
+template<typename T>
+void PackB
+( char transB,
+  BlasInt kc, BlasInt nc, BlasInt lOff, BlasInt jOff,
+  const T& alpha,
+  const T* B, BlasInt BLDim,
+        T* BPacked )
+{
+    const BlasInt NR = PackedBlocksizes<T>::NR;
+    const char normTransB = std::toupper(transB);
+    const bool scale = ( alpha != T(1) );
+    for( BlasInt jr=0; jr<nc; jr+=NR )
+    {
+        const BlasInt nr = Min(NR,nc-jr);
+        T* panel = &BPacked[jr*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            T* panelRow = &panel[l*NR];
+            if( normTransB == 'N' )
+            {
+                const T* BRow = &B[(lOff+l)+(jOff+jr)*BLDim];
+                for( BlasInt j=0; j<nr; ++j )
+                    panelRow[j] = BRow[j*BLDim];
+            }
+            else if( normTransB == 'T' )
+            {
+                const T* BCol = &B[(jOff+jr)+(lOff+l)*BLDim];
+                for( BlasInt j=0; j<nr; ++j )
+                    panelRow[j] = BCol[j];
+            }
+            else
+            {
+                const T* BCol = &B[(jOff+jr)+(lOff+l)*BLDim];
+                for( BlasInt j=0; j<nr; ++j )
+                    Conj( BCol[j], panelRow[j] );
+            }
+            if( scale )
+                for( BlasInt j=0; j<nr; ++j )
+                    panelRow[j] *= alpha;
+            for( BlasInt j=nr; j<NR; ++j )
+                panelRow[j] = 0;
+        }
+    }
+}
+
+// C(0:mr,0:nr) += APanel BPanel, where APanel is MR x kc and BPanel is
+// kc x NR. The MR x NR workspace 'AB' and the scalar 'tmp' are passed in so
+// that types whose construction allocates memory are not repeatedly built.
+template<typename T>
+void MicroKernel
+( BlasInt kc,
+  const T* APanel,
+  const T* BPanel,
+        T* C, BlasInt CLDim,
+  BlasInt mr, BlasInt nr,
+        T* AB, T& tmp )
+{
+    const BlasInt MR = PackedBlocksizes<T>::MR;
+    const BlasInt NR = PackedBlocksizes<T>::NR;
+    for( BlasInt t=0; t<MR*NR; ++t )
+        AB[t] = 0;
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const T* ACol = &APanel[l*MR];
+        const T* BRow = &BPanel[l*NR];
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            for( BlasInt i=0; i<MR; ++i )
+            {
+                tmp = ACol[i];
+                tmp *= BRow[j];
+                AB[i+j*MR] += tmp;
+            }
+        }
+    }
+    for( BlasInt j=0; j<nr; ++j )
+        for( BlasInt i=0; i<mr; ++i )
+            C[i+j*CLDim] += AB[i+j*MR];
+}
+
+#ifdef EL_HAVE_QD
+// Error-free transformations on pairs of doubles. The product error term
+// uses a fused multiply-add when it is known to be fast and falls back to
+// Dekker's splitting otherwise.
+inline void TwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    const double v = s - a;
+    e = (a - (s - v)) + (b - v);
+}
+
+inline void QuickTwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    e = b - (s - a);
+}
+
+inline double TwoProdError( double a, double b, double p )
+{
+#ifdef FP_FAST_FMA
+    return std::fma( a, b, -p );
+#else
+    const double splitter = 134217729.; // 2^27 + 1
+    double t = splitter*a;
+    const double aHi = t - (t - a);
+    const double aLo = a - aHi;
+    t = splitter*b;
+    const double bHi = t - (t - b);
+    const double bLo = b - bHi;
+    return ((aHi*bHi - p) + aHi*bLo + aLo*bHi) + aLo*bLo;
+#endif
+}
+
+// A DoubleDouble micro-kernel which keeps the accumulators as separate
+// arrays of leading and trailing doubles so that the fixed-length loops over
+// the MR x NR block consist purely of double-precision arithmetic and can be
+// vectorized by the compiler.
+template<>
+inline void MicroKernel
+( BlasInt kc,
+  const DoubleDouble* APanel,
+  const DoubleDouble* BPanel,
+        DoubleDouble* C, BlasInt CLDim,
+  BlasInt mr, BlasInt nr,
+        DoubleDouble* AB, DoubleDouble& tmp )
+{
+    const BlasInt MR = PackedBlocksizes<DoubleDouble>::MR;
+    const BlasInt NR = PackedBlocksizes<DoubleDouble>::NR;
+    double ABHi[MR*NR], ABLo[MR*NR];
+    for( BlasInt t=0; t<MR*NR; ++t )
+    {
+        ABHi[t] = 0;
+        ABLo[t] = 0;
+    }
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const DoubleDouble* ACol = &APanel[l*MR];
+        const DoubleDouble* BRow = &BPanel[l*NR];
+        double AHi[MR], ALo[MR];
+        for( BlasInt i=0; i<MR; ++i )
+        {
+            AHi[i] = ACol[i].x[0];
+            ALo[i] = ACol[i].x[1];
+        }
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            const double bHi = BRow[j].x[0];
+            const double bLo = BRow[j].x[1];
+            for( BlasInt i=0; i<MR; ++i )
+            {
+                // (pHi,pLo) := (AHi,ALo) (bHi,bLo)
+                const double pHi = AHi[i]*bHi;
+                const double pLo =
+                  TwoProdError(AHi[i],bHi,pHi) + (AHi[i]*bLo + ALo[i]*bHi);
+
+                // (ABHi,ABLo) += (pHi,pLo)
+                double sHi, sLo;
+                TwoSum( ABHi[i+j*MR], pHi, sHi, sLo );
+                sLo += ABLo[i+j*MR] + pLo;
+                QuickTwoSum( sHi, sLo, ABHi[i+j*MR], ABLo[i+j*MR] );
+            }
+        }
+    }
+    for( BlasInt j=0; j<nr; ++j )
+    {
+        for( BlasInt i=0; i<mr; ++i )
+        {
+            tmp.x[0] = ABHi[i+j*MR];
+            tmp.x[1] = ABLo[i+j*MR];
+            C[i+j*CLDim] += tmp;
+        }
+    }
+}
+#endif // ifdef EL_HAVE_QD
+
+// C := alpha op(A) op(B) + C
+template<typename T>
+void PackedUpdate
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt MR = PackedBlocksizes<T>::MR;
+    const BlasInt NR = PackedBlocksizes<T>::NR;
+    const BlasInt MC = PackedBlocksizes<T>::MC;
+    const BlasInt KC = PackedBlocksizes<T>::KC;
+    const BlasInt NC = PackedBlocksizes<T>::NC;
+
+    // Types which are not packed (e.g., BigFloat) may rely upon global state,
+    // such as the default precision, and so they are not threaded
+    const int numThreads = ( IsPacked<T>::value ? MaxThreads() : 1 );
+
+    const BlasInt kcMax = Min(KC,k);
+    const BlasInt ncMax = Min(NC,n);
+    const BlasInt mcMax = Min(MC,m);
+    const BlasInt ncPad = ((ncMax+NR-1)/NR)*NR;
+    const BlasInt mcPad = ((mcMax+MR-1)/MR)*MR;
+    vector<T> BPacked( kcMax*ncPad ),
+              APacked( numThreads*kcMax*mcPad ),
+              ABWork( numThreads*MR*NR ),
+              tmps( numThreads );
+
+    for( BlasInt jc=0; jc<n; jc+=NC )
+    {
+        const BlasInt nc = Min(NC,n-jc);
+        for( BlasInt pc=0; pc<k; pc+=KC )
+        {
+            const BlasInt kc = Min(KC,k-pc);
+            PackB( transB, kc, nc, pc, jc, alpha, B, BLDim, BPacked.data() );
+
+            const BlasInt numMBlocks = (m+MC-1) / MC;
+            auto updateBlock = [&]( BlasInt mBlock, int thread )
+            {
+                const BlasInt ic = mBlock*MC;
+                const BlasInt mc = Min(MC,m-ic);
+                T* AThread = &APacked[thread*kcMax*mcPad];
+                T* ABThread = &ABWork[thread*MR*NR];
+                PackA( transA, mc, kc, ic, pc, A, ALDim, AThread );
+                for( BlasInt jr=0; jr<nc; jr+=NR )
+                {
+                    const BlasInt nr = Min(NR,nc-jr);
+                    for( BlasInt ir=0; ir<mc; ir+=MR )
+                    {
+                        const BlasInt mr = Min(MR,mc-ir);
+                        MicroKernel
+                        ( kc, &AThread[ir*kc], &BPacked[jr*kc],
+                          &C[(ic+ir)+(jc+jr)*CLDim], CLDim, mr, nr,
+                          ABThread, tmps[thread] );
+                    }
+                }
+            };
+            if( numThreads > 1 )
+            {
+                EL_PARALLEL_FOR
+                for( BlasInt mBlock=0; mBlock<numMBlocks; ++mBlock )
+                    updateBlock( mBlock, ThreadNum() );
+            }
+            else
+            {
+                for( BlasInt mBlock=0; mBlock<numMBlocks; ++mBlock )
+                    updateBlock( mBlock, 0 );
+            }
+        }
+    }
+}
+
+} // namespace gemm
+} // namespace blas
+} // namespace El
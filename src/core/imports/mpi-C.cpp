@@ -9,6 +9,10 @@
 #include <El-lite.hpp>
 #include <El-lite.h>
 
+namespace {
+std::vector<El::mpi::CommStat> commStatsSnapshot;
+}
+
 extern "C" {
 
 // TODO: C++ implementation as well?
@@ -51,4 +55,39 @@ ElError ElMPIWorldSize( int* size )
 ElError ElMPITime( double* time )
 { EL_TRY( *time = El::mpi::Time() ) }
 
+ElError ElMPIEnableCommStats( const char* filename )
+{ EL_TRY( El::mpi::EnableCommStats( std::string(filename) ) ) }
+
+ElError ElMPIDisableCommStats()
+{ EL_TRY( El::mpi::DisableCommStats() ) }
+
+ElError ElMPICommStatsEnabled( bool* enabled )
+{ EL_TRY( *enabled = El::mpi::CommStatsEnabled() ) }
+
+ElError ElMPIResetCommStats()
+{ EL_TRY( El::mpi::ResetCommStats() ) }
+
+ElError ElMPINumCommStats( ElInt* numStats )
+{ EL_TRY(
+    commStatsSnapshot = El::mpi::LocalCommStats();
+    *numStats = commStatsSnapshot.size() ) }
+
+ElError ElMPICommStat
+( ElInt index, const char** op, const char** comm, const char** site,
+  ElInt* numCalls, double* bytes, double* time )
+{ EL_TRY(
+    if( index < 0 || index >= ElInt(commStatsSnapshot.size()) )
+        El::LogicError("Invalid communication statistic index");
+    const auto& stat = commStatsSnapshot[index];
+    *op = stat.op.c_str();
+    *comm = stat.comm.c_str();
+    *site = stat.site.c_str();
+    *numCalls = stat.numCalls;
+    *bytes = stat.bytes;
+    *time = stat.time ) }
+
+ElError ElMPIWriteCommStats( const char* filename, MPI_Comm comm )
+{ EL_TRY
+  ( El::mpi::WriteCommStats( std::string(filename), El::mpi::Comm(comm) ) ) }
+
 } // extern "C"
@@ -47,6 +47,305 @@ MPI_Op NativeOp( const El::mpi::Op& op )
     return opC;
 }
 
+// Forward to MPI, recording the call for the communication statistics if they
+// are enabled. The number of bytes is that of this process's contribution
+// (its send buffer, or its receive buffer for receives and scatters).
+namespace recorded {
+
+// Whether the calls are recorded for the statistics or the profiler
+inline bool Recording()
+{ return El::mpi::CommStatsEnabled() || El::Profiling(); }
+
+class Record
+{
+public:
+    Record( const char* op, MPI_Comm comm, double count, MPI_Datatype type )
+    : active_(Recording())
+    {
+        if( active_ )
+        {
+            op_ = op;
+            comm_ = comm;
+            int typeSize;
+            MPI_Type_size( type, &typeSize );
+            bytes_ = count*typeSize;
+            start_ = MPI_Wtime();
+        }
+    }
+
+    ~Record()
+    {
+        if( active_ )
+        {
+            const double time = MPI_Wtime() - start_;
+            El::mpi::RecordCommStat( op_, comm_, bytes_, time );
+            El::AddProfileBytes( bytes_ );
+        }
+    }
+
+private:
+    bool active_;
+    const char* op_;
+    MPI_Comm comm_;
+    double bytes_, start_;
+};
+
+inline double CommSize( MPI_Comm comm )
+{
+    if( !Recording() )
+        return 0;
+    int size;
+    MPI_Comm_size( comm, &size );
+    return size;
+}
+
+inline double CountSum( const int* counts, MPI_Comm comm )
+{
+    if( !Recording() )
+        return 0;
+    const int size = CommSize( comm );
+    double sum = 0;
+    for( int q=0; q<size; ++q )
+        sum += counts[q];
+    return sum;
+}
+
+inline int Barrier( MPI_Comm comm )
+{
+    Record record( "Barrier", comm, 0, MPI_BYTE );
+    return MPI_Barrier( comm );
+}
+
+// Requests do not carry their communicator, so the blocked time of waits is
+// not attributed to one
+inline int Wait( MPI_Request* request, MPI_Status* status )
+{
+    Record record( "Wait", MPI_COMM_NULL, 0, MPI_BYTE );
+    return MPI_Wait( request, status );
+}
+
+inline int Waitall( int count, MPI_Request* requests, MPI_Status* statuses )
+{
+    Record record( "WaitAll", MPI_COMM_NULL, 0, MPI_BYTE );
+    return MPI_Waitall( count, requests, statuses );
+}
+
+inline int Send
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm )
+{
+    Record record( "Send", comm, count, type );
+    return MPI_Send( const_cast<void*>(buf), count, type, to, tag, comm );
+}
+
+inline int Isend
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm, MPI_Request* request )
+{
+    Record record( "ISend", comm, count, type );
+    return MPI_Isend
+    ( const_cast<void*>(buf), count, type, to, tag, comm, request );
+}
+
+inline int Irsend
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm, MPI_Request* request )
+{
+    Record record( "IRSend", comm, count, type );
+    return MPI_Irsend
+    ( const_cast<void*>(buf), count, type, to, tag, comm, request );
+}
+
+inline int Issend
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm, MPI_Request* request )
+{
+    Record record( "ISSend", comm, count, type );
+    return MPI_Issend
+    ( const_cast<void*>(buf), count, type, to, tag, comm, request );
+}
+
+inline int Recv
+( void* buf, int count, MPI_Datatype type, int from, int tag,
+  MPI_Comm comm, MPI_Status* status )
+{
+    Record record( "Recv", comm, count, type );
+    return MPI_Recv( buf, count, type, from, tag, comm, status );
+}
+
+inline int Irecv
+( void* buf, int count, MPI_Datatype type, int from, int tag,
+  MPI_Comm comm, MPI_Request* request )
+{
+    Record record( "IRecv", comm, count, type );
+    return MPI_Irecv( buf, count, type, from, tag, comm, request );
+}
+
+inline int Sendrecv
+( const void* sbuf, int sc, MPI_Datatype stype, int to, int stag,
+        void* rbuf, int rc, MPI_Datatype rtype, int from, int rtag,
+  MPI_Comm comm, MPI_Status* status )
+{
+    Record record( "SendRecv", comm, sc, stype );
+    return MPI_Sendrecv
+    ( const_cast<void*>(sbuf), sc, stype, to, stag,
+      rbuf, rc, rtype, from, rtag, comm, status );
+}
+
+inline int Sendrecv_replace
+( void* buf, int count, MPI_Datatype type, int to, int stag, int from,
+  int rtag, MPI_Comm comm, MPI_Status* status )
+{
+    Record record( "SendRecv", comm, count, type );
+    return MPI_Sendrecv_replace
+    ( buf, count, type, to, stag, from, rtag, comm, status );
+}
+
+inline int Bcast
+( void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm )
+{
+    Record record( "Broadcast", comm, count, type );
+    return MPI_Bcast( buf, count, type, root, comm );
+}
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+inline int Ibcast
+( void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm,
+  MPI_Request* request )
+{
+    Record record( "IBroadcast", comm, count, type );
+    return MPI_Ibcast( buf, count, type, root, comm, request );
+}
+
+inline int Igather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm,
+  MPI_Request* request )
+{
+    Record record( "IGather", comm, sc, stype );
+    return MPI_Igather
+    ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, root, comm,
+      request );
+}
+#endif
+
+inline int Gather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm )
+{
+    Record record( "Gather", comm, sc, stype );
+    return MPI_Gather
+    ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, root, comm );
+}
+
+inline int Gatherv
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, const int* rcs, const int* rds, MPI_Datatype rtype,
+  int root, MPI_Comm comm )
+{
+    Record record( "Gather", comm, sc, stype );
+    return MPI_Gatherv
+    ( const_cast<void*>(sbuf), sc, stype,
+      rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), rtype, root, comm );
+}
+
+inline int Allgather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm )
+{
+    Record record( "AllGather", comm, sc, stype );
+    return MPI_Allgather
+    ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, comm );
+}
+
+inline int Allgatherv
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, const int* rcs, const int* rds, MPI_Datatype rtype,
+  MPI_Comm comm )
+{
+    Record record( "AllGather", comm, sc, stype );
+    return MPI_Allgatherv
+    ( const_cast<void*>(sbuf), sc, stype,
+      rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), rtype, comm );
+}
+
+inline int Scatter
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm )
+{
+    Record record( "Scatter", comm, rc, rtype );
+    return MPI_Scatter
+    ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, root, comm );
+}
+
+inline int Alltoall
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm )
+{
+    Record record( "AllToAll", comm, sc*CommSize(comm), stype );
+    return MPI_Alltoall
+    ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, comm );
+}
+
+inline int Alltoallv
+( const void* sbuf, const int* scs, const int* sds, MPI_Datatype stype,
+        void* rbuf, const int* rcs, const int* rds, MPI_Datatype rtype,
+  MPI_Comm comm )
+{
+    Record record( "AllToAll", comm, CountSum(scs,comm), stype );
+    return MPI_Alltoallv
+    ( const_cast<void*>(sbuf), const_cast<int*>(scs), const_cast<int*>(sds),
+      stype,
+      rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), rtype, comm );
+}
+
+inline int Reduce
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  int root, MPI_Comm comm )
+{
+    Record record( "Reduce", comm, count, type );
+    return MPI_Reduce
+    ( const_cast<void*>(sbuf), rbuf, count, type, op, root, comm );
+}
+
+inline int Allreduce
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    Record record( "AllReduce", comm, count, type );
+    return MPI_Allreduce( const_cast<void*>(sbuf), rbuf, count, type, op, comm );
+}
+
+inline int Reduce_scatter
+( const void* sbuf, void* rbuf, const int* rcs, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    Record record( "ReduceScatter", comm, CountSum(rcs,comm), type );
+    return MPI_Reduce_scatter
+    ( const_cast<void*>(sbuf), rbuf, const_cast<int*>(rcs), type, op, comm );
+}
+
+#ifdef EL_HAVE_MPI_REDUCE_SCATTER_BLOCK
+inline int Reduce_scatter_block
+( const void* sbuf, void* rbuf, int rc, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    Record record( "ReduceScatter", comm, rc*CommSize(comm), type );
+    return MPI_Reduce_scatter_block
+    ( const_cast<void*>(sbuf), rbuf, rc, type, op, comm );
+}
+#endif
+
+inline int Scan
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    Record record( "Scan", comm, count, type );
+    return MPI_Scan( const_cast<void*>(sbuf), rbuf, count, type, op, comm );
+}
+
+} // namespace recorded
+
 } // anonymous namespace
 
 namespace El {
@@ -396,7 +695,7 @@ void Translate
 void Barrier( Comm comm ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
-    SafeMpi( MPI_Barrier( comm.comm ) );
+    SafeMpi( recorded::Barrier( comm.comm ) );
 }
 
 // Test for completion
@@ -424,7 +723,7 @@ template<typename T,typename>
 void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
-    SafeMpi( MPI_Wait( &request.backend, &status ) );
+    SafeMpi( recorded::Wait( &request.backend, &status ) );
 }
 
 // Ensure that several requests finish before continuing
@@ -450,7 +749,7 @@ EL_NO_RELEASE_EXCEPT
     vector<MPI_Request> backends( numRequests );
     for( Int j=0; j<numRequests; ++j )
         backends[j] = requests[j].backend;
-    SafeMpi( MPI_Waitall( numRequests, backends.data(), statuses ) );
+    SafeMpi( recorded::Waitall( numRequests, backends.data(), statuses ) );
     // NOTE: This write back will almost always be superfluous, but it ensures
     //       that any changes to the pointer are propagated
     for( Int j=0; j<numRequests; ++j )
@@ -459,7 +758,7 @@ EL_NO_RELEASE_EXCEPT
     for( Int j=0; j<numRequests; ++j )
     {
         Status status;
-        MPI_Wait( &requests[j].backend, &status );
+        recorded::Wait( &requests[j].backend, &status );
     }
 #endif
 }
@@ -468,7 +767,7 @@ template<typename T,typename,typename>
 void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
-    SafeMpi( MPI_Wait( &request.backend, &status ) );
+    SafeMpi( recorded::Wait( &request.backend, &status ) );
     if( request.receivingPacked )
     {
         Deserialize
@@ -491,7 +790,7 @@ EL_NO_RELEASE_EXCEPT
     vector<MPI_Request> backends( numRequests );
     for( Int j=0; j<numRequests; ++j )
         backends[j] = requests[j].backend;
-    SafeMpi( MPI_Waitall( numRequests, backends.data(), statuses ) );
+    SafeMpi( recorded::Waitall( numRequests, backends.data(), statuses ) );
     // NOTE: This write back will almost always be superfluous, but it ensures
     //       that any changes to the pointer are propagated
     for( Int j=0; j<numRequests; ++j )
@@ -500,7 +799,7 @@ EL_NO_RELEASE_EXCEPT
     for( Int j=0; j<numRequests; ++j )
     {
         Status status;
-        MPI_Wait( &requests[j].backend, &status );
+        recorded::Wait( &requests[j].backend, &status );
     }
 #endif
     for( Int j=0; j<numRequests; ++j )
@@ -544,7 +843,7 @@ EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_CSE
     SafeMpi
-    ( MPI_Send
+    ( recorded::Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
 }
 
@@ -556,12 +855,12 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Send
+    ( recorded::Send
       ( const_cast<Complex<Real>*>(buf), 2*count, TypeMap<Real>(), to, 
         tag, comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Send
+    ( recorded::Send
       ( const_cast<Complex<Real>*>(buf), count, 
         TypeMap<Complex<Real>>(), to, tag, comm.comm ) );
 #endif
@@ -574,7 +873,7 @@ void TaggedSend( const T* buf, int count, int to, int tag, Comm comm )
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi
-    ( MPI_Send( packedBuf.data(), count, TypeMap<T>(), to, tag, comm.comm ) );
+    ( recorded::Send( packedBuf.data(), count, TypeMap<T>(), to, tag, comm.comm ) );
 }
 
 template<typename T>
@@ -597,7 +896,7 @@ EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_CSE
     SafeMpi
-    ( MPI_Isend
+    ( recorded::Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -610,12 +909,12 @@ void TaggedISend
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Isend
+    ( recorded::Isend
       ( const_cast<Complex<Real>*>(buf), 2*count, 
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Isend
+    ( recorded::Isend
       ( const_cast<Complex<Real>*>(buf), count, 
         TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
 #endif
@@ -629,7 +928,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Isend
+    ( recorded::Isend
       ( request.buffer.data(), count, TypeMap<T>(), to, tag, comm.comm,
         &request.backend ) );
 }
@@ -658,7 +957,7 @@ EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_CSE
     SafeMpi
-    ( MPI_Irsend
+    ( recorded::Irsend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -671,12 +970,12 @@ void TaggedIRSend
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Irsend
+    ( recorded::Irsend
       ( const_cast<Complex<Real>*>(buf), 2*count, 
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Irsend
+    ( recorded::Irsend
       ( const_cast<Complex<Real>*>(buf), count, 
         TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
 #endif
@@ -691,7 +990,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Irsend
+    ( recorded::Irsend
       ( request.buffer.data(), count, TypeMap<T>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -719,7 +1018,7 @@ void TaggedISSend
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Issend
+    ( recorded::Issend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -732,12 +1031,12 @@ void TaggedISSend
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Issend
+    ( recorded::Issend
       ( const_cast<Complex<Real>*>(buf), 2*count, 
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Issend
+    ( recorded::Issend
       ( const_cast<Complex<Real>*>(buf), count, 
         TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
 #endif
@@ -751,7 +1050,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Issend
+    ( recorded::Issend
       ( request.buffer.data(), count, TypeMap<T>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -773,7 +1072,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     Status status;
     SafeMpi
-    ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
+    ( recorded::Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
 }
 
 template<typename Real,typename>
@@ -784,10 +1083,10 @@ EL_NO_RELEASE_EXCEPT
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Recv( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
+    ( recorded::Recv( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
 #else
     SafeMpi
-    ( MPI_Recv
+    ( recorded::Recv
       ( buf, count, TypeMap<Complex<Real>>(), from, tag, comm.comm, &status ) );
 #endif
 }
@@ -800,7 +1099,7 @@ void TaggedRecv( T* buf, int count, int from, int tag, Comm comm )
     ReserveSerialized( count, buf, packedBuf );
     Status status;
     SafeMpi
-    ( MPI_Recv
+    ( recorded::Recv
       ( packedBuf.data(), count, TypeMap<T>(), from, tag,
         comm.comm, &status ) );
     Deserialize( count, packedBuf, buf );
@@ -828,7 +1127,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Irecv
+    ( recorded::Irecv
       ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &request.backend ) );
 }
 
@@ -841,12 +1140,12 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Irecv
+    ( recorded::Irecv
       ( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm,
         &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Irecv
+    ( recorded::Irecv
       ( buf, count, TypeMap<Complex<Real>>(), from, tag, comm.comm,
         &request.backend ) );
 #endif
@@ -863,7 +1162,7 @@ EL_NO_RELEASE_EXCEPT
     request.unpackedRecvBuf = buf;
     ReserveSerialized( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Irecv
+    ( recorded::Irecv
       ( request.buffer.data(), count, TypeMap<T>(), from, tag, comm.comm,
         &request.backend ) );
 }
@@ -892,7 +1191,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     Status status;
     SafeMpi
-    ( MPI_Sendrecv
+    ( recorded::Sendrecv
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(), to,   stag,
         rbuf,                    rc, TypeMap<Real>(), from, rtag, 
         comm.comm, &status ) );
@@ -908,13 +1207,13 @@ EL_NO_RELEASE_EXCEPT
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Sendrecv
+    ( recorded::Sendrecv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(), to,   stag,
         rbuf,                             2*rc, TypeMap<Real>(), from, rtag, 
         comm.comm, &status ) );
 #else
     SafeMpi
-    ( MPI_Sendrecv
+    ( recorded::Sendrecv
       ( const_cast<Complex<Real>*>(sbuf), 
         sc, TypeMap<Complex<Real>>(), to,   stag,
         rbuf,                          
@@ -933,7 +1232,7 @@ void TaggedSendRecv
     Serialize( sc, sbuf, packedSend );
     ReserveSerialized( rc, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Sendrecv
+    ( recorded::Sendrecv
       ( packedSend.data(), sc, TypeMap<T>(), to,   stag,
         packedRecv.data(), rc, TypeMap<T>(), from, rtag, 
         comm.comm, &status ) );
@@ -969,7 +1268,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     Status status;
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( recorded::Sendrecv_replace
       ( buf, count, TypeMap<Real>(), to, stag, from, rtag, comm.comm,
         &status ) );
 }
@@ -984,12 +1283,12 @@ EL_NO_RELEASE_EXCEPT
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( recorded::Sendrecv_replace
       ( buf, 2*count, TypeMap<Real>(), to, stag, from, rtag, comm.comm, 
         &status ) );
 #else
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( recorded::Sendrecv_replace
       ( buf, count, TypeMap<Complex<Real>>(), 
         to, stag, from, rtag, comm.comm, &status ) );
 #endif
@@ -1006,7 +1305,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, buf, packedBuf );
     Status status;
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( recorded::Sendrecv_replace
       ( packedBuf.data(), count, TypeMap<T>(), to, stag, from, rtag,
         comm.comm, &status ) );
     Deserialize( count, packedBuf, buf );
@@ -1024,7 +1323,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     if( Size(comm) == 1 || count == 0 )
         return;
-    SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
+    SafeMpi( recorded::Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
 }
 
 template<typename Real,typename>
@@ -1035,9 +1334,9 @@ EL_NO_RELEASE_EXCEPT
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
-    SafeMpi( MPI_Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
+    SafeMpi( recorded::Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
 #else
-    SafeMpi( MPI_Bcast( buf, count, TypeMap<Complex<Real>>(), root, comm.comm ) );
+    SafeMpi( recorded::Bcast( buf, count, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
 }
 
@@ -1051,7 +1350,7 @@ EL_NO_RELEASE_EXCEPT
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi(
-      MPI_Bcast( packedBuf.data(), count, TypeMap<T>(), root, comm.comm )
+      recorded::Bcast( packedBuf.data(), count, TypeMap<T>(), root, comm.comm )
     );
     Deserialize( count, packedBuf, buf );
 }
@@ -1067,7 +1366,7 @@ void IBroadcast
     DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Ibcast
+    ( recorded::Ibcast
       ( buf, count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1083,11 +1382,11 @@ void IBroadcast
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Ibcast
+    ( recorded::Ibcast
       ( buf, 2*count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Ibcast
+    ( recorded::Ibcast
       ( buf, count, TypeMap<Complex<Real>>(), root, comm.comm,
         &request.backend ) );
 #endif
@@ -1107,7 +1406,7 @@ void IBroadcast
     request.unpackedRecvBuf = buf;
     ReserveSerialized( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Ibcast
+    ( recorded::Ibcast
       ( request.buffer.data(), count, TypeMap<Real>(), root, comm.comm,
         &request.backend ) );
 #else
@@ -1127,7 +1426,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Gather
+    ( recorded::Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm ) );
 }
@@ -1141,13 +1440,13 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Gather
+    ( recorded::Gather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(),
         root, comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Gather
+    ( recorded::Gather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), 
         root, comm.comm ) );
@@ -1171,7 +1470,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Gather
+    ( recorded::Gather
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
     if( commRank == root )
@@ -1188,7 +1487,7 @@ void IGather
     DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Igather
+    ( recorded::Igather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm,
         &request.backend ) );
@@ -1208,13 +1507,13 @@ void IGather
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Igather
+    ( recorded::Igather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), 
         root, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Igather
+    ( recorded::Igather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), 
         root, comm.comm, &request.backend ) );
@@ -1242,7 +1541,7 @@ void IGather
         ReserveSerialized( rc*commSize, rbuf, request.buffer );
     }
     SafeMpi
-    ( MPI_Igather
+    ( recorded::Igather
       ( request.buffer.data(), sc, TypeMap<Real>(),
         rbuf,                  rc, TypeMap<Real>(), root, comm.comm,
         &request.backend ) );
@@ -1260,7 +1559,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Gatherv
+    ( recorded::Gatherv
       ( const_cast<Real*>(sbuf), 
         sc,       
         TypeMap<Real>(),
@@ -1295,13 +1594,13 @@ EL_NO_RELEASE_EXCEPT
         }
     }
     SafeMpi
-    ( MPI_Gatherv
+    ( recorded::Gatherv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf, rcsDouble.data(), rdsDouble.data(), TypeMap<Real>(),
         root, comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Gatherv
+    ( recorded::Gatherv
       ( const_cast<Complex<Real>*>(sbuf), 
         sc,       
         TypeMap<Complex<Real>>(),
@@ -1334,7 +1633,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Gatherv
+    ( recorded::Gatherv
       ( packedSend.data(),
         sc,
         TypeMap<T>(),
@@ -1357,13 +1656,13 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
-    ( MPI_Allgather
+    ( recorded::Allgather
       ( (UCP)const_cast<Real*>(sbuf), sizeof(Real)*sc, MPI_UNSIGNED_CHAR, 
         (UCP)rbuf,                    sizeof(Real)*rc, MPI_UNSIGNED_CHAR, 
         comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Allgather
+    ( recorded::Allgather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(), 
         rbuf,                    rc, TypeMap<Real>(), comm.comm ) );
 #endif
@@ -1378,7 +1677,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
-    ( MPI_Allgather
+    ( recorded::Allgather
       ( (UCP)const_cast<Complex<Real>*>(sbuf),
         2*sizeof(Real)*sc, MPI_UNSIGNED_CHAR, 
         (UCP)rbuf,
@@ -1387,13 +1686,13 @@ EL_NO_RELEASE_EXCEPT
 #else
  #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Allgather
+    ( recorded::Allgather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(),
         comm.comm ) );
  #else
     SafeMpi
-    ( MPI_Allgather
+    ( recorded::Allgather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(),
         comm.comm ) );
@@ -1416,7 +1715,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Allgather
+    ( recorded::Allgather
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
@@ -1438,13 +1737,13 @@ EL_NO_RELEASE_EXCEPT
         byteRds[i] = sizeof(Real)*rds[i];
     }
     SafeMpi
-    ( MPI_Allgatherv
+    ( recorded::Allgatherv
       ( (UCP)const_cast<Real*>(sbuf), sizeof(Real)*sc,   MPI_UNSIGNED_CHAR, 
         (UCP)rbuf, byteRcs.data(), byteRds.data(), MPI_UNSIGNED_CHAR, 
         comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Allgatherv
+    ( recorded::Allgatherv
       ( const_cast<Real*>(sbuf), 
         sc, 
         TypeMap<Real>(), 
@@ -1472,7 +1771,7 @@ EL_NO_RELEASE_EXCEPT
         byteRds[i] = 2*sizeof(Real)*rds[i];
     }
     SafeMpi
-    ( MPI_Allgatherv
+    ( recorded::Allgatherv
       ( (UCP)const_cast<Complex<Real>*>(sbuf),
         2*sizeof(Real)*sc, MPI_UNSIGNED_CHAR, 
         (UCP)rbuf, byteRcs.data(), byteRds.data(),
@@ -1488,12 +1787,12 @@ EL_NO_RELEASE_EXCEPT
         realRds[i] = 2*rds[i];
     }
     SafeMpi
-    ( MPI_Allgatherv
+    ( recorded::Allgatherv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf, realRcs.data(), realRds.data(), TypeMap<Real>(), comm.comm ) );
  #else
     SafeMpi
-    ( MPI_Allgatherv
+    ( recorded::Allgatherv
       ( const_cast<Complex<Real>*>(sbuf), 
         sc, 
         TypeMap<Complex<Real>>(),
@@ -1521,7 +1820,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Allgatherv
+    ( recorded::Allgatherv
       ( packedSend.data(),
         sc,
         TypeMap<T>(),
@@ -1541,7 +1840,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Scatter
+    ( recorded::Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm ) );
 }
@@ -1555,13 +1854,13 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Scatter
+    ( recorded::Scatter
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), root,
         comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Scatter
+    ( recorded::Scatter
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), 
         root, comm.comm ) );
@@ -1585,7 +1884,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( rc, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Scatter
+    ( recorded::Scatter
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
     Deserialize( rc, packedRecv, rbuf );
@@ -1600,14 +1899,14 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
     {
         SafeMpi
-        ( MPI_Scatter
+        ( recorded::Scatter
           ( buf,          sc, TypeMap<Real>(), 
             MPI_IN_PLACE, rc, TypeMap<Real>(), root, comm.comm ) );
     }
     else
     {
         SafeMpi
-        ( MPI_Scatter
+        ( recorded::Scatter
           ( 0,   sc, TypeMap<Real>(), 
             buf, rc, TypeMap<Real>(), root, comm.comm ) );
     }
@@ -1623,12 +1922,12 @@ EL_NO_RELEASE_EXCEPT
     {
 #ifdef EL_AVOID_COMPLEX_MPI
         SafeMpi
-        ( MPI_Scatter
+        ( recorded::Scatter
           ( buf,          2*sc, TypeMap<Real>(), 
             MPI_IN_PLACE, 2*rc, TypeMap<Real>(), root, comm.comm ) );
 #else
         SafeMpi
-        ( MPI_Scatter
+        ( recorded::Scatter
           ( buf,          sc, TypeMap<Complex<Real>>(), 
             MPI_IN_PLACE, rc, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
@@ -1637,12 +1936,12 @@ EL_NO_RELEASE_EXCEPT
     {
 #ifdef EL_AVOID_COMPLEX_MPI
         SafeMpi
-        ( MPI_Scatter
+        ( recorded::Scatter
           ( 0,   2*sc, TypeMap<Real>(), 
             buf, 2*rc, TypeMap<Real>(), root, comm.comm ) );
 #else
         SafeMpi
-        ( MPI_Scatter
+        ( recorded::Scatter
           ( 0,   sc, TypeMap<Complex<Real>>(), 
             buf, rc, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
@@ -1666,7 +1965,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( rc, buf, packedRecv );
     SafeMpi
-    ( MPI_Scatter
+    ( recorded::Scatter
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
     Deserialize( rc, packedRecv, buf );
@@ -1680,7 +1979,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Alltoall
+    ( recorded::Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), comm.comm ) );
 }
@@ -1694,14 +1993,14 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Alltoall
+    ( recorded::Alltoall
       ( const_cast<Complex<Real>*>(sbuf),
         2*sc, TypeMap<Real>(),
         rbuf,
         2*rc, TypeMap<Real>(), comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Alltoall
+    ( recorded::Alltoall
       ( const_cast<Complex<Real>*>(sbuf),
         sc, TypeMap<Complex<Real>>(),
         rbuf,
@@ -1724,7 +2023,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Alltoall
+    ( recorded::Alltoall
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
@@ -1738,7 +2037,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
     SafeMpi
-    ( MPI_Alltoallv
+    ( recorded::Alltoallv
       ( const_cast<Real*>(sbuf), 
         const_cast<int*>(scs), 
         const_cast<int*>(sds), 
@@ -1770,13 +2069,13 @@ EL_NO_RELEASE_EXCEPT
         rdsDoubled[i] = 2*rds[i];
     }
     SafeMpi
-    ( MPI_Alltoallv
+    ( recorded::Alltoallv
       ( const_cast<Complex<Real>*>(sbuf),
               scsDoubled.data(), sdsDoubled.data(), TypeMap<Real>(),
         rbuf, rcsDoubled.data(), rdsDoubled.data(), TypeMap<Real>(), comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Alltoallv
+    ( recorded::Alltoallv
       ( const_cast<Complex<Real>*>(sbuf), 
         const_cast<int*>(scs), 
         const_cast<int*>(sds), 
@@ -1804,7 +2103,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Alltoallv
+    ( recorded::Alltoallv
       ( packedSend.data(),
         const_cast<int*>(scs), const_cast<int*>(sds), TypeMap<T>(),
         packedRecv.data(),
@@ -1844,7 +2143,7 @@ EL_NO_RELEASE_EXCEPT
 
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce
+    ( recorded::Reduce
       ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
         opC, root, comm.comm ) );
 }
@@ -1864,7 +2163,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Reduce
+        ( recorded::Reduce
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, 2*count, TypeMap<Real>(), opC, 
             root, comm.comm ) );
@@ -1873,14 +2172,14 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Reduce
+        ( recorded::Reduce
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, count, TypeMap<Complex<Real>>(), opC, root, comm.comm ) );
     }
 #else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Reduce
+    ( recorded::Reduce
       ( const_cast<Complex<Real>*>(sbuf), 
         rbuf, count, TypeMap<Complex<Real>>(), opC, root, comm.comm ) );
 #endif
@@ -1904,7 +2203,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( count, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Reduce
+    ( recorded::Reduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, root, comm.comm ) );
     if( commRank == root )
@@ -1948,13 +2247,13 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
     {
         SafeMpi
-        ( MPI_Reduce
+        ( recorded::Reduce
           ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, root, 
             comm.comm ) );
     }
     else
         SafeMpi
-        ( MPI_Reduce
+        ( recorded::Reduce
           ( buf, 0, count, TypeMap<Real>(), opC, root, comm.comm ) );
 }
 
@@ -1975,13 +2274,13 @@ EL_NO_RELEASE_EXCEPT
             if( commRank == root )
             {
                 SafeMpi
-                ( MPI_Reduce
+                ( recorded::Reduce
                   ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, 
                     root, comm.comm ) );
             }
             else
                 SafeMpi
-                ( MPI_Reduce
+                ( recorded::Reduce
                   ( buf, 0, 2*count, TypeMap<Real>(), opC, root, comm.comm ) );
         }
         else
@@ -1990,13 +2289,13 @@ EL_NO_RELEASE_EXCEPT
             if( commRank == root )
             {
                 SafeMpi
-                ( MPI_Reduce
+                ( recorded::Reduce
                   ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
                     root, comm.comm ) );
             }
             else
                 SafeMpi
-                ( MPI_Reduce
+                ( recorded::Reduce
                   ( buf, 0, count, TypeMap<Complex<Real>>(), opC, 
                     root, comm.comm ) );
         }
@@ -2005,13 +2304,13 @@ EL_NO_RELEASE_EXCEPT
         if( commRank == root )
         {
             SafeMpi
-            ( MPI_Reduce
+            ( recorded::Reduce
               ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
                 root, comm.comm ) );
         }
         else
             SafeMpi
-            ( MPI_Reduce
+            ( recorded::Reduce
               ( buf, 0, count, TypeMap<Complex<Real>>(), opC, root, 
                 comm.comm ) );
 #endif
@@ -2037,7 +2336,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( count, buf, packedRecv );
     SafeMpi
-    ( MPI_Reduce
+    ( recorded::Reduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, root, comm.comm ) );
     if( commRank == root )
@@ -2058,7 +2357,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Allreduce
+        ( recorded::Allreduce
           ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC, 
             comm.comm ) );
     }
@@ -2077,7 +2376,7 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Real>( op );
             SafeMpi
-            ( MPI_Allreduce
+            ( recorded::Allreduce
                 ( const_cast<Complex<Real>*>(sbuf),
                   rbuf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
         }
@@ -2085,14 +2384,14 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
             SafeMpi
-            ( MPI_Allreduce
+            ( recorded::Allreduce
               ( const_cast<Complex<Real>*>(sbuf),
                 rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Allreduce
+        ( recorded::Allreduce
           ( const_cast<Complex<Real>*>(sbuf), 
             rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 #endif
@@ -2114,7 +2413,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( count, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Allreduce
+    ( recorded::Allreduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, rbuf );
@@ -2145,7 +2444,7 @@ EL_NO_RELEASE_EXCEPT
 
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Allreduce
+    ( recorded::Allreduce
       ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm ) );
 }
 
@@ -2162,21 +2461,21 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Allreduce
+        ( recorded::Allreduce
           ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
     }
     else
     {
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Allreduce
+        ( recorded::Allreduce
           ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), 
             opC, comm.comm ) );
     }
 #else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Allreduce
+    ( recorded::Allreduce
       ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
         comm.comm ) );
 #endif
@@ -2196,7 +2495,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( count, buf, packedRecv );
     SafeMpi
-    ( MPI_Allreduce
+    ( recorded::Allreduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, buf );
@@ -2222,7 +2521,7 @@ EL_NO_RELEASE_EXCEPT
 #elif defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( recorded::Reduce_scatter_block
       ( sbuf, rbuf, rc, TypeMap<Real>(), opC, comm.comm ) );
 #else
     const int commSize = Size( comm );
@@ -2249,12 +2548,12 @@ EL_NO_RELEASE_EXCEPT
 # ifdef EL_AVOID_COMPLEX_MPI
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( recorded::Reduce_scatter_block
       ( sbuf, rbuf, 2*rc, TypeMap<Real>(), opC, comm.comm ) );
 # else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( recorded::Reduce_scatter_block
       ( sbuf, rbuf, rc, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 # endif
 #else
@@ -2283,7 +2582,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( recorded::Reduce_scatter_block
       ( packedSend.data(), packedRecv.data(), rc, TypeMap<T>(),
         opC, comm.comm ) );
 
@@ -2326,7 +2625,7 @@ EL_NO_RELEASE_EXCEPT
 #elif defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( recorded::Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<Real>(), opC, comm.comm ) );
 #else
     const int commSize = Size( comm );
@@ -2354,12 +2653,12 @@ EL_NO_RELEASE_EXCEPT
 # ifdef EL_AVOID_COMPLEX_MPI
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( recorded::Reduce_scatter_block
       ( MPI_IN_PLACE, buf, 2*rc, TypeMap<Real>(), opC, comm.comm ) );
 # else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( recorded::Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 # endif
 #else
@@ -2388,7 +2687,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, buf, packedRecv );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( recorded::Reduce_scatter_block
       ( packedSend.data(), packedRecv.data(), rc, TypeMap<T>(),
         opC, comm.comm ) );
 
@@ -2412,7 +2711,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_CSE
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter
+    ( recorded::Reduce_scatter
       ( const_cast<Real*>(sbuf), 
         rbuf, const_cast<int*>(rcs), TypeMap<Real>(), opC, comm.comm ) );
 }
@@ -2434,7 +2733,7 @@ EL_NO_RELEASE_EXCEPT
         for( int i=0; i<p; ++i )
             rcsDoubled[i] = 2*rcs[i];
         SafeMpi
-        ( MPI_Reduce_scatter
+        ( recorded::Reduce_scatter
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, rcsDoubled.data(), TypeMap<Real>(), opC, comm.comm ) );
     }
@@ -2442,7 +2741,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Reduce_scatter
+        ( recorded::Reduce_scatter
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, const_cast<int*>(rcs), TypeMap<Complex<Real>>(), 
             opC, comm.comm ) );
@@ -2450,7 +2749,7 @@ EL_NO_RELEASE_EXCEPT
 #else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Reduce_scatter
+    ( recorded::Reduce_scatter
       ( const_cast<Complex<Real>*>(sbuf), 
         rbuf, const_cast<int*>(rcs), TypeMap<Complex<Real>>(), opC, 
         comm.comm ) );
@@ -2475,7 +2774,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Reduce_scatter
+    ( recorded::Reduce_scatter
       ( packedSend.data(), packedRecv.data(), const_cast<int*>(rcs),
         TypeMap<T>(), opC, comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
@@ -2512,7 +2811,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Scan
+        ( recorded::Scan
           ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
             opC, comm.comm ) );
     }
@@ -2532,7 +2831,7 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Real>( op );
             SafeMpi
-            ( MPI_Scan
+            ( recorded::Scan
               ( const_cast<Complex<Real>*>(sbuf),
                 rbuf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
         }
@@ -2540,14 +2839,14 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
             SafeMpi
-            ( MPI_Scan
+            ( recorded::Scan
               ( const_cast<Complex<Real>*>(sbuf),
                 rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Scan
+        ( recorded::Scan
           ( const_cast<Complex<Real>*>(sbuf), 
             rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 #endif
@@ -2567,7 +2866,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, sbuf, packedSend );
     ReserveSerialized( count, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Scan
+    ( recorded::Scan
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, rbuf );
@@ -2605,7 +2904,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Scan
+        ( recorded::Scan
           ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm ) );
     }
 }
@@ -2622,21 +2921,21 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Real>( op );
             SafeMpi
-            ( MPI_Scan
+            ( recorded::Scan
               ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
         }
         else
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
             SafeMpi
-            ( MPI_Scan
+            ( recorded::Scan
               ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
                 comm.comm ) );
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Scan
+        ( recorded::Scan
           ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
             comm.comm ) );
 #endif
@@ -2656,7 +2955,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, buf, packedSend );
     ReserveSerialized( count, buf, packedRecv );
     SafeMpi
-    ( MPI_Scan
+    ( recorded::Scan
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, buf );
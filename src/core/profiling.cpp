@@ -0,0 +1,316 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <cstring>
+#include <iomanip>
+
+namespace {
+using namespace El;
+
+struct Region
+{
+    const char* key;
+    string name;
+    Int parent;
+    vector<Int> children;
+
+    Int numCalls=0;
+    double time=0, flops=0, bytes=0;
+};
+
+struct Event
+{
+    Int region;
+    double start, stop;
+};
+
+// The first region is the (unreported) root of the tree
+vector<Region> regions(1);
+Int current = 0;
+vector<double> startTimes;
+vector<Int> openEvents;
+
+bool tracing = false;
+Int maxEvents = 0;
+vector<Event> events;
+
+Clock::time_point origin = Clock::now();
+
+double Now()
+{ return duration<double>(Clock::now()-origin).count(); }
+
+bool OnMainThread()
+{ return ThreadNum() == 0; }
+
+Int Child( Int parent, const char* name )
+{
+    // Most names are string literals, so try pointer comparisons first
+    for( Int child : regions[parent].children )
+        if( regions[child].key == name )
+            return child;
+    for( Int child : regions[parent].children )
+        if( std::strcmp( regions[child].name.c_str(), name ) == 0 )
+            return child;
+
+    Region region;
+    region.key = name;
+    region.name = name;
+    region.parent = parent;
+    regions.push_back( region );
+    const Int child = regions.size()-1;
+    regions[parent].children.push_back( child );
+    return child;
+}
+
+string EscapeJSON( const string& str )
+{
+    string escaped;
+    for( const char c : str )
+    {
+        if( c == '"' || c == '\\' )
+        {
+            escaped += '\\';
+            escaped += c;
+        }
+        else if( c == '\n' )
+            escaped += "\\n";
+        else if( c == '\t' )
+            escaped += "\\t";
+        else
+            escaped += c;
+    }
+    return escaped;
+}
+
+const Int numStats = 4;
+
+void StatsJSON( ostream& os, const char* label, const double* stats )
+{
+    os << "\"" << label << "\":{\"min\":" << stats[0]
+       << ",\"max\":" << stats[1] << ",\"avg\":" << stats[2] << "}";
+}
+
+void RegionJSON
+( ostream& os, Int region, const vector<Int>& reported,
+  const vector<double>& mins, const vector<double>& maxs,
+  const vector<double>& avgs, Int indent )
+{
+    const string pad( indent, ' ' );
+    const Int k = reported[region];
+    double calls[3] = { mins[numStats*k+0], maxs[numStats*k+0],
+                        avgs[numStats*k+0] };
+    double times[3] = { mins[numStats*k+1], maxs[numStats*k+1],
+                        avgs[numStats*k+1] };
+    double flops[3] = { mins[numStats*k+2], maxs[numStats*k+2],
+                        avgs[numStats*k+2] };
+    double bytes[3] = { mins[numStats*k+3], maxs[numStats*k+3],
+                        avgs[numStats*k+3] };
+    os << pad << "{\"name\":\"" << EscapeJSON(regions[region].name) << "\",";
+    StatsJSON( os, "calls", calls ); os << ",";
+    StatsJSON( os, "time", times ); os << ",";
+    StatsJSON( os, "flops", flops ); os << ",";
+    StatsJSON( os, "bytes", bytes ); os << ",\n";
+    os << pad << " \"children\":[";
+    const auto& children = regions[region].children;
+    for( size_t c=0; c<children.size(); ++c )
+    {
+        os << "\n";
+        RegionJSON( os, children[c], reported, mins, maxs, avgs, indent+2 );
+        if( c+1 < children.size() )
+            os << ",";
+    }
+    os << "]}";
+}
+
+} // anonymous namespace
+
+namespace El {
+
+namespace profiling {
+bool enabled = false;
+}
+
+void EnableProfiling( bool trace, Int maxTraceEvents )
+{
+    profiling::enabled = true;
+    ::tracing = trace;
+    ::maxEvents = maxTraceEvents;
+}
+
+void DisableProfiling()
+{ profiling::enabled = false; }
+
+void ResetProfile()
+{
+    ::regions.clear();
+    ::regions.resize( 1 );
+    ::current = 0;
+    ::startTimes.clear();
+    ::openEvents.clear();
+    ::events.clear();
+}
+
+void PushProfileRegion( const char* name )
+{
+    if( !OnMainThread() )
+        return;
+    ::current = Child( ::current, name );
+    const double start = Now();
+    ::startTimes.push_back( start );
+    if( ::tracing && Int(::events.size()) < ::maxEvents )
+    {
+        ::openEvents.push_back( ::events.size() );
+        ::events.push_back( Event{::current,start,start} );
+    }
+    else
+        ::openEvents.push_back( -1 );
+}
+
+void PopProfileRegion()
+{
+    if( !OnMainThread() )
+        return;
+    // Regions which were open when the profile was reset are ignored
+    if( ::startTimes.empty() )
+        return;
+    const double stop = Now();
+    Region& region = ::regions[::current];
+    ++region.numCalls;
+    region.time += stop - ::startTimes.back();
+    if( ::openEvents.back() >= 0 )
+        ::events[::openEvents.back()].stop = stop;
+    ::startTimes.pop_back();
+    ::openEvents.pop_back();
+    ::current = region.parent;
+}
+
+void AddProfileFlops( double flops )
+{
+    if( Profiling() && OnMainThread() )
+        ::regions[::current].flops += flops;
+}
+
+void AddProfileBytes( double bytes )
+{
+    if( Profiling() && OnMainThread() )
+        ::regions[::current].bytes += bytes;
+}
+
+const string& CurrentProfileRegion()
+{ return ::regions[::current].name; }
+
+void WriteProfileJSON( const string filename, mpi::Comm comm )
+{
+    DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    // Serialize the paths of the root's regions (in pre-order) as a sequence
+    // of parent indices and names
+    string paths;
+    if( commRank == 0 )
+    {
+        ostringstream os;
+        for( size_t r=1; r<::regions.size(); ++r )
+            os << ::regions[r].parent << " " << ::regions[r].name << "\n";
+        paths = os.str();
+    }
+    int pathsSize = paths.size();
+    mpi::Broadcast( pathsSize, 0, comm );
+    vector<byte> pathsBuf( pathsSize );
+    if( commRank == 0 )
+        MemCopy( pathsBuf.data(), (const byte*)paths.data(), pathsSize );
+    mpi::Broadcast( pathsBuf.data(), pathsSize, 0, comm );
+
+    // Find the statistics of each of the root's regions on this process
+    std::istringstream is( string(pathsBuf.begin(),pathsBuf.end()) );
+    vector<Int> local(1,0);
+    vector<double> stats;
+    Int parent;
+    string name;
+    while( is >> parent )
+    {
+        is.get();
+        std::getline( is, name );
+        Int region = -1;
+        if( local[parent] >= 0 )
+            for( Int child : ::regions[local[parent]].children )
+                if( ::regions[child].name == name )
+                    region = child;
+        local.push_back( region );
+        if( region >= 0 )
+        {
+            stats.push_back( ::regions[region].numCalls );
+            stats.push_back( ::regions[region].time );
+            stats.push_back( ::regions[region].flops );
+            stats.push_back( ::regions[region].bytes );
+        }
+        else
+            stats.insert( stats.end(), numStats, 0. );
+    }
+
+    const int numValues = stats.size();
+    vector<double> mins(numValues), maxs(numValues), avgs(numValues);
+    mpi::AllReduce( stats.data(), mins.data(), numValues, mpi::MIN, comm );
+    mpi::AllReduce( stats.data(), maxs.data(), numValues, mpi::MAX, comm );
+    mpi::AllReduce( stats.data(), avgs.data(), numValues, mpi::SUM, comm );
+    for( auto& avg : avgs )
+        avg /= commSize;
+
+    if( commRank == 0 )
+    {
+        // On the root, region r (r >= 1) is the (r-1)'th reported region
+        vector<Int> reported( ::regions.size() );
+        for( size_t r=1; r<::regions.size(); ++r )
+            reported[r] = r-1;
+
+        std::ofstream file( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        file << std::setprecision(12);
+        file << "{\"numProcesses\":" << commSize << ",\n \"regions\":[";
+        const auto& children = ::regions[0].children;
+        for( size_t c=0; c<children.size(); ++c )
+        {
+            file << "\n";
+            RegionJSON( file, children[c], reported, mins, maxs, avgs, 2 );
+            if( c+1 < children.size() )
+                file << ",";
+        }
+        file << "]}\n";
+    }
+}
+
+void WriteProfileTrace( const string basename )
+{
+    DEBUG_CSE
+    const int rank = mpi::Rank( mpi::COMM_WORLD );
+    const string filename = BuildString(basename,"-",rank,".json");
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    // Complete ("X") events with microsecond timestamps
+    file << std::fixed << std::setprecision(3);
+    file << "{\"traceEvents\":[";
+    bool first = true;
+    for( const auto& event : ::events )
+    {
+        if( !first )
+            file << ",";
+        first = false;
+        file << "\n{\"name\":\"" << EscapeJSON(::regions[event.region].name)
+             << "\",\"ph\":\"X\",\"pid\":" << rank << ",\"tid\":0"
+             << ",\"ts\":" << 1e6*event.start
+             << ",\"dur\":" << 1e6*(event.stop-event.start) << "}";
+    }
+    file << "]}\n";
+}
+
+} // namespace El
@@ -17,6 +17,12 @@ std::mt19937 generator;
 gmp_randstate_t gmpRandState;
 #endif
 
+// The state of the counter-based generator: a seed shared by all processes
+// and separate sequence numbers for process-local and collective fills
+std::uint32_t counterSeed = 0;
+std::uint32_t localStream = 0;
+std::uint32_t distStream = 0;
+
 }
 
 namespace El {
@@ -31,6 +37,8 @@ void InitializeRandom( bool deterministic )
 
     srand( seed );
 
+    SetCounterSeed( std::uint32_t(secs) );
+
 #ifdef EL_HAVE_MPC
     mpfr::SetMinIntBits( 256 );
     mpfr::SetPrecision( 256 );
@@ -49,6 +57,39 @@ void FinalizeRandom()
 std::mt19937& Generator()
 { return ::generator; }
 
+std::uint32_t CounterSeed()
+{ return ::counterSeed; }
+
+void SetCounterSeed( std::uint32_t seed )
+{
+    ::counterSeed = seed;
+    ::localStream = 0;
+    ::distStream = 0;
+}
+
+PhiloxKey LocalCounterKey()
+{
+    // Decorrelate the processes by mixing the rank into the seed
+    const std::uint32_t rank = mpi::Rank( mpi::COMM_WORLD );
+    PhiloxKey key;
+    key[0] = ::counterSeed ^ ((rank+1)*0x9E3779B9u);
+    key[1] = ::localStream++;
+    return key;
+}
+
+PhiloxKey DistCounterKey( mpi::Comm comm )
+{
+    DEBUG_CSE
+    // Agree upon the seed and sequence number of the root process
+    std::uint32_t state[2] = { ::counterSeed, ::distStream };
+    mpi::Broadcast( state, 2, 0, comm );
+    ::distStream = state[1]+1;
+    PhiloxKey key;
+    key[0] = state[0];
+    key[1] = state[1];
+    return key;
+}
+
 #ifdef EL_HAVE_MPC
 namespace mpfr {
 
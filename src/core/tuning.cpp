@@ -0,0 +1,256 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <cctype>
+#include <map>
+
+namespace {
+using namespace El;
+
+struct Key
+{
+    string routine, type;
+    int gridHeight, gridWidth;
+    string param;
+};
+
+bool operator<( const Key& a, const Key& b )
+{
+    if( a.routine != b.routine ) return a.routine < b.routine;
+    if( a.type != b.type ) return a.type < b.type;
+    if( a.gridHeight != b.gridHeight ) return a.gridHeight < b.gridHeight;
+    if( a.gridWidth != b.gridWidth ) return a.gridWidth < b.gridWidth;
+    return a.param < b.param;
+}
+
+// For each key, the value of the parameter for each vector of size buckets
+std::map<Key,std::map<vector<Int>,Int>> table;
+
+// The largest one-norm distance between size buckets for which an entry
+// may stand in for a problem
+const Int maxTuningDist = 2;
+
+vector<Int> Buckets( const vector<Int>& dims )
+{
+    vector<Int> buckets( dims.size() );
+    for( size_t j=0; j<dims.size(); ++j )
+    {
+        Int bucket = 0;
+        for( Int dim=dims[j]; dim>1; dim/=2 )
+            ++bucket;
+        buckets[j] = bucket;
+    }
+    return buckets;
+}
+
+Key MakeKey
+( const string& routine, const string& type, int gridHeight, int gridWidth,
+  const string& param )
+{
+    Key key;
+    key.routine = routine;
+    key.type = type;
+    key.gridHeight = gridHeight;
+    key.gridWidth = gridWidth;
+    key.param = param;
+    return key;
+}
+
+// Types such as "Complex<double>" contain no whitespace, but guard against
+// others which might
+string Token( const string& str )
+{
+    string token = str;
+    for( auto& c : token )
+        if( std::isspace(c) )
+            c = '_';
+    return token;
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void SetTuningParameter
+( const string& routine, const string& type, const Grid& g,
+  const vector<Int>& dims, const string& param, Int value )
+{
+    DEBUG_CSE
+    const Key key =
+      MakeKey( Token(routine), Token(type), g.Height(), g.Width(), param );
+    ::table[key][Buckets(dims)] = value;
+}
+
+bool TuningParameter
+( const string& routine, const string& type, const Grid& g,
+  const vector<Int>& dims, const string& param, Int& value )
+{
+    DEBUG_CSE
+    if( ::table.empty() )
+        return false;
+    const Key key =
+      MakeKey( Token(routine), Token(type), g.Height(), g.Width(), param );
+    auto it = ::table.find( key );
+    if( it == ::table.end() )
+        return false;
+
+    // Use the entry with the nearest buckets (in the one-norm), provided that
+    // it is within maxTuningDist buckets, as tuned choices rarely carry over
+    // to problems which are orders of magnitude larger or smaller
+    const vector<Int> buckets = Buckets( dims );
+    Int bestDist = -1;
+    for( const auto& entry : it->second )
+    {
+        if( entry.first.size() != buckets.size() )
+            continue;
+        Int dist = 0;
+        for( size_t j=0; j<buckets.size(); ++j )
+            dist += Abs(entry.first[j]-buckets[j]);
+        if( dist > maxTuningDist )
+            continue;
+        if( bestDist < 0 || dist < bestDist )
+        {
+            bestDist = dist;
+            value = entry.second;
+        }
+    }
+    return bestDist >= 0;
+}
+
+void ClearTuning()
+{ ::table.clear(); }
+
+void LoadTuning( const string filename, mpi::Comm comm )
+{
+    DEBUG_CSE
+    string contents;
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::ifstream file( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        ostringstream os;
+        os << file.rdbuf();
+        contents = os.str();
+    }
+    int size = contents.size();
+    mpi::Broadcast( size, 0, comm );
+    vector<byte> buf( size );
+    if( mpi::Rank(comm) == 0 )
+        MemCopy( buf.data(), (const byte*)contents.data(), size );
+    mpi::Broadcast( buf.data(), size, 0, comm );
+
+    std::istringstream is( string(buf.begin(),buf.end()) );
+    string line;
+    while( std::getline( is, line ) )
+    {
+        if( line.empty() || line[0] == '#' )
+            continue;
+        std::istringstream lineStream( line );
+        Key key;
+        Int numDims;
+        lineStream >> key.routine >> key.type
+                   >> key.gridHeight >> key.gridWidth >> numDims;
+        vector<Int> buckets( Max(numDims,Int(0)) );
+        for( auto& bucket : buckets )
+            lineStream >> bucket;
+        Int value;
+        lineStream >> key.param >> value;
+        if( !lineStream )
+            RuntimeError("Invalid tuning entry: ",line);
+        ::table[key][buckets] = value;
+    }
+}
+
+void SaveTuning( const string filename, mpi::Comm comm )
+{
+    DEBUG_CSE
+    if( mpi::Rank(comm) != 0 )
+        return;
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "# routine type gridHeight gridWidth numDims buckets param value\n";
+    for( const auto& keyEntries : ::table )
+    {
+        const Key& key = keyEntries.first;
+        for( const auto& entry : keyEntries.second )
+        {
+            file << key.routine << " " << key.type << " "
+                 << key.gridHeight << " " << key.gridWidth << " "
+                 << entry.first.size();
+            for( const Int bucket : entry.first )
+                file << " " << bucket;
+            file << " " << key.param << " " << entry.second << "\n";
+        }
+    }
+}
+
+template<typename T>
+Int TunedBlocksize( const string& routine, const Grid& g, Int n )
+{
+    Int blocksize;
+    const string type = TypeName<T>();
+    if( TuningParameter( routine, type, g, {n}, "blocksize", blocksize ) )
+        return blocksize;
+    return Blocksize();
+}
+
+double TuningTime( const Grid& g, function<void()> run, Int numReps )
+{
+    DEBUG_CSE
+    double minTime = -1;
+    Timer timer;
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        run();
+        const double localTime = timer.Stop();
+        const double time = mpi::AllReduce( localTime, mpi::MAX, g.Comm() );
+        if( minTime < 0 || time < minTime )
+            minTime = time;
+    }
+    return minTime;
+}
+
+Int TuneBlocksize
+( const string& routine, const string& type, const Grid& g, Int n,
+  const vector<Int>& candidates, function<void()> run, Int numReps )
+{
+    DEBUG_CSE
+    if( candidates.empty() )
+        LogicError("No candidate blocksizes were given");
+    Int bestBlocksize = candidates[0];
+    double bestTime = -1;
+    for( const Int blocksize : candidates )
+    {
+        SetTuningParameter( routine, type, g, {n}, "blocksize", blocksize );
+        const double time = TuningTime( g, run, numReps );
+        if( bestTime < 0 || time < bestTime )
+        {
+            bestTime = time;
+            bestBlocksize = blocksize;
+        }
+    }
+    SetTuningParameter( routine, type, g, {n}, "blocksize", bestBlocksize );
+    return bestBlocksize;
+}
+
+#define PROTO(T) \
+  template Int TunedBlocksize<T>( const string& routine, const Grid& g, Int n );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
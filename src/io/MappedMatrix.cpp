@@ -0,0 +1,142 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#ifdef EL_HAVE_MMAP
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace El {
+
+template<typename T>
+MappedMatrix<T>::MappedMatrix
+( const string filename, FileFormat format, Int height, Int width )
+{
+    DEBUG_CSE
+    MapRead( filename, format, height, width );
+}
+
+template<typename T>
+MappedMatrix<T>::~MappedMatrix()
+{ Unmap(); }
+
+template<typename T>
+void MappedMatrix<T>::MapRead
+( const string filename, FileFormat format, Int height, Int width )
+{
+    DEBUG_CSE
+    if( format == AUTO )
+        format = DetectFormat( filename );
+    if( format != BINARY && format != BINARY_FLAT )
+        LogicError("Only BINARY and BINARY_FLAT files can be mapped");
+    if( !IsPacked<T>::value )
+        LogicError("Only packed datatypes can be mapped");
+    Unmap();
+
+#ifdef EL_HAVE_MMAP
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd == -1 )
+        RuntimeError("Could not open ",filename);
+    struct stat fileStat;
+    if( fstat( fd, &fileStat ) == -1 )
+    {
+        close( fd );
+        RuntimeError("Could not determine the size of ",filename);
+    }
+    const Int numBytes = fileStat.st_size;
+    void* map = nullptr;
+    if( numBytes > 0 )
+    {
+        map = mmap( nullptr, numBytes, PROT_READ, MAP_SHARED, fd, 0 );
+        if( map == MAP_FAILED )
+        {
+            close( fd );
+            RuntimeError("Could not map ",filename);
+        }
+    }
+    // The mapping remains valid after the descriptor is closed
+    close( fd );
+
+    // The payload directly follows the (two-integer) header for the BINARY
+    // format
+    Int metaBytes = 0;
+    if( format == BINARY )
+    {
+        metaBytes = 2*sizeof(Int);
+        if( numBytes < metaBytes )
+        {
+            if( map != nullptr )
+                munmap( map, numBytes );
+            RuntimeError("File ",filename," is missing its header");
+        }
+        const Int* header = static_cast<const Int*>(map);
+        height = header[0];
+        width = header[1];
+    }
+    const Int numBytesExp = metaBytes + height*width*sizeof(T);
+    if( numBytes != numBytesExp )
+    {
+        if( map != nullptr )
+            munmap( map, numBytes );
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
+
+    if( metaBytes % alignof(T) != 0 )
+    {
+        // The payload of the mapping would be misaligned (e.g., for 16-byte
+        // scalars with 32-bit integers), so fall back to reading a copy
+        if( map != nullptr )
+            munmap( map, numBytes );
+        if( format == BINARY_FLAT )
+            A_.Resize( height, width );
+        Read( A_, filename, format );
+        return;
+    }
+
+    map_ = map;
+    mapSize_ = numBytes;
+    const T* buffer =
+      ( map == nullptr ? nullptr :
+        reinterpret_cast<const T*>(static_cast<const char*>(map)+metaBytes) );
+    A_.LockedAttach( height, width, buffer, Max(height,1) );
+#else
+    // Fall back to reading a copy of the file
+    if( format == BINARY_FLAT )
+        A_.Resize( height, width );
+    Read( A_, filename, format );
+#endif
+}
+
+template<typename T>
+void MappedMatrix<T>::Unmap()
+{
+    DEBUG_CSE
+    A_.Empty();
+#ifdef EL_HAVE_MMAP
+    if( map_ != nullptr )
+        munmap( map_, mapSize_ );
+#endif
+    map_ = nullptr;
+    mapSize_ = 0;
+}
+
+#define PROTO(T) template class MappedMatrix<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -83,11 +83,12 @@ void Print( const Graph& graph, string msg, ostream& os )
     graph.AssertConsistent();
     if( msg != "" )
         os << msg << endl;
-    const Int numEdges = graph.NumEdges();
-    const Int* srcBuf = graph.LockedSourceBuffer();
+    const Int numSources = graph.NumSources();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
     const Int* tgtBuf = graph.LockedTargetBuffer();
-    for( Int e=0; e<numEdges; ++e )
-        os << srcBuf[e] << " " << tgtBuf[e] << "\n";
+    for( Int s=0; s<numSources; ++s )
+        for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+            os << s << " " << tgtBuf[e] << "\n";
     os << endl;
 }
 
@@ -119,12 +120,13 @@ void Print( const SparseMatrix<T>& A, string msg, ostream& os )
 
     ConfigurePrecision<T>( os );
 
-    const Int numEntries = A.NumEntries();
-    const Int* srcBuf = A.LockedSourceBuffer();
+    const Int numSources = A.Height();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
     const Int* tgtBuf = A.LockedTargetBuffer();
     const T* valBuf = A.LockedValueBuffer();
-    for( Int s=0; s<numEntries; ++s )
-        os << srcBuf[s] << " " << tgtBuf[s] << " " << valBuf[s] << "\n";
+    for( Int s=0; s<numSources; ++s )
+        for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+            os << s << " " << tgtBuf[e] << " " << valBuf[e] << "\n";
     os << endl;
 }
 
@@ -40,6 +40,30 @@ Binary( Matrix<T>& A, const string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
+// Read the locally-owned columns of a matrix whose columns are not
+// distributed, so that each local column is a contiguous block of the file
+template<typename T>
+inline void
+LocalColumns
+( std::ifstream& file, std::streamoff metaBytes, AbstractDistMatrix<T>& A )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( A.ColStride() != 1 )
+          LogicError("Columns of A must not be distributed");
+    )
+    const Int height = A.Height();
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int localIndex = j*height;
+        const std::streamoff pos = metaBytes + localIndex*sizeof(T);
+        file.seekg( pos );
+        file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
+    }
+}
+
 template<typename T>
 inline void
 Binary( AbstractDistMatrix<T>& A, const string filename )
@@ -61,10 +85,10 @@ Binary( AbstractDistMatrix<T>& A, const string filename )
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
 
     A.Resize( height, width );
-    if( A.CrossRank() != A.Root() )
-        return;
     if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
+        if( A.CrossRank() != A.Root() )
+            return;
         if( A.Height() == A.LDim() )
             file.read( (char*)A.Buffer(), height*width*sizeof(T) );
         else
@@ -73,32 +97,18 @@ Binary( AbstractDistMatrix<T>& A, const string filename )
     }
     else if( A.ColStride() == 1 )
     {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
+        LocalColumns( file, metaBytes, A );
     }
     else
     {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
+        // Rather than seeking to each individual entry, have every process
+        // read whole (contiguous) columns in a [STAR,VR] distribution and then
+        // redistribute
+        DistMatrix<T,STAR,VR> A_STAR_VR( A.Grid() );
+        A_STAR_VR.Resize( height, width );
+        LocalColumns( file, metaBytes, A_STAR_VR );
+        file.close();
+        Copy( A_STAR_VR, A );
     }
 }
 
@@ -9,6 +9,8 @@
 #ifndef EL_READ_BINARYFLAT_HPP
 #define EL_READ_BINARYFLAT_HPP
 
+#include "./Binary.hpp"
+
 namespace El {
 namespace read {
 
@@ -65,32 +67,16 @@ BinaryFlat
     }
     else if( A.ColStride() == 1 )
     {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
+        LocalColumns( file, 0, A );
     }
     else
     {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
+        // See read::Binary
+        DistMatrix<T,STAR,VR> A_STAR_VR( A.Grid() );
+        A_STAR_VR.Resize( height, width );
+        LocalColumns( file, 0, A_STAR_VR );
+        file.close();
+        Copy( A_STAR_VR, A );
     }
 }
 
@@ -54,6 +54,10 @@ void Write
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
     }
+    else if( format == BINARY )
+        write::Binary( A, basename );
+    else if( format == BINARY_FLAT )
+        write::BinaryFlat( A, basename );
     else
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
@@ -35,6 +35,65 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Write the locally-owned columns of a matrix whose columns are not
+// distributed into their (contiguous) positions within an existing file
+template<typename T>
+inline void
+LocalColumns
+( const string filename, std::streamoff metaBytes,
+  const AbstractDistMatrix<T>& A )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( A.ColStride() != 1 )
+          LogicError("Columns of A must not be distributed");
+    )
+    const Int height = A.Height();
+    const Int localWidth = A.LocalWidth();
+    if( localWidth == 0 )
+        return;
+    std::fstream file
+    ( filename.c_str(), std::ios::binary | std::ios::in | std::ios::out );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int localIndex = j*height;
+        const std::streamoff pos = metaBytes + localIndex*sizeof(T);
+        file.seekp( pos );
+        file.write( (char*)A.LockedBuffer(0,jLoc), height*sizeof(T) );
+    }
+}
+
+// Each process writes whole (contiguous) columns of a [STAR,VR] copy of the
+// matrix rather than funneling the entire matrix through a single process
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_CSE
+    DistMatrix<T,STAR,VR> A_STAR_VR( A );
+    const Grid& g = A_STAR_VR.Grid();
+
+    string filename = basename + "." + FileExtension(BINARY);
+    const std::streamoff metaBytes = 2*sizeof(Int);
+    if( g.ViewingRank() == 0 )
+    {
+        ofstream file( filename.c_str(), std::ios::binary );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        Int n;
+        n = A.Height();
+        file.write( (char*)&n, sizeof(Int) );
+        n = A.Width();
+        file.write( (char*)&n, sizeof(Int) );
+    }
+    mpi::Barrier( g.ViewingComm() );
+    LocalColumns( filename, metaBytes, A_STAR_VR );
+    mpi::Barrier( g.ViewingComm() );
+}
+
 } // namespace write
 } // namespace El
 
@@ -9,6 +9,8 @@
 #ifndef EL_WRITE_BINARYFLAT_HPP
 #define EL_WRITE_BINARYFLAT_HPP
 
+#include "./Binary.hpp"
+
 namespace El {
 namespace write {
 
@@ -30,6 +32,27 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// See write::Binary
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_CSE
+    DistMatrix<T,STAR,VR> A_STAR_VR( A );
+    const Grid& g = A_STAR_VR.Grid();
+
+    string filename = basename + "." + FileExtension(BINARY_FLAT);
+    if( g.ViewingRank() == 0 )
+    {
+        ofstream file( filename.c_str(), std::ios::binary );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+    }
+    mpi::Barrier( g.ViewingComm() );
+    LocalColumns( filename, 0, A_STAR_VR );
+    mpi::Barrier( g.ViewingComm() );
+}
+
 } // namespace write
 } // namespace El
 
@@ -19,6 +19,8 @@ ElError ElHermitianTridiagCtrlDefault_s( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_s( &ctrl->symvCtrl );
+    ctrl->twoStage = false;
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagCtrlDefault_d( ElHermitianTridiagCtrl* ctrl )
@@ -26,6 +28,8 @@ ElError ElHermitianTridiagCtrlDefault_d( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_d( &ctrl->symvCtrl );
+    ctrl->twoStage = false;
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagCtrlDefault_c( ElHermitianTridiagCtrl* ctrl )
@@ -33,6 +37,8 @@ ElError ElHermitianTridiagCtrlDefault_c( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_c( &ctrl->symvCtrl );
+    ctrl->twoStage = false;
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagCtrlDefault_z( ElHermitianTridiagCtrl* ctrl )
@@ -40,6 +46,8 @@ ElError ElHermitianTridiagCtrlDefault_z( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_z( &ctrl->symvCtrl );
+    ctrl->twoStage = false;
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 
@@ -104,6 +112,16 @@ ElError ElHermitianTridiagCtrlDefault_z( ElHermitianTridiagCtrl* ctrl )
   ( ElUpperOrLower uplo, ElDistMatrix_ ## SIG A, ElDistMatrix_ ## SIG t ) \
   { EL_TRY( HermitianTridiag( \
       CReflect(uplo), *CReflect(A), *CReflect(t) ) ) } \
+  ElError ElHermitianTridiagX_ ## SIG \
+  ( ElUpperOrLower uplo, ElMatrix_ ## SIG A, ElMatrix_ ## SIG t, \
+    ElHermitianTridiagCtrl ctrl ) \
+  { EL_TRY( HermitianTridiag( \
+      CReflect(uplo), *CReflect(A), *CReflect(t), CReflect<F>(ctrl) ) ) } \
+  ElError ElHermitianTridiagXDist_ ## SIG \
+  ( ElUpperOrLower uplo, ElDistMatrix_ ## SIG A, ElDistMatrix_ ## SIG t, \
+    ElHermitianTridiagCtrl ctrl ) \
+  { EL_TRY( HermitianTridiag( \
+      CReflect(uplo), *CReflect(A), *CReflect(t), CReflect<F>(ctrl) ) ) } \
   /* Return only the condensed form */ \
   ElError ElHermitianTridiagOnly_ ## SIG \
   ( ElUpperOrLower uplo, ElMatrix_ ## SIG A ) \
@@ -113,20 +131,45 @@ ElError ElHermitianTridiagCtrlDefault_z( ElHermitianTridiagCtrl* ctrl )
   ( ElUpperOrLower uplo, ElDistMatrix_ ## SIG A ) \
   { EL_TRY( herm_tridiag::ExplicitCondensed \
       ( CReflect(uplo), *CReflect(A) ) ) } \
+  ElError ElHermitianTridiagOnlyX_ ## SIG \
+  ( ElUpperOrLower uplo, ElMatrix_ ## SIG A, ElHermitianTridiagCtrl ctrl ) \
+  { EL_TRY( herm_tridiag::ExplicitCondensed \
+      ( CReflect(uplo), *CReflect(A), CReflect<F>(ctrl) ) ) } \
+  ElError ElHermitianTridiagOnlyXDist_ ## SIG \
+  ( ElUpperOrLower uplo, ElDistMatrix_ ## SIG A, \
+    ElHermitianTridiagCtrl ctrl ) \
+  { EL_TRY( herm_tridiag::ExplicitCondensed \
+      ( CReflect(uplo), *CReflect(A), CReflect<F>(ctrl) ) ) } \
   /* ApplyQ after HermitianTridiag */ \
   ElError ElApplyQAfterHermitianTridiag_ ## SIG \
   ( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, \
     ElConstMatrix_ ## SIG A, ElConstMatrix_ ## SIG t, ElMatrix_ ## SIG B ) \
   { EL_TRY( herm_tridiag::ApplyQ( \
     CReflect(side), CReflect(uplo), CReflect(orientation), \
-    *CReflect(A), *CReflect(t), *CReflect(B) ) ) } \
+    *CReflect(A), *CReflect(t), *CReflect(B), \
+    HermitianTridiagCtrl<F>() ) ) } \
   ElError ElApplyQAfterHermitianTridiagDist_ ## SIG \
   ( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, \
     ElConstDistMatrix_ ## SIG A, ElConstDistMatrix_ ## SIG t, \
     ElDistMatrix_ ## SIG B ) \
   { EL_TRY( herm_tridiag::ApplyQ( \
     CReflect(side), CReflect(uplo), CReflect(orientation), \
-    *CReflect(A), *CReflect(t), *CReflect(B) ) ) } \
+    *CReflect(A), *CReflect(t), *CReflect(B), \
+    HermitianTridiagCtrl<F>() ) ) } \
+  ElError ElApplyQAfterHermitianTridiagX_ ## SIG \
+  ( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, \
+    ElConstMatrix_ ## SIG A, ElConstMatrix_ ## SIG t, ElMatrix_ ## SIG B, \
+    ElHermitianTridiagCtrl ctrl ) \
+  { EL_TRY( herm_tridiag::ApplyQ( \
+    CReflect(side), CReflect(uplo), CReflect(orientation), \
+    *CReflect(A), *CReflect(t), *CReflect(B), CReflect<F>(ctrl) ) ) } \
+  ElError ElApplyQAfterHermitianTridiagXDist_ ## SIG \
+  ( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, \
+    ElConstDistMatrix_ ## SIG A, ElConstDistMatrix_ ## SIG t, \
+    ElDistMatrix_ ## SIG B, ElHermitianTridiagCtrl ctrl ) \
+  { EL_TRY( herm_tridiag::ApplyQ( \
+    CReflect(side), CReflect(uplo), CReflect(orientation), \
+    *CReflect(A), *CReflect(t), *CReflect(B), CReflect<F>(ctrl) ) ) } \
   /* Hessenberg
      ========== */ \
   /* Packed reduction to Hessenberg form, H := Q^H A Q */ \
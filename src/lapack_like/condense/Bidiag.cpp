@@ -11,6 +11,7 @@
 #include "./Bidiag/Apply.hpp"
 #include "./Bidiag/L.hpp"
 #include "./Bidiag/U.hpp"
+#include "./Bidiag/TwoStage.hpp"
 
 namespace El {
 
@@ -156,6 +157,155 @@ void ExplicitCondensed( ElementalMatrix<F>& A )
     }
 }
 
+template<typename F>
+void TwoStage
+( Matrix<F>& A,
+  Matrix<F>& phaseP,
+  Matrix<F>& phaseQ,
+  Matrix<F>& chase,
+  Int bandwidth )
+{
+    DEBUG_CSE
+    if( A.Height() < A.Width() )
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        TwoStage( AAdj, phaseQ, phaseP, chase, bandwidth );
+        Adjoint( AAdj, A );
+        return;
+    }
+    const Int bw = herm_tridiag::TwoStageBandwidth( A.Width(), bandwidth );
+    TwoStageTall( A, phaseP, phaseQ, chase, bw );
+}
+
+template<typename F>
+void TwoStage
+( ElementalMatrix<F>& APre,
+  ElementalMatrix<F>& phasePPre,
+  ElementalMatrix<F>& phaseQPre,
+  ElementalMatrix<F>& chasePre,
+  Int bandwidth )
+{
+    DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      phasePProx( phasePPre ),
+      phaseQProx( phaseQPre );
+    DistMatrixWriteProxy<F,F,MC,MR> chaseProx( chasePre );
+    auto& A = AProx.Get();
+    auto& phaseP = phasePProx.Get();
+    auto& phaseQ = phaseQProx.Get();
+    auto& chase = chaseProx.Get();
+    if( A.Height() < A.Width() )
+    {
+        DistMatrix<F> AAdj(A.Grid());
+        Adjoint( A, AAdj );
+        const Int bw = herm_tridiag::TwoStageBandwidth( A.Height(), bandwidth );
+        TwoStageTall( AAdj, phaseQ, phaseP, chase, bw );
+        Adjoint( AAdj, A );
+        return;
+    }
+    const Int bw = herm_tridiag::TwoStageBandwidth( A.Width(), bandwidth );
+    TwoStageTall( A, phaseP, phaseQ, chase, bw );
+}
+
+// The left transformation of a wide matrix is the right transformation of the
+// reduction of its adjoint (and vice versa)
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& phase,
+  const Matrix<F>& chase,
+        Matrix<F>& B,
+  Int bandwidth )
+{
+    DEBUG_CSE
+    if( A.Height() < A.Width() )
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        const Int bw = herm_tridiag::TwoStageBandwidth( A.Height(), bandwidth );
+        ApplyPTall( side, orientation, bw, AAdj, phase, chase, B );
+        return;
+    }
+    const Int bw = herm_tridiag::TwoStageBandwidth( A.Width(), bandwidth );
+    ApplyQTall( side, orientation, bw, A, phase, chase, B );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const ElementalMatrix<F>& APre,
+  const ElementalMatrix<F>& phase,
+  const ElementalMatrix<F>& chasePre,
+        ElementalMatrix<F>& B,
+  Int bandwidth )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre ), chaseProx( chasePre );
+    auto& A = AProx.GetLocked();
+    auto& chase = chaseProx.GetLocked();
+    if( A.Height() < A.Width() )
+    {
+        DistMatrix<F> AAdj(A.Grid());
+        Adjoint( A, AAdj );
+        const Int bw = herm_tridiag::TwoStageBandwidth( A.Height(), bandwidth );
+        ApplyPTall( side, orientation, bw, AAdj, phase, chase, B );
+        return;
+    }
+    const Int bw = herm_tridiag::TwoStageBandwidth( A.Width(), bandwidth );
+    ApplyQTall( side, orientation, bw, A, phase, chase, B );
+}
+
+template<typename F>
+void ApplyP
+( LeftOrRight side, Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& phase,
+  const Matrix<F>& chase,
+        Matrix<F>& B,
+  Int bandwidth )
+{
+    DEBUG_CSE
+    if( A.Height() < A.Width() )
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        const Int bw = herm_tridiag::TwoStageBandwidth( A.Height(), bandwidth );
+        ApplyQTall( side, orientation, bw, AAdj, phase, chase, B );
+        return;
+    }
+    const Int bw = herm_tridiag::TwoStageBandwidth( A.Width(), bandwidth );
+    ApplyPTall( side, orientation, bw, A, phase, chase, B );
+}
+
+template<typename F>
+void ApplyP
+( LeftOrRight side, Orientation orientation,
+  const ElementalMatrix<F>& APre,
+  const ElementalMatrix<F>& phase,
+  const ElementalMatrix<F>& chasePre,
+        ElementalMatrix<F>& B,
+  Int bandwidth )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre ), chaseProx( chasePre );
+    auto& A = AProx.GetLocked();
+    auto& chase = chaseProx.GetLocked();
+    if( A.Height() < A.Width() )
+    {
+        DistMatrix<F> AAdj(A.Grid());
+        Adjoint( A, AAdj );
+        const Int bw = herm_tridiag::TwoStageBandwidth( A.Height(), bandwidth );
+        ApplyQTall( side, orientation, bw, AAdj, phase, chase, B );
+        return;
+    }
+    const Int bw = herm_tridiag::TwoStageBandwidth( A.Width(), bandwidth );
+    ApplyPTall( side, orientation, bw, A, phase, chase, B );
+}
+
 } // namespace bidiag
 
 #define PROTO(F) \
@@ -196,7 +346,47 @@ void ExplicitCondensed( ElementalMatrix<F>& A )
   ( LeftOrRight side, Orientation orientation, \
     const ElementalMatrix<F>& A, \
     const ElementalMatrix<F>& phase, \
-          ElementalMatrix<F>& B );
+          ElementalMatrix<F>& B ); \
+  template void bidiag::TwoStage \
+  ( Matrix<F>& A, \
+    Matrix<F>& phaseP, \
+    Matrix<F>& phaseQ, \
+    Matrix<F>& chase, \
+    Int bandwidth ); \
+  template void bidiag::TwoStage \
+  ( ElementalMatrix<F>& A, \
+    ElementalMatrix<F>& phaseP, \
+    ElementalMatrix<F>& phaseQ, \
+    ElementalMatrix<F>& chase, \
+    Int bandwidth ); \
+  template void bidiag::ApplyQ \
+  ( LeftOrRight side, Orientation orientation, \
+    const Matrix<F>& A, \
+    const Matrix<F>& phase, \
+    const Matrix<F>& chase, \
+          Matrix<F>& B, \
+    Int bandwidth ); \
+  template void bidiag::ApplyQ \
+  ( LeftOrRight side, Orientation orientation, \
+    const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& phase, \
+    const ElementalMatrix<F>& chase, \
+          ElementalMatrix<F>& B, \
+    Int bandwidth ); \
+  template void bidiag::ApplyP \
+  ( LeftOrRight side, Orientation orientation, \
+    const Matrix<F>& A, \
+    const Matrix<F>& phase, \
+    const Matrix<F>& chase, \
+          Matrix<F>& B, \
+    Int bandwidth ); \
+  template void bidiag::ApplyP \
+  ( LeftOrRight side, Orientation orientation, \
+    const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& phase, \
+    const ElementalMatrix<F>& chase, \
+          ElementalMatrix<F>& B, \
+    Int bandwidth );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
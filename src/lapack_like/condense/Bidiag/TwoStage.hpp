@@ -0,0 +1,537 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BIDIAG_TWOSTAGE_HPP
+#define EL_BIDIAG_TWOSTAGE_HPP
+
+#include "../HermitianTridiag/TwoStage.hpp"
+
+// The two-stage reduction of an m x n matrix A, with m >= n, first reduces A
+// to upper-triangular band form with bandwidth bw by alternating blocked QR
+// factorizations of column and row panels (so that nearly all of the work is
+// in level-3 updates), then chases the band down to real upper bidiagonal
+// form. On exit
+//
+//  - the main diagonal and superdiagonal of A hold the bidiagonal matrix,
+//  - the Householder vectors of the first stage are stored as in Bidiag,
+//    except that the row reflectors begin on the bw'th superdiagonal, with
+//    their scalars in the n x 1 vector phaseQ and the (n-bw) x 1 vector
+//    phaseP, and
+//  - the n x n matrix 'chase' holds the reflectors of the bulge-chasing
+//    sweeps: those of the left transformation for sweep j are stored in row
+//    j of its strictly upper triangle and those of the right transformation
+//    in column j of its strictly lower triangle (in the same packed format
+//    as for the two-stage Hermitian tridiagonalization).
+//
+// Wide matrices are handled by reducing the adjoint of A.
+
+namespace El {
+namespace bidiag {
+
+// Stage one
+// =========
+
+template<typename F>
+void ReduceToBand
+( Matrix<F>& A, Matrix<F>& phaseP, Matrix<F>& phaseQ, Int bw )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    phaseQ.Resize( n, 1 );
+    phaseP.Resize( Max(n-bw,Int(0)), 1 );
+
+    Matrix<F> phase, ARowAdj;
+    Matrix<Base<F>> signature;
+    for( Int k=0; k<n; k+=bw )
+    {
+        const Int nb = Min(bw,n-k);
+        auto APan = A( IR(k,m),    IR(k,k+nb) );
+        auto A12  = A( IR(k,m),    IR(k+nb,n) );
+
+        // Annihilate below the diagonal of the column panel, undoing the
+        // scaling of R by the signature so that the panel is represented by
+        // pure Householder reflectors
+        QR( APan, phase, signature );
+        auto R = APan( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        auto phaseQPan = phaseQ( IR(k,k+nb), ALL );
+        phaseQPan = phase;
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0, APan, phase, A12 );
+        if( k+nb == n )
+            break;
+
+        // Annihilate beyond the nb'th superdiagonal of the row panel through
+        // a QR factorization of its adjoint
+        auto ARow = A( IR(k,k+nb), IR(k+nb,n) );
+        auto A22  = A( IR(k+nb,m), IR(k+nb,n) );
+        const Int width = n-(k+nb);
+        const Int r = Min(nb,width);
+        Adjoint( ARow, ARowAdj );
+        QR( ARowAdj, phase, signature );
+        auto RAdj = ARowAdj( IR(0,r), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, RAdj );
+        for( Int j=0; j<width; ++j )
+            for( Int i=0; i<nb; ++i )
+                ARow(i,j) = ( j <= i ? Conj(ARowAdj(j,i)) : ARowAdj(j,i) );
+        for( Int i=0; i<r; ++i )
+            phaseP(k+i) = Conj(phase(i));
+        auto phasePPan = phaseP( IR(k,k+r), ALL );
+        ApplyPackedReflectors
+        ( RIGHT, UPPER, HORIZONTAL, FORWARD, UNCONJUGATED, 0,
+          ARow, phasePPan, A22 );
+    }
+}
+
+template<typename F>
+void ReduceToBand
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& phaseP,
+  DistMatrix<F,STAR,STAR>& phaseQ,
+  Int bw )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Grid& g = A.Grid();
+    phaseQ.Resize( n, 1 );
+    phaseP.Resize( Max(n-bw,Int(0)), 1 );
+
+    DistMatrix<F> ARowAdj(g), ARowTrans(g);
+    DistMatrix<F,STAR,STAR> phase(g);
+    DistMatrix<Base<F>,STAR,STAR> signature(g);
+    for( Int k=0; k<n; k+=bw )
+    {
+        const Int nb = Min(bw,n-k);
+        auto APan = A( IR(k,m),    IR(k,k+nb) );
+        auto A12  = A( IR(k,m),    IR(k+nb,n) );
+
+        // Annihilate below the diagonal of the column panel, undoing the
+        // scaling of R by the signature so that the panel is represented by
+        // pure Householder reflectors
+        QR( APan, phase, signature );
+        auto R = APan( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        auto phaseQPan = phaseQ( IR(k,k+nb), ALL );
+        phaseQPan = phase;
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0, APan, phase, A12 );
+        if( k+nb == n )
+            break;
+
+        // Annihilate beyond the nb'th superdiagonal of the row panel through
+        // a QR factorization of its adjoint
+        auto ARow = A( IR(k,k+nb), IR(k+nb,n) );
+        auto A22  = A( IR(k+nb,m), IR(k+nb,n) );
+        const Int width = n-(k+nb);
+        const Int r = Min(nb,width);
+        Adjoint( ARow, ARowAdj );
+        QR( ARowAdj, phase, signature );
+        auto RAdj = ARowAdj( IR(0,r), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, RAdj );
+        Transpose( ARowAdj, ARowTrans );
+        auto& ARowTransLoc = ARowTrans.Matrix();
+        for( Int jLoc=0; jLoc<ARowTrans.LocalWidth(); ++jLoc )
+        {
+            const Int j = ARowTrans.GlobalCol(jLoc);
+            for( Int iLoc=ARowTrans.LocalRowOffset(j);
+                 iLoc<ARowTrans.LocalHeight(); ++iLoc )
+                ARowTransLoc(iLoc,jLoc) = Conj(ARowTransLoc(iLoc,jLoc));
+        }
+        ARow = ARowTrans;
+        for( Int i=0; i<r; ++i )
+            phaseP.SetLocal( k+i, 0, Conj(phase.GetLocal(i,0)) );
+        auto phasePPan = phaseP( IR(k,k+r), ALL );
+        ApplyPackedReflectors
+        ( RIGHT, UPPER, HORIZONTAL, FORWARD, UNCONJUGATED, 0,
+          ARow, phasePPan, A22 );
+    }
+}
+
+// Stage two
+// =========
+
+// Chase the upper band matrix of bandwidth bw stored in W, with
+// W(i-j+2bw-1,j) = A(i,j) for -bw < j-i < 2bw (the bulges extend to the
+// (bw-1)'th subdiagonal and the (2bw-1)'th superdiagonal), down to real upper
+// bidiagonal form.
+//
+// Each step of sweep j annihilates a row beyond its superdiagonal with a
+// reflector from the right acting on the columns [c,c+bw), which fills in
+// below the diagonal of those columns, and then annihilates the fill-in with
+// a reflector from the left acting on the rows [c,c+bw), which creates the
+// bulge for the next step. The left and right reflectors of sweep j are
+// passed to 'storeSweep' packed into vectors of length n-1-j.
+template<typename F>
+void ChaseBand
+( Int bw, Matrix<F>& W,
+  function<void(Int,const Matrix<F>&,const Matrix<F>&)> storeSweep )
+{
+    DEBUG_CSE
+    const Int n = W.Width();
+    const Int ku = 2*bw-1;
+    auto entry = [&]( Int i, Int j ) -> F& { return W(i-j+ku,j); };
+
+    F chi;
+    Matrix<F> x, v, w, y, block, sweepQ, sweepP;
+    for( Int j=0; j<n-1; ++j )
+    {
+        sweepQ.Resize( n-1-j, 1 );
+        sweepP.Resize( n-1-j, 1 );
+        for( Int c=j+1; c<n; c+=bw )
+        {
+            const Int len = Min(bw,n-c);
+            const Int r = ( c == j+1 ? j : c-bw );
+
+            // Annihilate all but the first entry of row r within the columns
+            chi = entry(r,c);
+            x.Resize( len-1, 1 );
+            for( Int t=1; t<len; ++t )
+                x(t-1) = entry(r,c+t);
+            const F tauP = RightReflector( chi, x );
+            entry(r,c) = chi;
+            for( Int t=1; t<len; ++t )
+                entry(r,c+t) = 0;
+            w.Resize( len, 1 );
+            w(0) = 1;
+            for( Int t=1; t<len; ++t )
+                w(t) = x(t-1);
+
+            // Apply the reflector from the right to the remaining rows
+            const Int numRows = c+len-(r+1);
+            block.Resize( numRows, len );
+            for( Int t=0; t<len; ++t )
+                for( Int i=0; i<numRows; ++i )
+                    block(i,t) = entry(r+1+i,c+t);
+            Zeros( y, numRows, 1 );
+            Gemv( NORMAL, F(1), block, w, F(0), y );
+            Ger( -tauP, y, w, block );
+            for( Int t=0; t<len; ++t )
+                for( Int i=0; i<numRows; ++i )
+                    entry(r+1+i,c+t) = block(i,t);
+
+            // Annihilate the fill-in below the diagonal of column c
+            chi = entry(c,c);
+            for( Int t=1; t<len; ++t )
+                x(t-1) = entry(c+t,c);
+            const F tauQ = LeftReflector( chi, x );
+            entry(c,c) = chi;
+            for( Int t=1; t<len; ++t )
+                entry(c+t,c) = 0;
+            v.Resize( len, 1 );
+            v(0) = 1;
+            for( Int t=1; t<len; ++t )
+                v(t) = x(t-1);
+
+            // Apply the reflector from the left to the remaining columns,
+            // which creates the next bulge
+            const Int numCols = Min(c+len+bw,n)-(c+1);
+            if( numCols > 0 )
+            {
+                block.Resize( len, numCols );
+                for( Int jj=0; jj<numCols; ++jj )
+                    for( Int t=0; t<len; ++t )
+                        block(t,jj) = entry(c+t,c+1+jj);
+                Zeros( y, numCols, 1 );
+                Gemv( ADJOINT, F(1), block, v, F(0), y );
+                Ger( -tauQ, v, y, block );
+                for( Int jj=0; jj<numCols; ++jj )
+                    for( Int t=0; t<len; ++t )
+                        entry(c+t,c+1+jj) = block(t,jj);
+            }
+
+            // The right reflector is I - tauP w w^H, which is stored in the
+            // same form as the left reflectors, (I - conj(s) v v^H)^H
+            sweepQ(c-(j+1)) = tauQ;
+            sweepP(c-(j+1)) = Conj(tauP);
+            for( Int t=1; t<len; ++t )
+            {
+                sweepQ(c-(j+1)+t) = v(t);
+                sweepP(c-(j+1)+t) = w(t);
+            }
+        }
+        storeSweep( j, sweepQ, sweepP );
+    }
+}
+
+template<typename F>
+void BandToBidiag( Matrix<F>& A, Matrix<F>& chase, Int bw )
+{
+    DEBUG_CSE
+    const Int n = A.Width();
+    const Int ku = 2*bw-1;
+    Matrix<F> W;
+    Zeros( W, 3*bw-1, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=Max(j-bw,Int(0)); i<=j; ++i )
+            W(i-j+ku,j) = A(i,j);
+
+    Zeros( chase, n, n );
+    auto storeSweep =
+      [&]( Int j, const Matrix<F>& sweepQ, const Matrix<F>& sweepP )
+      {
+          for( Int i=0; i<n-1-j; ++i )
+          {
+              chase(j,j+1+i) = sweepQ(i);
+              chase(j+1+i,j) = sweepP(i);
+          }
+      };
+    ChaseBand
+    ( bw, W,
+      function<void(Int,const Matrix<F>&,const Matrix<F>&)>(storeSweep) );
+
+    for( Int j=0; j<n; ++j )
+        for( Int i=Max(j-bw,Int(0)); i<=j; ++i )
+            A(i,j) = W(i-j+ku,j);
+}
+
+// Every process redundantly chases a replicated copy of the band (which only
+// requires O(n bw) storage) and stores its portion of the reflectors
+template<typename F>
+void BandToBidiag( DistMatrix<F>& A, DistMatrix<F>& chase, Int bw )
+{
+    DEBUG_CSE
+    const Int n = A.Width();
+    const Int ku = 2*bw-1;
+    const Grid& g = A.Grid();
+
+    Matrix<F> W;
+    Zeros( W, 3*bw-1, n );
+    DistMatrix<F,STAR,STAR> ABlock_STAR_STAR(g);
+    for( Int k=0; k<n; k+=bw )
+    {
+        const Int nb = Min(bw,n-k);
+        const Int kBeg = Max(k-bw,Int(0));
+        ABlock_STAR_STAR = A( IR(kBeg,k+nb), IR(k,k+nb) );
+        auto& ABlock = ABlock_STAR_STAR.LockedMatrix();
+        for( Int j=k; j<k+nb; ++j )
+            for( Int i=Max(j-bw,Int(0)); i<=j; ++i )
+                W(i-j+ku,j) = ABlock(i-kBeg,j-k);
+    }
+
+    Zeros( chase, n, n );
+    auto& chaseLoc = chase.Matrix();
+    auto storeSweep =
+      [&]( Int j, const Matrix<F>& sweepQ, const Matrix<F>& sweepP )
+      {
+          if( chase.IsLocalRow(j) )
+          {
+              const Int iLoc = chase.LocalRow(j);
+              for( Int jLoc=chase.LocalColOffset(j+1);
+                   jLoc<chase.LocalWidth(); ++jLoc )
+                  chaseLoc(iLoc,jLoc) = sweepQ(chase.GlobalCol(jLoc)-(j+1));
+          }
+          if( chase.IsLocalCol(j) )
+          {
+              const Int jLoc = chase.LocalCol(j);
+              for( Int iLoc=chase.LocalRowOffset(j+1);
+                   iLoc<chase.LocalHeight(); ++iLoc )
+                  chaseLoc(iLoc,jLoc) = sweepP(chase.GlobalRow(iLoc)-(j+1));
+          }
+      };
+    ChaseBand
+    ( bw, W,
+      function<void(Int,const Matrix<F>&,const Matrix<F>&)>(storeSweep) );
+
+    auto& ALoc = A.Matrix();
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(Max(j-bw,Int(0)));
+        const Int iLocEnd = A.LocalRowOffset(j+1);
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            ALoc(iLoc,jLoc) = W(A.GlobalRow(iLoc)-j+ku,j);
+    }
+}
+
+template<typename F>
+void TwoStageTall
+( Matrix<F>& A, Matrix<F>& phaseP, Matrix<F>& phaseQ, Matrix<F>& chase,
+  Int bw )
+{
+    DEBUG_CSE
+    ReduceToBand( A, phaseP, phaseQ, bw );
+    BandToBidiag( A, chase, bw );
+}
+
+template<typename F>
+void TwoStageTall
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& phaseP,
+  DistMatrix<F,STAR,STAR>& phaseQ,
+  DistMatrix<F>& chase,
+  Int bw )
+{
+    DEBUG_CSE
+    ReduceToBand( A, phaseP, phaseQ, bw );
+    BandToBidiag( A, chase, bw );
+}
+
+// Back-transformation
+// ===================
+
+// Apply the accumulated left (uplo=UPPER) or right (uplo=LOWER)
+// transformation of the bulge-chasing sweeps stored in 'chase'
+template<typename F>
+void ApplyChase
+( LeftOrRight side, Orientation orientation, UpperOrLower uplo, Int bw,
+  const Matrix<F>& chase, Matrix<F>& B )
+{
+    DEBUG_CSE
+    const Int n = chase.Height();
+    const bool chronological = ( (side==LEFT) != (orientation==NORMAL) );
+    const Int numSweeps = Max(n-1,Int(0));
+    const Int numGroups = (numSweeps+bw-1) / bw;
+
+    Matrix<F> VRows;
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int j0 = bw*( chronological ? group : numGroups-1-group );
+        const Int j1 = Min(j0+bw,numSweeps);
+        if( uplo == UPPER )
+            VRows = chase( IR(j0,j1), ALL );
+        else
+            Transpose( chase( ALL, IR(j0,j1) ), VRows );
+        herm_tridiag::ApplyChaseSweeps( side, orientation, bw, j0, VRows, B );
+    }
+}
+
+template<typename F>
+void ApplyChase
+( LeftOrRight side, Orientation orientation, UpperOrLower uplo, Int bw,
+  const DistMatrix<F>& chase, ElementalMatrix<F>& BPre )
+{
+    DEBUG_CSE
+    const Int n = chase.Height();
+    const Grid& g = chase.Grid();
+    const bool chronological = ( (side==LEFT) != (orientation==NORMAL) );
+    const Int numSweeps = Max(n-1,Int(0));
+    const Int numGroups = (numSweeps+bw-1) / bw;
+
+    // Each process applies the reflectors to whole columns (or rows) of B
+    DistMatrix<F,STAR,VR> B_STAR_VR(g);
+    DistMatrix<F,VC,STAR> B_VC_STAR(g);
+    if( side == LEFT )
+        B_STAR_VR = BPre;
+    else
+        B_VC_STAR = BPre;
+    auto& BLoc = ( side==LEFT ? B_STAR_VR.Matrix() : B_VC_STAR.Matrix() );
+
+    DistMatrix<F,STAR,STAR> chasePan(g);
+    Matrix<F> VRows;
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int j0 = bw*( chronological ? group : numGroups-1-group );
+        const Int j1 = Min(j0+bw,numSweeps);
+        if( uplo == UPPER )
+        {
+            chasePan = chase( IR(j0,j1), ALL );
+            VRows = chasePan.LockedMatrix();
+        }
+        else
+        {
+            chasePan = chase( ALL, IR(j0,j1) );
+            Transpose( chasePan.LockedMatrix(), VRows );
+        }
+        herm_tridiag::ApplyChaseSweeps
+        ( side, orientation, bw, j0, VRows, BLoc );
+    }
+
+    if( side == LEFT )
+        Copy( B_STAR_VR, BPre );
+    else
+        Copy( B_VC_STAR, BPre );
+}
+
+// Q = Q1 Q2, where Q1 is from the reduction to band form
+template<typename F>
+void ApplyQTall
+( LeftOrRight side, Orientation orientation, Int bw,
+  const Matrix<F>& A, const Matrix<F>& phase, const Matrix<F>& chase,
+  Matrix<F>& B )
+{
+    DEBUG_CSE
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    const bool chaseFirst = ( onLeft == normal );
+    if( chaseFirst )
+        ApplyChase( side, orientation, UPPER, bw, chase, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, 0, A, phase, B );
+    if( !chaseFirst )
+        ApplyChase( side, orientation, UPPER, bw, chase, B );
+}
+
+template<typename F>
+void ApplyQTall
+( LeftOrRight side, Orientation orientation, Int bw,
+  const DistMatrix<F>& A, const ElementalMatrix<F>& phase,
+  const DistMatrix<F>& chase, ElementalMatrix<F>& B )
+{
+    DEBUG_CSE
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    const bool chaseFirst = ( onLeft == normal );
+    if( chaseFirst )
+        ApplyChase( side, orientation, UPPER, bw, chase, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, 0, A, phase, B );
+    if( !chaseFirst )
+        ApplyChase( side, orientation, UPPER, bw, chase, B );
+}
+
+// P = P1 P2, where P1 is from the reduction to band form
+template<typename F>
+void ApplyPTall
+( LeftOrRight side, Orientation orientation, Int bw,
+  const Matrix<F>& A, const Matrix<F>& phase, const Matrix<F>& chase,
+  Matrix<F>& B )
+{
+    DEBUG_CSE
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? UNCONJUGATED : CONJUGATED );
+    const bool chaseFirst = ( onLeft == normal );
+    if( chaseFirst )
+        ApplyChase( side, orientation, LOWER, bw, chase, B );
+    ApplyPackedReflectors
+    ( side, UPPER, HORIZONTAL, direction, conjugation, bw, A, phase, B );
+    if( !chaseFirst )
+        ApplyChase( side, orientation, LOWER, bw, chase, B );
+}
+
+template<typename F>
+void ApplyPTall
+( LeftOrRight side, Orientation orientation, Int bw,
+  const DistMatrix<F>& A, const ElementalMatrix<F>& phase,
+  const DistMatrix<F>& chase, ElementalMatrix<F>& B )
+{
+    DEBUG_CSE
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? UNCONJUGATED : CONJUGATED );
+    const bool chaseFirst = ( onLeft == normal );
+    if( chaseFirst )
+        ApplyChase( side, orientation, LOWER, bw, chase, B );
+    ApplyPackedReflectors
+    ( side, UPPER, HORIZONTAL, direction, conjugation, bw, A, phase, B );
+    if( !chaseFirst )
+        ApplyChase( side, orientation, LOWER, bw, chase, B );
+}
+
+} // namespace bidiag
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_TWOSTAGE_HPP
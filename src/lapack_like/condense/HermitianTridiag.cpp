@@ -45,16 +45,27 @@ void Ger2Sub
 #include "./HermitianTridiag/LSquare.hpp"
 #include "./HermitianTridiag/U.hpp"
 #include "./HermitianTridiag/USquare.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
 
 namespace El {
 
 template<typename F>
-void HermitianTridiag( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& phase )
+void HermitianTridiag
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& phase,
+  const HermitianTridiagCtrl<F>& ctrl )
 {
     DEBUG_CSE
-    if( uplo == LOWER )
+    if( ctrl.twoStage )
+    {
+        const Int bw =
+          herm_tridiag::TwoStageBandwidth( A.Height(), ctrl.bandwidth );
+        herm_tridiag::TwoStage( uplo, A, phase, bw );
+    }
+    else if( uplo == LOWER )
         herm_tridiag::L( A, phase );
     else
         herm_tridiag::U( A, phase );
@@ -75,7 +86,13 @@ void HermitianTridiag
     auto& phase = phaseProx.Get();
 
     const Grid& g = A.Grid();
-    if( ctrl.approach == HERMITIAN_TRIDIAG_NORMAL )
+    if( ctrl.twoStage )
+    {
+        const Int bw =
+          herm_tridiag::TwoStageBandwidth( A.Height(), ctrl.bandwidth );
+        herm_tridiag::TwoStage( uplo, A, phase, bw );
+    }
+    else if( ctrl.approach == HERMITIAN_TRIDIAG_NORMAL )
     {
         // Use the pipelined algorithm for nonsquare meshes
         if( uplo == LOWER )
@@ -153,11 +170,14 @@ void HermitianTridiag
 namespace herm_tridiag {
 
 template<typename F>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
+void ExplicitCondensed
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl )
 {
     DEBUG_CSE
     Matrix<F> phase;
-    HermitianTridiag( uplo, A, phase );
+    HermitianTridiag( uplo, A, phase, ctrl );
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
     else
@@ -185,14 +205,17 @@ void ExplicitCondensed
   template void HermitianTridiag \
   ( UpperOrLower uplo, \
     Matrix<F>& A, \
-    Matrix<F>& phase ); \
+    Matrix<F>& phase, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void HermitianTridiag \
   ( UpperOrLower uplo, \
     ElementalMatrix<F>& A, \
     ElementalMatrix<F>& phase, \
     const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ExplicitCondensed \
-  ( UpperOrLower uplo, Matrix<F>& A ); \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ExplicitCondensed \
   ( UpperOrLower uplo, \
     ElementalMatrix<F>& A, \
@@ -203,14 +226,16 @@ void ExplicitCondensed
     Orientation orientation, \
     const Matrix<F>& A, \
     const Matrix<F>& phase, \
-          Matrix<F>& B ); \
+          Matrix<F>& B, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ApplyQ \
   ( LeftOrRight side, \
     UpperOrLower uplo, \
     Orientation orientation, \
     const ElementalMatrix<F>& A, \
     const ElementalMatrix<F>& phase, \
-          ElementalMatrix<F>& B );
+          ElementalMatrix<F>& B, \
+    const HermitianTridiagCtrl<F>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -19,9 +19,16 @@ void ApplyQ
   Orientation orientation, 
   const Matrix<F>& A,
   const Matrix<F>& phase,
-        Matrix<F>& B )
+        Matrix<F>& B,
+  const HermitianTridiagCtrl<F>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.twoStage )
+    {
+        const Int bw = TwoStageBandwidth( A.Height(), ctrl.bandwidth );
+        ApplyQTwoStage( side, uplo, orientation, bw, A, phase, B );
+        return;
+    }
     const bool normal = (orientation==NORMAL);
     const bool onLeft = (side==LEFT);
     const ForwardOrBackward direction = 
@@ -40,9 +47,16 @@ void ApplyQ
   Orientation orientation, 
   const ElementalMatrix<F>& A,
   const ElementalMatrix<F>& phase, 
-        ElementalMatrix<F>& B )
+        ElementalMatrix<F>& B,
+  const HermitianTridiagCtrl<F>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.twoStage )
+    {
+        const Int bw = TwoStageBandwidth( A.Height(), ctrl.bandwidth );
+        ApplyQTwoStage( side, uplo, orientation, bw, A, phase, B );
+        return;
+    }
     const bool normal = (orientation==NORMAL);
     const bool onLeft = (side==LEFT);
     const ForwardOrBackward direction = 
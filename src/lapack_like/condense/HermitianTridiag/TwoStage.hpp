@@ -0,0 +1,547 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+// The two-stage reduction first reduces A to a Hermitian band matrix of
+// bandwidth bw using blocked Householder transformations (so that nearly all
+// of the work is in Hemm and Her2k), then chases the band down to real
+// symmetric tridiagonal form.
+//
+// For lower-triangular storage, on exit
+//
+//  - the diagonal and subdiagonal of A hold the tridiagonal matrix and the
+//    remainder of the band is zero,
+//  - the Householder vectors of the first stage are stored below the bw'th
+//    subdiagonal (with implicit unit entries on the bw'th subdiagonal) and
+//    their scalars are stored in the (n-bw) x 1 vector phase, and
+//  - the reflectors of the j'th bulge-chasing sweep are stored in row j of the
+//    strictly upper triangle: the reflector acting on rows [r,r+len) stores
+//    its scalar in column r and the non-unit entries of its vector in columns
+//    (r,r+len).
+//
+// Upper-triangular storage is handled by reducing the adjoint of A.
+
+namespace El {
+namespace herm_tridiag {
+
+inline Int TwoStageBandwidth( Int n, Int bandwidth )
+{
+    const Int bw = ( bandwidth > 0 ? bandwidth : Blocksize() );
+    return Max( Min(bw,n-1), Int(1) );
+}
+
+// Overwrite the diagonal of the upper-triangular matrix SInv so that it is
+// the inverse of the triangular factor T of the forward accumulation
+//   (I - s_0 v_0 v_0^H) ... (I - s_{m-1} v_{m-1} v_{m-1}^H) = I - V T V^H
+// when the strictly upper triangle of SInv is that of V^H V.
+template<typename F>
+void FixForwardDiagonal( const Matrix<F>& s, Matrix<F>& SInv )
+{
+    DEBUG_CSE
+    for( Int j=0; j<SInv.Height(); ++j )
+        SInv(j,j) = F(1)/s(j);
+}
+
+// Stage one
+// =========
+
+// The accumulated transformation of each panel QR factorization is
+//   H_0^H H_1^H ... H_{r-1}^H = I - U T U^H,
+// and the trailing matrix is overwritten with
+//   (I - U T U^H)^H A22 (I - U T U^H) = A22 - U W^H - W U^H,
+// where X = A22 U T, M = T^H U^H X, and W = X - U M / 2.
+template<typename F>
+void ReduceToBand( Matrix<F>& A, Matrix<F>& phase, Int bw )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    phase.Resize( Max(n-bw,Int(0)), 1 );
+
+    Matrix<F> phase1, U, SInv, s, X, Z;
+    Matrix<Base<F>> signature;
+    for( Int k=0; k+bw<n; k+=bw )
+    {
+        const Int height = n-(k+bw);
+        const Int r = Min(height,bw);
+        auto APan = A( IR(k+bw,n),    IR(k,k+bw) );
+        auto A22  = A( IR(k+bw,n),    IR(k+bw,n) );
+
+        // Undo the scaling of R by the signature so that the panel is
+        // represented by pure Householder reflectors
+        QR( APan, phase1, signature );
+        auto R = APan( IR(0,r), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        auto phaseP = phase( IR(k,k+r), ALL );
+        phaseP = phase1;
+
+        U = APan( ALL, IR(0,r) );
+        MakeTrapezoidal( LOWER, U );
+        FillDiagonal( U, F(1) );
+        s.Resize( r, 1 );
+        for( Int j=0; j<r; ++j )
+            s(j) = Conj(phase1(j));
+        Herk( UPPER, ADJOINT, Base<F>(1), U, SInv );
+        FixForwardDiagonal( s, SInv );
+
+        Zeros( X, height, r );
+        Hemm( LEFT, LOWER, F(1), A22, U, F(0), X );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), SInv, X );
+        Gemm( ADJOINT, NORMAL, F(1), U, X, Z );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), SInv, Z );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), U, Z, F(1), X );
+        Her2k( LOWER, NORMAL, F(-1), U, X, Base<F>(1), A22 );
+    }
+}
+
+template<typename F>
+void ReduceToBand( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& phase, Int bw )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+    phase.Resize( Max(n-bw,Int(0)), 1 );
+
+    DistMatrix<F> U(g), SInv(g), X(g), Z(g);
+    DistMatrix<F,STAR,STAR> phase1(g), SInv_STAR_STAR(g), s(g);
+    DistMatrix<Base<F>,STAR,STAR> signature(g);
+    for( Int k=0; k+bw<n; k+=bw )
+    {
+        const Int height = n-(k+bw);
+        const Int r = Min(height,bw);
+        auto APan = A( IR(k+bw,n),    IR(k,k+bw) );
+        auto A22  = A( IR(k+bw,n),    IR(k+bw,n) );
+
+        // Undo the scaling of R by the signature so that the panel is
+        // represented by pure Householder reflectors
+        QR( APan, phase1, signature );
+        auto R = APan( IR(0,r), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        auto phaseP = phase( IR(k,k+r), ALL );
+        phaseP = phase1;
+
+        U = APan( ALL, IR(0,r) );
+        MakeTrapezoidal( LOWER, U );
+        FillDiagonal( U, F(1) );
+        s.Resize( r, 1 );
+        for( Int j=0; j<r; ++j )
+            s.SetLocal( j, 0, Conj(phase1.GetLocal(j,0)) );
+        Herk( UPPER, ADJOINT, Base<F>(1), U, SInv );
+        SInv_STAR_STAR = SInv;
+        FixForwardDiagonal( s.LockedMatrix(), SInv_STAR_STAR.Matrix() );
+
+        X.AlignWith( A22 );
+        Zeros( X, height, r );
+        Hemm( LEFT, LOWER, F(1), A22, U, F(0), X );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), SInv_STAR_STAR, X );
+        Gemm( ADJOINT, NORMAL, F(1), U, X, Z );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), SInv_STAR_STAR, Z );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), U, Z, F(1), X );
+        Her2k( LOWER, NORMAL, F(-1), U, X, Base<F>(1), A22 );
+    }
+}
+
+// Stage two
+// =========
+
+// Chase the Hermitian band matrix of bandwidth bw stored in W, with
+// W(i-j,j) = A(i,j) for 0 <= i-j < 2 bw (the bulges extend to the
+// (2bw-1)'th subdiagonal), down to real symmetric tridiagonal form.
+//
+// Sweep j annihilates column j below its subdiagonal with a reflector acting
+// on rows [j+1,j+1+bw), which creates a bulge in the next block of rows; each
+// subsequent reflector of the sweep annihilates the first column of the
+// bulge and pushes the remainder bw rows further down. The reflectors of
+// sweep j are passed to 'storeSweep' packed into a vector of length n-1-j as
+// described above. Each step only touches a window of O(bw^2) entries.
+template<typename F>
+void ChaseBand
+( Int bw, Matrix<F>& W,
+  function<void(Int,const Matrix<F>&)> storeSweep )
+{
+    DEBUG_CSE
+    const Int n = W.Width();
+    auto get = [&]( Int i, Int j )
+      { return ( i >= j ? W(i-j,j) : Conj(W(j-i,i)) ); };
+
+    F chi;
+    Matrix<F> x, v, y, w, block, sweep;
+    for( Int j=0; j<n-1; ++j )
+    {
+        sweep.Resize( n-1-j, 1 );
+        for( Int r0=j+1; r0<n; r0+=bw )
+        {
+            const Int len = Min(bw,n-r0);
+            const Int c = ( r0 == j+1 ? j : r0-bw );
+
+            // Annihilate all but the first entry of column c within the rows
+            chi = get(r0,c);
+            x.Resize( len-1, 1 );
+            for( Int i=1; i<len; ++i )
+                x(i-1) = get(r0+i,c);
+            const F tau = LeftReflector( chi, x );
+            W(r0-c,c) = chi;
+            for( Int i=1; i<len; ++i )
+                W(r0+i-c,c) = 0;
+            v.Resize( len, 1 );
+            v(0) = 1;
+            for( Int i=1; i<len; ++i )
+                v(i) = x(i-1);
+
+            // Apply the reflector from the left to the rest of the bulge
+            const Int numLeft = r0-(c+1);
+            if( numLeft > 0 )
+            {
+                block.Resize( len, numLeft );
+                for( Int jj=0; jj<numLeft; ++jj )
+                    for( Int i=0; i<len; ++i )
+                        block(i,jj) = get(r0+i,c+1+jj);
+                Zeros( y, numLeft, 1 );
+                Gemv( ADJOINT, F(1), block, v, F(0), y );
+                Ger( -tau, v, y, block );
+                for( Int jj=0; jj<numLeft; ++jj )
+                    for( Int i=0; i<len; ++i )
+                        W(r0+i-(c+1+jj),c+1+jj) = block(i,jj);
+            }
+
+            // Apply the reflector from both sides to the diagonal block
+            block.Resize( len, len );
+            for( Int jj=0; jj<len; ++jj )
+                for( Int i=0; i<len; ++i )
+                    block(i,jj) = get(r0+i,r0+jj);
+            Zeros( y, len, 1 );
+            Gemv( NORMAL, F(1), block, v, F(0), y );
+            w = y;
+            w *= Conj(tau);
+            Axpy( -RealPart(tau*Conj(tau)*Dot(v,y))/Base<F>(2), v, w );
+            Ger( F(-1), v, w, block );
+            Ger( F(-1), w, v, block );
+            for( Int jj=0; jj<len; ++jj )
+                for( Int i=jj; i<len; ++i )
+                    W(i-jj,r0+jj) = block(i,jj);
+
+            // Apply the reflector from the right to the next block of rows,
+            // which creates the next bulge
+            const Int s0 = r0+len;
+            const Int s1 = Min(s0+bw,n);
+            if( s1 > s0 )
+            {
+                block.Resize( s1-s0, len );
+                for( Int jj=0; jj<len; ++jj )
+                    for( Int i=0; i<s1-s0; ++i )
+                        block(i,jj) = get(s0+i,r0+jj);
+                Zeros( y, s1-s0, 1 );
+                Gemv( NORMAL, F(1), block, v, F(0), y );
+                Ger( -Conj(tau), y, v, block );
+                for( Int jj=0; jj<len; ++jj )
+                    for( Int i=0; i<s1-s0; ++i )
+                        W(s0+i-(r0+jj),r0+jj) = block(i,jj);
+            }
+
+            sweep(r0-(j+1)) = tau;
+            for( Int i=1; i<len; ++i )
+                sweep(r0-(j+1)+i) = v(i);
+        }
+        storeSweep( j, sweep );
+    }
+}
+
+template<typename F>
+void BandToTridiag( Matrix<F>& A, Int bw )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    Matrix<F> W;
+    Zeros( W, 2*bw, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(j+bw+1,n); ++i )
+            W(i-j,j) = A(i,j);
+
+    auto storeSweep =
+      [&]( Int j, const Matrix<F>& sweep )
+      {
+          for( Int i=0; i<n-1-j; ++i )
+              A(j,j+1+i) = sweep(i);
+      };
+    ChaseBand( bw, W, function<void(Int,const Matrix<F>&)>(storeSweep) );
+
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(j+bw+1,n); ++i )
+            A(i,j) = W(i-j,j);
+}
+
+// Every process redundantly chases a replicated copy of the band (which only
+// requires O(n bw) storage) and stores its portion of the reflectors
+template<typename F>
+void BandToTridiag( DistMatrix<F>& A, Int bw )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+    const Int localWidth = A.LocalWidth();
+
+    Matrix<F> W;
+    Zeros( W, 2*bw, n );
+    DistMatrix<F,STAR,STAR> ABlock_STAR_STAR(g);
+    for( Int k=0; k<n; k+=bw )
+    {
+        const Int nb = Min(bw,n-k);
+        const Int kEnd = Min(k+nb+bw,n);
+        ABlock_STAR_STAR = A( IR(k,kEnd), IR(k,k+nb) );
+        auto& ABlock = ABlock_STAR_STAR.LockedMatrix();
+        for( Int j=k; j<k+nb; ++j )
+            for( Int i=j; i<Min(j+bw+1,n); ++i )
+                W(i-j,j) = ABlock(i-k,j-k);
+    }
+
+    auto& ALoc = A.Matrix();
+    auto storeSweep =
+      [&]( Int j, const Matrix<F>& sweep )
+      {
+          if( !A.IsLocalRow(j) )
+              return;
+          const Int iLoc = A.LocalRow(j);
+          for( Int jLoc=A.LocalColOffset(j+1); jLoc<localWidth; ++jLoc )
+              ALoc(iLoc,jLoc) = sweep(A.GlobalCol(jLoc)-(j+1));
+      };
+    ChaseBand( bw, W, function<void(Int,const Matrix<F>&)>(storeSweep) );
+
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(j);
+        const Int iLocEnd = A.LocalRowOffset(Min(j+bw+1,n));
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            ALoc(iLoc,jLoc) = W(A.GlobalRow(iLoc)-j,j);
+    }
+}
+
+template<typename F>
+void TwoStage( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& phase, Int bw )
+{
+    DEBUG_CSE
+    if( uplo == UPPER )
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        TwoStage( LOWER, AAdj, phase, bw );
+        Adjoint( AAdj, A );
+        return;
+    }
+    ReduceToBand( A, phase, bw );
+    BandToTridiag( A, bw );
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& phase, Int bw )
+{
+    DEBUG_CSE
+    if( uplo == UPPER )
+    {
+        DistMatrix<F> AAdj(A.Grid());
+        Adjoint( A, AAdj );
+        TwoStage( LOWER, AAdj, phase, bw );
+        Adjoint( AAdj, A );
+        return;
+    }
+    ReduceToBand( A, phase, bw );
+    BandToTridiag( A, bw );
+}
+
+// Back-transformation
+// ===================
+
+// Apply the reflectors of the bulge-chasing sweeps [j0,j0+VRows.Height()),
+// whose packed representations are stored in the rows of VRows, to B.
+//
+// Sweep j's reflectors H_{j,0}, H_{j,1}, ... act on the row blocks
+// [j+1+k bw,j+1+(k+1) bw), so that H_{j,k} overlaps H_{j+1,k} and
+// H_{j+1,k-1}. The reflectors {H_{j,k}} of each group of consecutive sweeps
+// with the same k therefore lie within a window of 2bw-1 rows and can be
+// applied together as a block reflector, and the chronological order is
+// preserved by sweeping over k in decreasing order (and reversing everything
+// when applying the adjoint).
+template<typename F>
+void ApplyChaseSweeps
+( LeftOrRight side, Orientation orientation,
+  Int bw, Int j0, const Matrix<F>& VRows, Matrix<F>& B )
+{
+    DEBUG_CSE
+    const Int n = VRows.Width();
+    const Int numSweeps = VRows.Height();
+    if( numSweeps == 0 )
+        return;
+    const bool chronological = ( (side==LEFT) != (orientation==NORMAL) );
+    const Int numSteps = (n-1-j0+bw-1) / bw;
+
+    Matrix<F> V, s, SInv, Z;
+    for( Int step=0; step<numSteps; ++step )
+    {
+        const Int k = ( chronological ? numSteps-1-step : step );
+        const Int rowBeg = j0+1+k*bw;
+        // The sweeps of the group which reach step k
+        const Int m = Min( numSweeps, n-rowBeg );
+        if( m <= 0 )
+            continue;
+        const Int rowEnd = Min( rowBeg+(m-1)+bw, n );
+        const Int height = rowEnd-rowBeg;
+
+        Zeros( V, height, m );
+        s.Resize( m, 1 );
+        for( Int i=0; i<m; ++i )
+        {
+            const Int r0 = rowBeg+i;
+            const Int len = Min(bw,n-r0);
+            s(i) = Conj(VRows(i,r0));
+            V(i,i) = 1;
+            for( Int t=1; t<len; ++t )
+                V(i+t,i) = VRows(i,r0+t);
+        }
+        Herk( UPPER, ADJOINT, Base<F>(1), V, SInv );
+        FixForwardDiagonal( s, SInv );
+
+        // Apply (I - V T V^H) or its adjoint
+        if( side == LEFT )
+        {
+            auto BWin = B( IR(rowBeg,rowEnd), ALL );
+            Gemm( ADJOINT, NORMAL, F(1), V, BWin, Z );
+            Trsm( LEFT, UPPER, orientation, NON_UNIT, F(1), SInv, Z );
+            Gemm( NORMAL, NORMAL, F(-1), V, Z, F(1), BWin );
+        }
+        else
+        {
+            auto BWin = B( ALL, IR(rowBeg,rowEnd) );
+            Gemm( NORMAL, NORMAL, F(1), BWin, V, Z );
+            Trsm( RIGHT, UPPER, orientation, NON_UNIT, F(1), SInv, Z );
+            Gemm( NORMAL, ADJOINT, F(-1), Z, V, F(1), BWin );
+        }
+    }
+}
+
+// Apply the accumulated transformation of the bulge-chasing sweeps, Q2,
+// which are stored in the strictly upper triangle of A
+template<typename F>
+void ApplyChaseQ
+( LeftOrRight side, Orientation orientation, Int bw,
+  const Matrix<F>& A, Matrix<F>& B )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    const bool chronological = ( (side==LEFT) != (orientation==NORMAL) );
+    const Int numSweeps = Max(n-1,Int(0));
+    const Int numGroups = (numSweeps+bw-1) / bw;
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int j0 = bw*( chronological ? group : numGroups-1-group );
+        const Int j1 = Min(j0+bw,numSweeps);
+        auto VRows = A( IR(j0,j1), ALL );
+        ApplyChaseSweeps( side, orientation, bw, j0, VRows, B );
+    }
+}
+
+template<typename F>
+void ApplyChaseQ
+( LeftOrRight side, Orientation orientation, Int bw,
+  const DistMatrix<F>& A, ElementalMatrix<F>& BPre )
+{
+    DEBUG_CSE
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+    const bool chronological = ( (side==LEFT) != (orientation==NORMAL) );
+    const Int numSweeps = Max(n-1,Int(0));
+    const Int numGroups = (numSweeps+bw-1) / bw;
+
+    // Each process applies the reflectors to whole columns (or rows) of B
+    DistMatrix<F,STAR,VR> B_STAR_VR(g);
+    DistMatrix<F,VC,STAR> B_VC_STAR(g);
+    if( side == LEFT )
+        B_STAR_VR = BPre;
+    else
+        B_VC_STAR = BPre;
+    auto& BLoc = ( side==LEFT ? B_STAR_VR.Matrix() : B_VC_STAR.Matrix() );
+
+    DistMatrix<F,STAR,STAR> VRows(g);
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int j0 = bw*( chronological ? group : numGroups-1-group );
+        const Int j1 = Min(j0+bw,numSweeps);
+        VRows = A( IR(j0,j1), ALL );
+        ApplyChaseSweeps( side, orientation, bw, j0, VRows.Matrix(), BLoc );
+    }
+
+    if( side == LEFT )
+        Copy( B_STAR_VR, BPre );
+    else
+        Copy( B_VC_STAR, BPre );
+}
+
+template<typename F>
+void ApplyQTwoStage
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation, Int bw,
+  const Matrix<F>& A, const Matrix<F>& phase, Matrix<F>& B )
+{
+    DEBUG_CSE
+    if( uplo == UPPER )
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        ApplyQTwoStage( side, LOWER, orientation, bw, AAdj, phase, B );
+        return;
+    }
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+
+    // Q = Q1 Q2, where Q1 is from the reduction to band form
+    const bool chaseFirst = ( onLeft == normal );
+    if( chaseFirst )
+        ApplyChaseQ( side, orientation, bw, A, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, -bw, A, phase, B );
+    if( !chaseFirst )
+        ApplyChaseQ( side, orientation, bw, A, B );
+}
+
+template<typename F>
+void ApplyQTwoStage
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation, Int bw,
+  const ElementalMatrix<F>& APre, const ElementalMatrix<F>& phase,
+  ElementalMatrix<F>& B )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    if( uplo == UPPER )
+    {
+        DistMatrix<F> AAdj(A.Grid());
+        Adjoint( A, AAdj );
+        ApplyQTwoStage( side, LOWER, orientation, bw, AAdj, phase, B );
+        return;
+    }
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+
+    // Q = Q1 Q2, where Q1 is from the reduction to band form
+    const bool chaseFirst = ( onLeft == normal );
+    if( chaseFirst )
+        ApplyChaseQ( side, orientation, bw, A, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, -bw, A, phase, B );
+    if( !chaseFirst )
+        ApplyChaseQ( side, orientation, bw, A, B );
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
@@ -148,7 +148,7 @@ void UVar3( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", g, n );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -900,14 +900,20 @@ void DistFront<F>::Unpack
             else
             {
                 // The matrix has already been factored
-                for( Int e=0; e<numEntries; ++e )
+                const Int numSparseRows = front.LSparse.Height();
+                for( Int iSparse=0; iSparse<numSparseRows; ++iSparse )
                 {
-                    const F value = front.LSparse.Value(e);
-                    if( value != F(0) )
-                        A.QueueUpdate
-                        ( front.LSparse.Row(e)+node.off, 
-                          front.LSparse.Col(e)+node.off,
-                          value );
+                    const Int rowOff = front.LSparse.RowOffset(iSparse);
+                    const Int rowEnd = front.LSparse.RowOffset(iSparse+1);
+                    for( Int e=rowOff; e<rowEnd; ++e )
+                    {
+                        const F value = front.LSparse.Value(e);
+                        if( value != F(0) )
+                            A.QueueUpdate
+                            ( iSparse+node.off, 
+                              front.LSparse.Col(e)+node.off,
+                              value );
+                    }
                 }
             }
 
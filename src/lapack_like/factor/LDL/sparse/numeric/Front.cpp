@@ -348,17 +348,23 @@ void Front<F>::Push
             }
             else
             {
-                // We have already factored, so use front.LSparse
-                for( Int e=0; e<numEntries; ++e )
+                // We have already factored, so use front.LSparse, whose
+                // rows are only implicit in its offsets
+                const Int numSparseRows = front.LSparse.Height();
+                for( Int iSparse=0; iSparse<numSparseRows; ++iSparse )
                 {
-                    const Int iSparse = front.LSparse.Row(e);
-                    const Int jSparse = front.LSparse.Col(e);
-                    const F value = front.LSparse.Value(e);
-                    if( iSparse < jSparse || value == F(0) )
-                        continue;
+                    const Int rowOff = front.LSparse.RowOffset(iSparse);
+                    const Int rowEnd = front.LSparse.RowOffset(iSparse+1);
+                    for( Int e=rowOff; e<rowEnd; ++e )
+                    {
+                        const Int jSparse = front.LSparse.Col(e);
+                        const F value = front.LSparse.Value(e);
+                        if( iSparse < jSparse || value == F(0) )
+                            continue;
 
-                    const Int j = invReorder[jSparse + node.off];
-                    A.QueueUpdate( invReorder[iSparse+node.off], j, value );
+                        const Int j = invReorder[jSparse + node.off];
+                        A.QueueUpdate( invReorder[iSparse+node.off], j, value );
+                    }
                 }
             }
 
@@ -464,17 +470,23 @@ void Front<F>::Unpack( SparseMatrix<F>& A, const NodeInfo& rootInfo ) const
             }
             else
             {
-                // We have already factored, so use front.LSparse
-                for( Int e=0; e<numEntries; ++e )
+                // We have already factored, so use front.LSparse, whose
+                // rows are only implicit in its offsets
+                const Int numSparseRows = front.LSparse.Height();
+                for( Int iSparse=0; iSparse<numSparseRows; ++iSparse )
                 {
-                    const Int iSparse = front.LSparse.Row(e);
-                    const Int jSparse = front.LSparse.Col(e);
-                    const F value = front.LSparse.Value(e);
-                    if( iSparse < jSparse || value == F(0) )
-                        continue;
+                    const Int rowOff = front.LSparse.RowOffset(iSparse);
+                    const Int rowEnd = front.LSparse.RowOffset(iSparse+1);
+                    for( Int e=rowOff; e<rowEnd; ++e )
+                    {
+                        const Int jSparse = front.LSparse.Col(e);
+                        const F value = front.LSparse.Value(e);
+                        if( iSparse < jSparse || value == F(0) )
+                            continue;
 
-                    const Int j = jSparse + node.off;
-                    A.QueueUpdate( iSparse+node.off, j, value );
+                        const Int j = jSparse + node.off;
+                        A.QueueUpdate( iSparse+node.off, j, value );
+                    }
                 }
             }
 
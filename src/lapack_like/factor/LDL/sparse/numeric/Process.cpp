@@ -0,0 +1,52 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace {
+using namespace El;
+
+double subtreeTaskCutoff = 1e7;
+Int subtreeTaskMemoryLimit = Int(1) << 26;
+Int subtreeTaskMemoryPeak = 0;
+
+}
+
+namespace El {
+namespace ldl {
+
+void SetSubtreeTaskCutoff( double flops )
+{ ::subtreeTaskCutoff = flops; }
+
+double SubtreeTaskCutoff()
+{ return ::subtreeTaskCutoff; }
+
+void SetSubtreeTaskMemoryLimit( Int numEntries )
+{
+    DEBUG_ONLY(
+      if( numEntries < 0 )
+          LogicError("Memory limit must be non-negative");
+    )
+    ::subtreeTaskMemoryLimit = numEntries;
+}
+
+Int SubtreeTaskMemoryLimit()
+{ return ::subtreeTaskMemoryLimit; }
+
+Int SubtreeTaskMemoryPeak()
+{ return ::subtreeTaskMemoryPeak; }
+
+namespace process {
+
+void RecordTaskBudgetPeak( Int numEntries )
+{ ::subtreeTaskMemoryPeak = numEntries; }
+
+} // namespace process
+
+} // namespace ldl
+} // namespace El
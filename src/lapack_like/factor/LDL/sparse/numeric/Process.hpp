@@ -20,23 +20,118 @@
 #ifndef EL_LDL_PROCESS_HPP
 #define EL_LDL_PROCESS_HPP
 
+#include <atomic>
+
 #include "./ProcessFront.hpp"
 
 namespace El {
 namespace ldl {
 
-template<typename F> 
-inline void 
-Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+namespace process {
+
+// The (approximate) number of flops required to factor the subtree rooted at
+// the given node
+inline double SubtreeFlops( const NodeInfo& info )
+{
+    const double n = info.size;
+    const double m = info.lowerStruct.size();
+    double flops = n*n*n/3 + n*n*m + n*m*m;
+    for( const NodeInfo* child : info.children )
+        flops += SubtreeFlops( *child );
+    return flops;
+}
+
+// Tracks the number of entries of child update matrices which may still be
+// reserved by concurrently factored subtrees.
+//
+// NOTE: Only the updates of children which are spawned as tasks are charged
+//       against the budget; the update of a child processed inline, and the
+//       front of the parent which the updates are added into, are not. The
+//       limit therefore bounds the additional memory due to concurrency rather
+//       than the total memory of the traversal.
+class TaskBudget
+{
+public:
+    TaskBudget( Int numEntries )
+    : limit_(numEntries), available_(numEntries), peak_(0) { }
+
+    bool Reserve( Int numEntries )
+    {
+        Int available = available_.load();
+        while( available >= numEntries )
+        {
+            if( available_.compare_exchange_weak
+                ( available, available-numEntries ) )
+            {
+                const Int reserved = limit_ - (available-numEntries);
+                Int peak = peak_.load();
+                while( reserved > peak &&
+                       !peak_.compare_exchange_weak( peak, reserved ) ) { }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Release( Int numEntries ) { available_ += numEntries; }
+
+    // The largest number of entries which were simultaneously reserved
+    Int Peak() const { return peak_.load(); }
+
+private:
+    const Int limit_;
+    std::atomic<Int> available_;
+    std::atomic<Int> peak_;
+};
+
+void RecordTaskBudgetPeak( Int numEntries );
+
+// Add the lower triangle of the child update matrix into the parent front.
+// Distinct child columns map to distinct parent columns, so the columns in
+// [jBeg,jEnd) may be added concurrently with any other disjoint range.
+template<typename F>
+inline void ExtendAdd
+( const NodeInfo& info, Int c, Int jBeg, Int jEnd,
+  const Matrix<F>& childU, Matrix<F>& FL, Matrix<F>& FBR )
+{
+    const Int* relInds = info.childRelInds[c].data();
+    const Int childUSize = childU.Height();
+    for( Int jChild=jBeg; jChild<jEnd; ++jChild )
+    {
+        const Int j = relInds[jChild];
+        const F* childCol = childU.LockedBuffer(0,jChild);
+        if( j < info.size )
+        {
+            F* FCol = FL.Buffer(0,j);
+            for( Int iChild=jChild; iChild<childUSize; ++iChild )
+                FCol[relInds[iChild]] += childCol[iChild];
+        }
+        else
+        {
+            F* FCol = FBR.Buffer(0,j-info.size);
+            for( Int iChild=jChild; iChild<childUSize; ++iChild )
+                FCol[relInds[iChild]-info.size] += childCol[iChild];
+        }
+    }
+}
+
+// The number of update columns per extend-add task
+static const Int extendAddTaskWidth = 64;
+
+template<typename F>
+inline void
+Process
+( const NodeInfo& info, Front<F>& front, LDLFrontType factorType,
+  TaskBudget* budget )
 {
     DEBUG_CSE
     const int updateSize = info.lowerStruct.size();
     auto& FBR = front.workDense;
     FBR.Empty();
-    Zeros( FBR, updateSize, updateSize );
 
     if( front.sparseLeaf )
     {
+        Zeros( FBR, updateSize, updateSize );
         front.type = factorType;
         const Int m = front.LDense.Height();
         const Int n = front.LDense.Width();
@@ -47,22 +142,16 @@ Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
         if( PivotedFactorization(factorType) )
             Zeros( front.subdiag, n-1, 1 );
 
+        // Only the offsets and targets of L are needed, so its rows are left
+        // implicit in the offsets
         Zeros( front.LSparse, numSources, numSources );
+        front.LSparse.CompressStorage();
         front.LSparse.ForceNumEntries( numEntries );
         F* LValBuf = front.LSparse.ValueBuffer();
-        Int* LRowBuf = front.LSparse.SourceBuffer();
         Int* LColBuf = front.LSparse.TargetBuffer();
         Int* LOffsetBuf = front.LSparse.OffsetBuffer();
-
-        for( Int i=0; i<numSources; ++i )
-        {
-            const Int iStart = info.LOffsets[i];
-            const Int iEnd = info.LOffsets[i+1];
-            LOffsetBuf[i] = iStart;
-            for( Int e=iStart; e<iEnd; ++e )
-                LRowBuf[e] = i;
-        }
-        LOffsetBuf[numSources] = info.LOffsets[numSources];
+        for( Int i=0; i<=numSources; ++i )
+            LOffsetBuf[i] = info.LOffsets[i];
         front.diag.Resize( numSources, 1 );
 
         // Factor the transpose of L
@@ -116,33 +205,99 @@ Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
               LogicError("Front was not the proper size");
         )
 
-        // Process children and add in their updates
+        // Process the children, factoring the expensive sibling subtrees
+        // concurrently when a task budget was provided
         const int numChildren = info.children.size();
-        for( Int c=0; c<numChildren; ++c )
+        vector<Int> reserved( numChildren, 0 );
+        if( budget == nullptr )
+        {
+            for( Int c=0; c<numChildren; ++c )
+                Process
+                ( *info.children[c], *front.children[c], factorType, nullptr );
+        }
+#ifdef EL_HYBRID
+        else
         {
-            Process( *info.children[c], *front.children[c], factorType );
+            const double cutoff = SubtreeTaskCutoff();
+            for( Int c=0; c<numChildren; ++c )
+            {
+                const NodeInfo* childInfo = info.children[c];
+                Front<F>* childFront = front.children[c];
+                TaskBudget* childBudget =
+                  ( SubtreeFlops(*childInfo) >= cutoff ? budget : nullptr );
+                const Int childUSize = childInfo->lowerStruct.size();
+                if( c+1 < numChildren && childBudget != nullptr &&
+                    budget->Reserve( childUSize*childUSize ) )
+                {
+                    reserved[c] = childUSize*childUSize;
+                    _Pragma("omp task firstprivate(childInfo,childFront,childBudget)")
+                    Process( *childInfo, *childFront, factorType, childBudget );
+                }
+                else
+                    Process( *childInfo, *childFront, factorType, childBudget );
+            }
+            _Pragma("omp taskwait")
+        }
+#endif
 
+        // Add in the child updates, one child at a time, after allocating the
+        // bottom-right workspace (so that it is not live while the children
+        // are being factored)
+        Zeros( FBR, updateSize, updateSize );
+        for( Int c=0; c<numChildren; ++c )
+        {
             auto& childU = front.children[c]->workDense;
-            const int childUSize = childU.Height();
-            for( int jChild=0; jChild<childUSize; ++jChild )
+            const Int childUSize = childU.Height();
+#ifdef EL_HYBRID
+            if( budget != nullptr && childUSize > extendAddTaskWidth )
             {
-                const int j = info.childRelInds[c][jChild];
-                for( int iChild=jChild; iChild<childUSize; ++iChild )
+                const NodeInfo* infoPtr = &info;
+                const Matrix<F>* childUPtr = &childU;
+                Matrix<F>* FLPtr = &FL;
+                Matrix<F>* FBRPtr = &FBR;
+                for( Int jBeg=0; jBeg<childUSize; jBeg+=extendAddTaskWidth )
                 {
-                    const int i = info.childRelInds[c][iChild];
-                    const F value = childU(iChild,jChild);
-                    if( j < info.size )
-                        FL(i,j) += value;
-                    else
-                        FBR(i-info.size,j-info.size) += value;
+                    const Int jEnd = Min(jBeg+extendAddTaskWidth,childUSize);
+                    _Pragma("omp task firstprivate(infoPtr,childUPtr,FLPtr,FBRPtr,c,jBeg,jEnd)")
+                    ExtendAdd
+                    ( *infoPtr, c, jBeg, jEnd, *childUPtr, *FLPtr, *FBRPtr );
                 }
+                _Pragma("omp taskwait")
             }
+            else
+#endif
+                ExtendAdd( info, c, Int(0), childUSize, childU, FL, FBR );
             childU.Empty();
+            if( reserved[c] != 0 )
+                budget->Release( reserved[c] );
         }
         ProcessFront( front, factorType );
     }
 }
 
+} // namespace process
+
+template<typename F> 
+inline void 
+Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+{
+    DEBUG_CSE
+#ifdef EL_HYBRID
+    // Only traverse the tree with tasks when the scalar type can be safely
+    // manipulated by several threads and we are not already within a team
+    if( IsPacked<F>::value && MaxThreads() > 1 && !omp_in_parallel() )
+    {
+        process::TaskBudget budget( SubtreeTaskMemoryLimit() );
+        _Pragma("omp parallel")
+        _Pragma("omp single")
+        process::Process( info, front, factorType, &budget );
+        process::RecordTaskBudgetPeak( budget.Peak() );
+        return;
+    }
+#endif
+    process::Process( info, front, factorType, nullptr );
+}
+
 template<typename F>
 inline void
 Process
@@ -10,6 +10,7 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Tournament.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
@@ -60,7 +61,7 @@ void LU( ElementalMatrix<F>& APre )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "LUNoPiv", g, minDim );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -141,6 +142,23 @@ void LU( Matrix<F>& A, Permutation& P )
     }
 }
 
+template<typename F> 
+void LU( Matrix<F>& A, Permutation& P, const LUCtrl& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.pivotType == LU_PARTIAL || ctrl.pivotType == LU_TOURNAMENT )
+    {
+        LU( A, P );
+    }
+    else if( ctrl.pivotType == LU_WITHOUT_PIVOTING )
+    {
+        P.MakeIdentity( A.Height() );
+        LU( A );
+    }
+    else
+        LogicError("Unsupported LU pivot type");
+}
+
 template<typename F> 
 void LU
 ( Matrix<F>& A,
@@ -155,6 +173,23 @@ template<typename F>
 void LU( ElementalMatrix<F>& APre, DistPermutation& P )
 {
     DEBUG_CSE
+    LU( APre, P, LUCtrl() );
+}
+
+template<typename F> 
+void LU( ElementalMatrix<F>& APre, DistPermutation& P, const LUCtrl& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.pivotType == LU_WITHOUT_PIVOTING )
+    {
+        P.SetGrid( APre.Grid() );
+        P.MakeIdentity( APre.Height() );
+        LU( APre );
+        return;
+    }
+    if( ctrl.pivotType != LU_PARTIAL && ctrl.pivotType != LU_TOURNAMENT )
+        LogicError("Unsupported LU pivot type");
+    const bool tournament = ( ctrl.pivotType == LU_TOURNAMENT );
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -176,7 +211,8 @@ void LU( ElementalMatrix<F>& APre, DistPermutation& P )
     DistPermutation PB(g);
 
     vector<F> panelBuf, pivotBuf;
-    const Int bsize = Blocksize();
+    const Int bsize =
+      TunedBlocksize<F>( tournament ? "CALU" : "LU", g, minDim );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -199,7 +235,10 @@ void LU( ElementalMatrix<F>& APre, DistPermutation& P )
         ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
         A11_STAR_STAR = A11;
         A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        if( tournament )
+            lu::TournamentPanel( A11_STAR_STAR, A21_MC_STAR, P, PB, k );
+        else
+            lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
 
         PB.PermuteRows( AB );
 
@@ -241,6 +280,14 @@ void LU
   ( ElementalMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( Matrix<F>& A, \
+    Permutation& P, \
+    const LUCtrl& ctrl ); \
+  template void LU \
+  ( ElementalMatrix<F>& A, \
+    DistPermutation& P, \
+    const LUCtrl& ctrl ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
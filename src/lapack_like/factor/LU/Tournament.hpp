@@ -0,0 +1,227 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TOURNAMENT_HPP
+#define EL_LU_TOURNAMENT_HPP
+
+namespace El {
+namespace lu {
+
+// Select (up to) n pivot rows from the candidate rows of the m x n matrix C
+// via partial pivoting, overwriting C with the selected rows (in pivot order)
+// and 'rows' with their indices
+template<typename F>
+void SelectPivots( Matrix<F>& C, vector<Int>& rows )
+{
+    DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int numPivots = Min(m,n);
+
+    auto CElim( C );
+    vector<Int> order( m );
+    for( Int i=0; i<m; ++i )
+        order[i] = i;
+
+    F* CBuf = CElim.Buffer();
+    const Int CLDim = CElim.LDim();
+    for( Int k=0; k<numPivots; ++k )
+    {
+        const Int iPiv = k + blas::MaxInd( m-k, &CBuf[k+k*CLDim], 1 );
+        if( iPiv != k )
+        {
+            blas::Swap( n, &CBuf[k], CLDim, &CBuf[iPiv], CLDim );
+            std::swap( order[k], order[iPiv] );
+        }
+
+        // An exactly zero column leaves the choice of pivot arbitrary
+        const F alpha = CBuf[k+k*CLDim];
+        if( alpha == F(0) )
+            continue;
+        const F alphaInv = F(1) / alpha;
+        blas::Scal( m-(k+1), alphaInv, &CBuf[(k+1)+k*CLDim], 1 );
+        blas::Geru
+        ( m-(k+1), n-(k+1),
+          F(-1), &CBuf[(k+1)+k*CLDim], 1,
+                 &CBuf[k+(k+1)*CLDim], CLDim,
+                 &CBuf[(k+1)+(k+1)*CLDim], CLDim );
+    }
+
+    Matrix<F> CSel( numPivots, n );
+    vector<Int> rowsSel( numPivots );
+    for( Int k=0; k<numPivots; ++k )
+    {
+        for( Int j=0; j<n; ++j )
+            CSel(k,j) = C(order[k],j);
+        rowsSel[k] = rows[order[k]];
+    }
+    C = CSel;
+    rows = rowsSel;
+}
+
+// Tournament pivoting (CALU): rather than performing an allreduce over the
+// process column for each of the n pivots, each process selects n candidate
+// pivot rows from its local portion of the panel via partial pivoting, and
+// the candidates are then played off against each other up a binary tree
+// over the process column. The n winners are broadcast, swapped into A, and
+// the panel is factored without further pivoting.
+//
+// The arguments are as for the partially-pivoted lu::Panel: the local
+// buffers of A[*,*] and B[MC,*] are assumed to be vertically stacked.
+template<typename F>
+void TournamentPanel
+( DistMatrix<F,  STAR,STAR>& A,
+  DistMatrix<F,  MC,  STAR>& B,
+  DistPermutation& P,
+  DistPermutation& PB,
+  Int offset )
+{
+    DEBUG_CSE
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    F* ABuf = A.Buffer();
+    F* BBuf = B.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    mpi::Comm colComm = B.ColComm();
+    const int colRank = B.ColRank();
+    const int colStride = B.ColStride();
+    DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+      if( A.Buffer()+n != B.Buffer() )
+          LogicError("Buffers of A and B did not properly align");
+    )
+
+    // Each process nominates its local rows (with the rows of A contributed
+    // by the first process)
+    const Int numLocal = ( colRank == 0 ? n : 0 ) + BLocHeight;
+    Matrix<F> C( numLocal, n );
+    vector<Int> rows( numLocal );
+    {
+        Int iCand = 0;
+        if( colRank == 0 )
+        {
+            for( Int i=0; i<n; ++i, ++iCand )
+            {
+                for( Int j=0; j<n; ++j )
+                    C(iCand,j) = ABuf[i+j*ALDim];
+                rows[iCand] = i;
+            }
+        }
+        for( Int iLoc=0; iLoc<BLocHeight; ++iLoc, ++iCand )
+        {
+            for( Int j=0; j<n; ++j )
+                C(iCand,j) = BBuf[iLoc+j*BLDim];
+            rows[iCand] = B.GlobalRow(iLoc) + n;
+        }
+    }
+    SelectPivots( C, rows );
+
+    // Reduce the candidates up a binary tree to the first process. Each
+    // message holds the number of candidates followed by their indices, and
+    // then the candidate rows.
+    vector<Int> rowBuf( n+1 );
+    vector<F> candBuf( n*n );
+    for( int step=1; step<colStride; step*=2 )
+    {
+        if( colRank % (2*step) == step )
+        {
+            const Int numCand = C.Height();
+            rowBuf[0] = numCand;
+            for( Int i=0; i<numCand; ++i )
+                rowBuf[i+1] = rows[i];
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<numCand; ++i )
+                    candBuf[i+j*numCand] = C(i,j);
+            mpi::Send( rowBuf.data(), n+1, colRank-step, colComm );
+            mpi::Send( candBuf.data(), n*n, colRank-step, colComm );
+            break;
+        }
+        else if( colRank % (2*step) == 0 && colRank+step < colStride )
+        {
+            mpi::Recv( rowBuf.data(), n+1, colRank+step, colComm );
+            mpi::Recv( candBuf.data(), n*n, colRank+step, colComm );
+            const Int numOurs = C.Height();
+            const Int numTheirs = rowBuf[0];
+            Matrix<F> CPair( numOurs+numTheirs, n );
+            rows.resize( numOurs+numTheirs );
+            for( Int j=0; j<n; ++j )
+            {
+                for( Int i=0; i<numOurs; ++i )
+                    CPair(i,j) = C(i,j);
+                for( Int i=0; i<numTheirs; ++i )
+                    CPair(numOurs+i,j) = candBuf[i+j*numTheirs];
+            }
+            for( Int i=0; i<numTheirs; ++i )
+                rows[numOurs+i] = rowBuf[i+1];
+            C = CPair;
+            SelectPivots( C, rows );
+        }
+    }
+
+    // Broadcast the winners, of which there are exactly n since the panel
+    // has at least n rows
+    if( colRank == 0 )
+    {
+        for( Int i=0; i<n; ++i )
+            rowBuf[i] = rows[i];
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+                candBuf[i+j*n] = C(i,j);
+    }
+    mpi::Broadcast( rowBuf.data(), n, 0, colComm );
+    mpi::Broadcast( candBuf.data(), n*n, 0, colComm );
+
+    // Convert the winners into a sequence of swaps. A row displaced from the
+    // top n rows is always an original row of A, since the winners fill the
+    // top rows in order, so no further communication is needed to apply them.
+    PB.MakeIdentity( A.Height()+B.Height() );
+    PB.ReserveSwaps( n );
+    std::map<Int,Int> origAt, posOf;
+    auto Orig = [&]( Int pos )
+      { auto it = origAt.find(pos); return it==origAt.end() ? pos : it->second; };
+    auto Pos = [&]( Int orig )
+      { auto it = posOf.find(orig); return it==posOf.end() ? orig : it->second; };
+    for( Int k=0; k<n; ++k )
+    {
+        const Int iPiv = Pos( rowBuf[k] );
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+        const Int origK = Orig( k );
+        const Int origPiv = Orig( iPiv );
+        origAt[k] = origPiv;
+        origAt[iPiv] = origK;
+        posOf[origPiv] = k;
+        posOf[origK] = iPiv;
+    }
+    for( const auto& entry : origAt )
+    {
+        const Int pos = entry.first;
+        if( pos < n || !B.IsLocalRow(pos-n) )
+            continue;
+        const Int iLoc = B.LocalRow(pos-n);
+        for( Int j=0; j<n; ++j )
+            BBuf[iLoc+j*BLDim] = ABuf[entry.second+j*ALDim];
+    }
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            ABuf[i+j*ALDim] = candBuf[i+j*n];
+
+    // Factor the pivoted panel
+    LU( A.Matrix() );
+    Trsm
+    ( RIGHT, UPPER, NORMAL, NON_UNIT,
+      F(1), A.LockedMatrix(), B.Matrix() );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENT_HPP
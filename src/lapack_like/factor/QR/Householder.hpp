@@ -71,7 +71,7 @@ Householder
     phase.Resize( minDim, 1 );
     signature.Resize( minDim, 1 );
 
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "QR", A.Grid(), minDim );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
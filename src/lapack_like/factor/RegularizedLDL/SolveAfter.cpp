@@ -12,6 +12,66 @@ namespace El {
 
 namespace reg_ldl {
 
+// Apply the inverse of the factored front to Y, casting Y down to and back up
+// from the precision of the front when it was factored in a lower one
+template<typename F>
+inline void FrontSolve
+( const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<F>& front,
+        Matrix<F>& Y )
+{
+    DEBUG_CSE
+    ldl::MatrixNode<F> YNodal( invMap, info, Y );
+    ldl::SolveAfter( info, front, YNodal );
+    YNodal.Push( invMap, info, Y );
+}
+
+template<typename F,typename FFront>
+inline void FrontSolve
+( const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<FFront>& front,
+        Matrix<F>& Y )
+{
+    DEBUG_CSE
+    Matrix<FFront> YFront;
+    Copy( Y, YFront );
+    FrontSolve( invMap, info, front, YFront );
+    Copy( YFront, Y );
+}
+
+template<typename F>
+inline void FrontSolve
+( const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<F>& front,
+        DistMultiVec<F>& Y,
+        ldl::DistMultiVecNodeMeta& meta )
+{
+    DEBUG_CSE
+    // TODO: Switch to DistMatrixNode with large numbers of RHS
+    ldl::DistMultiVecNode<F> YNodal;
+    YNodal.Pull( invMap, info, Y, meta );
+    ldl::SolveAfter( info, front, YNodal );
+    YNodal.Push( invMap, info, Y, meta );
+}
+
+template<typename F,typename FFront>
+inline void FrontSolve
+( const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<FFront>& front,
+        DistMultiVec<F>& Y,
+        ldl::DistMultiVecNodeMeta& meta )
+{
+    DEBUG_CSE
+    DistMultiVec<FFront> YFront(Y.Comm());
+    Copy( Y, YFront );
+    FrontSolve( invMap, info, front, YFront, meta );
+    Copy( YFront, Y );
+}
+
 template<typename F>
 inline Int RegularizedSolveAfterNoPromote
 ( const SparseMatrix<F>& A, 
@@ -46,14 +106,14 @@ inline Int RegularizedSolveAfterNoPromote
     return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
 }
 
-template<typename F>
+template<typename F,typename FFront>
 inline Int RegularizedSolveAfterNoPromote
 ( const SparseMatrix<F>& A,
   const Matrix<Base<F>>& reg,
   const Matrix<Base<F>>& d, 
   const vector<Int>& invMap,
   const ldl::NodeInfo& info,
-  const ldl::Front<F>& front, 
+  const ldl::Front<FFront>& front, 
         Matrix<F>& B,
   Base<F> relTol,
   Int maxRefineIts, 
@@ -74,9 +134,7 @@ inline Int RegularizedSolveAfterNoPromote
       [&]( Matrix<F>& Y )
       {
         DiagonalSolve( LEFT, NORMAL, d, Y );
-        ldl::MatrixNode<F> YNodal( invMap, info, Y );
-        ldl::SolveAfter( info, front, YNodal );
-        YNodal.Push( invMap, info, Y );
+        FrontSolve( invMap, info, front, Y );
         DiagonalSolve( LEFT, NORMAL, d, Y );
       };
 
@@ -148,7 +206,7 @@ RegularizedSolveAfterPromote
       ( A, reg, invMap, info, front, B, relTol, maxRefineIts, progress, time );
 }
 
-template<typename F>
+template<typename F,typename FFront>
 inline DisableIf<IsSame<F,Promote<F>>,Int>
 RegularizedSolveAfterPromote
 ( const SparseMatrix<F>& A, 
@@ -156,7 +214,7 @@ RegularizedSolveAfterPromote
   const Matrix<Base<F>>& d, 
   const vector<Int>& invMap, 
   const ldl::NodeInfo& info,
-  const ldl::Front<F>& front, 
+  const ldl::Front<FFront>& front, 
         Matrix<F>& B,
   Base<F> relTol,
   Int maxRefineIts, 
@@ -186,9 +244,7 @@ RegularizedSolveAfterPromote
       [&]( Matrix<F>& Y )
       {
         DiagonalSolve( LEFT, NORMAL, d, Y );
-        ldl::MatrixNode<F> YNodal( invMap, info, Y );
-        ldl::SolveAfter( info, front, YNodal );
-        YNodal.Push( invMap, info, Y );
+        FrontSolve( invMap, info, front, Y );
         DiagonalSolve( LEFT, NORMAL, d, Y );
       };
 
@@ -196,7 +252,7 @@ RegularizedSolveAfterPromote
            ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
 }
 
-template<typename F>
+template<typename F,typename FFront>
 inline EnableIf<IsSame<F,Promote<F>>,Int>
 RegularizedSolveAfterPromote
 ( const SparseMatrix<F>& A, 
@@ -204,7 +260,7 @@ RegularizedSolveAfterPromote
   const Matrix<Base<F>>& d, 
   const vector<Int>& invMap, 
   const ldl::NodeInfo& info,
-  const ldl::Front<F>& front, 
+  const ldl::Front<FFront>& front, 
         Matrix<F>& B,
   Base<F> relTol,
   Int maxRefineIts, 
@@ -212,7 +268,7 @@ RegularizedSolveAfterPromote
   bool time )
 {
     DEBUG_CSE
-    return RegularizedSolveAfter
+    return RegularizedSolveAfterNoPromote
       ( A, reg, d, invMap, info, front, B,
         relTol, maxRefineIts, progress, time );
 }
@@ -313,14 +369,14 @@ inline Int RegularizedSolveAfterNoPromote
              relTol, maxRefineIts, progress, time );
 }
 
-template<typename F>
+template<typename F,typename FFront>
 inline Int RegularizedSolveAfterNoPromote
 ( const DistSparseMatrix<F>& A, 
   const DistMultiVec<Base<F>>& reg,
   const DistMultiVec<Base<F>>& d,
   const DistMap& invMap, 
   const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
+  const ldl::DistFront<FFront>& front, 
         DistMultiVec<F>& B,
         ldl::DistMultiVecNodeMeta& meta,
   Base<F> relTol,
@@ -341,12 +397,8 @@ inline Int RegularizedSolveAfterNoPromote
     auto applyAInv = 
       [&]( DistMultiVec<F>& Y )
       {
-        // TODO: Switch to DistMatrixNode with large numbers of RHS
         DiagonalSolve( LEFT, NORMAL, d, Y );
-        ldl::DistMultiVecNode<F> YNodal;
-        YNodal.Pull( invMap, info, Y, meta );
-        ldl::SolveAfter( info, front, YNodal );
-        YNodal.Push( invMap, info, Y, meta );
+        FrontSolve( invMap, info, front, Y, meta );
         DiagonalSolve( LEFT, NORMAL, d, Y );
       };
 
@@ -463,7 +515,7 @@ inline Int RegularizedSolveAfterPromote
              relTol, maxRefineIts, progress, time );
 }
 
-template<typename F>
+template<typename F,typename FFront>
 inline DisableIf<IsSame<F,Promote<F>>,Int>
 RegularizedSolveAfterPromote
 ( const DistSparseMatrix<F>& A, 
@@ -471,7 +523,7 @@ RegularizedSolveAfterPromote
   const DistMultiVec<Base<F>>& d,
   const DistMap& invMap, 
   const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
+  const ldl::DistFront<FFront>& front, 
         DistMultiVec<F>& B,
         ldl::DistMultiVecNodeMeta& meta,
   Base<F> relTol,
@@ -502,10 +554,7 @@ RegularizedSolveAfterPromote
       [&]( DistMultiVec<F>& Y )
       {
         DiagonalSolve( LEFT, NORMAL, d, Y );
-        ldl::DistMultiVecNode<F> YNodal;
-        YNodal.Pull( invMap, info, Y, meta );
-        ldl::SolveAfter( info, front, YNodal );
-        YNodal.Push( invMap, info, Y, meta );
+        FrontSolve( invMap, info, front, Y, meta );
         DiagonalSolve( LEFT, NORMAL, d, Y );
       };
 
@@ -513,7 +562,7 @@ RegularizedSolveAfterPromote
            ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
 }
 
-template<typename F>
+template<typename F,typename FFront>
 inline EnableIf<IsSame<F,Promote<F>>,Int>
 RegularizedSolveAfterPromote
 ( const DistSparseMatrix<F>& A, 
@@ -521,7 +570,7 @@ RegularizedSolveAfterPromote
   const DistMultiVec<Base<F>>& d,
   const DistMap& invMap, 
   const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
+  const ldl::DistFront<FFront>& front, 
         DistMultiVec<F>& B,
         ldl::DistMultiVecNodeMeta& meta,
   Base<F> relTol,
@@ -671,14 +720,14 @@ Int LGMRESSolveAfter
     return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
 }
 
-template<typename F>
+template<typename F,typename FFront>
 Int LGMRESSolveAfter
 ( const SparseMatrix<F>& A,
   const Matrix<Base<F>>& reg,
   const Matrix<Base<F>>& d,
   const vector<Int>& invMap,
   const ldl::NodeInfo& info,
-  const ldl::Front<F>& front, 
+  const ldl::Front<FFront>& front, 
         Matrix<F>& B,
   Base<F> relTol,
   Int restart,
@@ -697,9 +746,9 @@ Int LGMRESSolveAfter
     auto precond =
       [&]( Matrix<F>& W )
       {
-        RegularizedSolveAfter
+        RegularizedSolveAfterPromote
         ( A, reg, d, invMap, info, front, W, 
-          relTolRefine, maxRefineIts, progress );
+          relTolRefine, maxRefineIts, progress, false );
       };
 
     return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
@@ -761,14 +810,14 @@ Int LGMRESSolveAfter
              relTol, restart, maxIts, relTolRefine, maxRefineIts, progress );
 }
 
-template<typename F>
+template<typename F,typename FFront>
 Int LGMRESSolveAfter
 ( const DistSparseMatrix<F>& A, 
   const DistMultiVec<Base<F>>& reg,
   const DistMultiVec<Base<F>>& d,
   const DistMap& invMap, 
   const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
+  const ldl::DistFront<FFront>& front, 
         DistMultiVec<F>& B,
         ldl::DistMultiVecNodeMeta& meta,
         Base<F> relTol,
@@ -788,9 +837,9 @@ Int LGMRESSolveAfter
     auto precond =
       [&]( DistMultiVec<F>& W )
       {
-        RegularizedSolveAfter
+        RegularizedSolveAfterPromote
         ( A, reg, d, invMap, info, front, W, meta,
-          relTolRefine, maxRefineIts, progress );
+          relTolRefine, maxRefineIts, progress, false );
       };
 
     return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
@@ -853,14 +902,14 @@ Int FGMRESSolveAfter
     return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
 }
 
-template<typename F>
+template<typename F,typename FFront>
 Int FGMRESSolveAfter
 ( const SparseMatrix<F>& A, 
   const Matrix<Base<F>>& reg,
   const Matrix<Base<F>>& d,
   const vector<Int>& invMap, 
   const ldl::NodeInfo& info,
-  const ldl::Front<F>& front, 
+  const ldl::Front<FFront>& front, 
         Matrix<F>& B,
         Base<F> relTol,
         Int restart,
@@ -880,9 +929,9 @@ Int FGMRESSolveAfter
     auto precond =
       [&]( Matrix<F>& W )
       {
-        RegularizedSolveAfter
+        RegularizedSolveAfterPromote
         ( A, reg, d, invMap, info, front, W,
-          relTolRefine, maxRefineIts, progress );
+          relTolRefine, maxRefineIts, progress, time );
       };
 
     return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
@@ -947,14 +996,14 @@ Int FGMRESSolveAfter
              progress, time );
 }
 
-template<typename F>
+template<typename F,typename FFront>
 Int FGMRESSolveAfter
 ( const DistSparseMatrix<F>& A, 
   const DistMultiVec<Base<F>>& reg,
   const DistMultiVec<Base<F>>& d,
   const DistMap& invMap, 
   const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
+  const ldl::DistFront<FFront>& front, 
         DistMultiVec<F>& B,
         ldl::DistMultiVecNodeMeta& meta,
         Base<F> relTol,
@@ -975,9 +1024,9 @@ Int FGMRESSolveAfter
     auto precond =
       [&]( DistMultiVec<F>& W )
       {
-        RegularizedSolveAfter
+        RegularizedSolveAfterPromote
         ( A, reg, d, invMap, info, front, W, meta,
-          relTolRefine, maxRefineIts, progress );
+          relTolRefine, maxRefineIts, progress, time );
       };
 
     return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
@@ -1169,6 +1218,87 @@ Int SolveAfter
     return SolveAfter( A, reg, d, invMap, info, front, B, meta, ctrl );
 }
 
+template<typename F>
+Int MixedSolveAfter
+( const SparseMatrix<F>& A, 
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap, 
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front, 
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRESSolveAfter
+        ( A, reg, d, invMap, info, front, B, 
+          ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.relTolRefine, ctrl.maxRefineIts, 
+          ctrl.progress, ctrl.time );
+    case REG_SOLVE_LGMRES:
+        return LGMRESSolveAfter
+        ( A, reg, d, invMap, info, front, B, 
+          ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.relTolRefine, ctrl.maxRefineIts, 
+          ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+template<typename F>
+Int MixedSolveAfter
+( const DistSparseMatrix<F>& A, 
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap, 
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front, 
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRESSolveAfter
+        ( A, reg, d, invMap, info, front, B, meta,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.relTolRefine, ctrl.maxRefineIts, 
+          ctrl.progress, ctrl.time );
+    case REG_SOLVE_LGMRES:
+        return LGMRESSolveAfter
+        ( A, reg, d, invMap, info, front, B, meta,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.relTolRefine, ctrl.maxRefineIts, 
+          ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+template<typename F>
+Int MixedSolveAfter
+( const DistSparseMatrix<F>& A, 
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap, 
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front, 
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    ldl::DistMultiVecNodeMeta meta;
+    return MixedSolveAfter( A, reg, d, invMap, info, front, B, meta, ctrl );
+}
+
 #define PROTO(F) \
   template Int RegularizedSolveAfter \
   ( const SparseMatrix<F>& A, \
@@ -1275,6 +1405,34 @@ Int SolveAfter
     const ldl::DistFront<F>& front, \
           DistMultiVec<F>& B, \
           ldl::DistMultiVecNodeMeta& meta, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int MixedSolveAfter \
+  ( const SparseMatrix<F>& A, \
+    const Matrix<Base<F>>& reg, \
+    const Matrix<Base<F>>& d, \
+    const vector<Int>& invMap, \
+    const ldl::NodeInfo& info, \
+    const ldl::Front<Demote<F>>& front, \
+          Matrix<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int MixedSolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistMultiVec<Base<F>>& d, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<Demote<F>>& front, \
+          DistMultiVec<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int MixedSolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistMultiVec<Base<F>>& d, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<Demote<F>>& front, \
+          DistMultiVec<F>& B, \
+          ldl::DistMultiVecNodeMeta& meta, \
     const RegSolveCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
@@ -291,6 +291,9 @@ ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl )
     ctrl->valChanRatio = 1.2;
     ctrl->fullChanRatio = 1.5;
 
+    ctrl->twoStageBidiag = false;
+    ctrl->bidiagBandwidth = 0;
+
     ElBidiagSVDCtrlDefault_s( &ctrl->bidiagSVDCtrl );
 
     return EL_SUCCESS;
@@ -306,11 +309,24 @@ ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl )
     ctrl->valChanRatio = 1.2;
     ctrl->fullChanRatio = 1.5;
 
+    ctrl->twoStageBidiag = false;
+    ctrl->bidiagBandwidth = 0;
+
     ElBidiagSVDCtrlDefault_d( &ctrl->bidiagSVDCtrl );
 
     return EL_SUCCESS;
 }
 
+/* RandomizedSVDCtrl */
+ElError ElRandomizedSVDCtrlDefault( ElRandomizedSVDCtrl* ctrl )
+{
+    ctrl->rank = 10;
+    ctrl->oversample = 10;
+    ctrl->numPowerIts = 2;
+    ctrl->seedWithV = false;
+    return EL_SUCCESS;
+}
+
 /* HessQRCtrl */
 ElError ElHessQRCtrlDefault( ElHessQRCtrl* ctrl )
 {
@@ -229,8 +229,7 @@ BlackBox
         SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
     }
 
-    // TODO(poulson): Extend interface to support accepting ctrl.tridiagCtrl
-    herm_tridiag::ExplicitCondensed( uplo, A );
+    herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
@@ -548,16 +547,16 @@ BlackBox
     DEBUG_CSE
     HermitianEigInfo info;
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
     Matrix<F> phase;
-    HermitianTridiag( uplo, A, phase );
+    HermitianTridiag( uplo, A, phase, ctrl.tridiagCtrl );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
     info.tridiagEigInfo =
       HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
 
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, phase, Q );
+    herm_tridiag::ApplyQ
+    ( LEFT, uplo, NORMAL, A, phase, Q, ctrl.tridiagCtrl );
 
     return info;
 }
@@ -578,9 +577,8 @@ BlackBox
     DistMatrixReadProxy<F,F,MC,MR> AProx( APre ); 
     auto& A = AProx.Get();
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
     DistMatrix<F,VC,STAR> phase(g);
-    HermitianTridiag( uplo, A, phase );
+    HermitianTridiag( uplo, A, phase, ctrl.tridiagCtrl );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
@@ -592,7 +590,8 @@ BlackBox
 
         info.tridiagEigInfo =
           HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
-        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, phase, Q );
+        herm_tridiag::ApplyQ
+        ( LEFT, uplo, NORMAL, A, phase, Q, ctrl.tridiagCtrl );
     }
     else
     {
@@ -601,7 +600,8 @@ BlackBox
 
         info.tridiagEigInfo =
           HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
-        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, phase, Q );
+        herm_tridiag::ApplyQ
+        ( LEFT, uplo, NORMAL, A, phase, Q, ctrl.tridiagCtrl );
     }
 
     return info;
@@ -983,7 +983,8 @@ MRRR
             timer.Start();
         }
     }
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, phase, Q );
+    herm_tridiag::ApplyQ
+    ( LEFT, uplo, NORMAL, A, phase, Q, ctrl.tridiagCtrl );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
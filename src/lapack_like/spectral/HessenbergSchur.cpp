@@ -110,6 +110,140 @@ HessenbergSchur
     }
 }
 
+namespace hess_schur {
+
+template<typename F>
+HessenbergSchurInfo
+Dist
+( DistMatrix<F>& H,
+  Matrix<Complex<Base<F>>>& w,
+  DistMatrix<F>& Z,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.useAED )
+        return AED( H, w, Z, ctrl );
+
+    // The non-AED algorithms are redundantly run on a gathered copy of H
+    const Grid& g = H.Grid();
+    DistMatrix<F,STAR,STAR> H_STAR_STAR( H ), Z_STAR_STAR( g );
+    if( ctrl.wantSchurVecs )
+        Z_STAR_STAR = Z;
+    auto ctrlMod( ctrl );
+    ctrlMod.progress = ( ctrl.progress && g.Rank() == 0 );
+    auto info =
+      HessenbergSchur( H_STAR_STAR.Matrix(), w, Z_STAR_STAR.Matrix(), ctrlMod );
+    H = H_STAR_STAR;
+    if( ctrl.wantSchurVecs )
+        Z = Z_STAR_STAR;
+    return info;
+}
+
+template<typename F>
+HessenbergSchurInfo
+Dist
+( ElementalMatrix<F>& HPre,
+  ElementalMatrix<Complex<Base<F>>>& w,
+  ElementalMatrix<F>& ZPre,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> HProx( HPre ), ZProx( ZPre );
+    auto& H = HProx.Get();
+    auto& Z = ZProx.Get();
+    const Grid& g = H.Grid();
+    const Int n = H.Height();
+
+    auto ctrlMod( ctrl );
+    ctrlMod.winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    ctrlMod.winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    ctrlMod.wantSchurVecs = true;
+
+    Matrix<Complex<Base<F>>> wLoc;
+    auto info = Dist( H, wLoc, Z, ctrlMod );
+
+    DistMatrix<Complex<Base<F>>,STAR,STAR> w_STAR_STAR( n, 1, g );
+    w_STAR_STAR.Matrix() = wLoc;
+    Copy( w_STAR_STAR, w );
+    return info;
+}
+
+template<typename F>
+HessenbergSchurInfo
+Dist
+( ElementalMatrix<F>& HPre,
+  ElementalMatrix<Complex<Base<F>>>& w,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> HProx( HPre );
+    auto& H = HProx.Get();
+    const Grid& g = H.Grid();
+    const Int n = H.Height();
+
+    auto ctrlMod( ctrl );
+    ctrlMod.winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    ctrlMod.winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    ctrlMod.wantSchurVecs = false;
+
+    DistMatrix<F> Z(g);
+    Matrix<Complex<Base<F>>> wLoc;
+    auto info = Dist( H, wLoc, Z, ctrlMod );
+
+    DistMatrix<Complex<Base<F>>,STAR,STAR> w_STAR_STAR( n, 1, g );
+    w_STAR_STAR.Matrix() = wLoc;
+    Copy( w_STAR_STAR, w );
+    return info;
+}
+
+} // namespace hess_schur
+
+template<typename Real>
+HessenbergSchurInfo
+HessenbergSchur
+( ElementalMatrix<Real>& H,
+  ElementalMatrix<Complex<Real>>& w,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    return hess_schur::Dist( H, w, ctrl );
+}
+
+template<typename Real>
+HessenbergSchurInfo
+HessenbergSchur
+( ElementalMatrix<Real>& H,
+  ElementalMatrix<Complex<Real>>& w,
+  ElementalMatrix<Real>& Z,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    return hess_schur::Dist( H, w, Z, ctrl );
+}
+
+template<typename Real>
+HessenbergSchurInfo
+HessenbergSchur
+( ElementalMatrix<Complex<Real>>& H,
+  ElementalMatrix<Complex<Real>>& w,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    return hess_schur::Dist( H, w, ctrl );
+}
+
+template<typename Real>
+HessenbergSchurInfo
+HessenbergSchur
+( ElementalMatrix<Complex<Real>>& H,
+  ElementalMatrix<Complex<Real>>& w,
+  ElementalMatrix<Complex<Real>>& Z,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    return hess_schur::Dist( H, w, Z, ctrl );
+}
+
 #define PROTO(F) \
   template HessenbergSchurInfo HessenbergSchur \
   ( Matrix<F>& H, \
@@ -119,6 +253,15 @@ HessenbergSchur
   ( Matrix<F>& H, \
     Matrix<Complex<Base<F>>>& w, \
     Matrix<F>& Z, \
+    const HessenbergSchurCtrl& ctrl ); \
+  template HessenbergSchurInfo HessenbergSchur \
+  ( ElementalMatrix<F>& H, \
+    ElementalMatrix<Complex<Base<F>>>& w, \
+    const HessenbergSchurCtrl& ctrl ); \
+  template HessenbergSchurInfo HessenbergSchur \
+  ( ElementalMatrix<F>& H, \
+    ElementalMatrix<Complex<Base<F>>>& w, \
+    ElementalMatrix<F>& Z, \
     const HessenbergSchurCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
@@ -521,6 +521,335 @@ AED
     return info;
 }
 
+namespace aed {
+
+// Form exceptional shifts from the trailing portion of the window, HTail,
+// whose top-left entry is H(tailBeg,tailBeg)
+template<typename Real>
+void ExceptionalShifts
+( const Matrix<Real>& HTail,
+        Int tailBeg,
+        Int winBeg,
+        Int winEnd,
+        Int shiftBeg,
+        Matrix<Complex<Real>>& w )
+{
+    DEBUG_CSE
+    const Real exceptShift0(Real(4)/Real(3)),
+               exceptShift1(-Real(7)/Real(16));
+    for( Int i=winEnd-1; i>=Max(shiftBeg+1,winBeg+2); i-=2 ) 
+    {
+        const Int iTail = i - tailBeg;
+        const Real scale =
+          Abs(HTail(iTail,iTail-1)) + Abs(HTail(iTail-1,iTail-2));
+        Real eta00 = exceptShift0*scale + HTail(iTail,iTail);
+        Real eta01 = scale;
+        Real eta10 = exceptShift1*scale;
+        Real eta11 = eta00;
+        schur::TwoByTwo
+        ( eta00, eta01,
+          eta10, eta11,
+          w(i-1), w(i) );
+    }
+    if( shiftBeg == winBeg )
+    {
+        const Int iTail = shiftBeg+1-tailBeg;
+        w(shiftBeg) = w(shiftBeg+1) = HTail(iTail,iTail);
+    }
+}
+
+template<typename Real>
+void ExceptionalShifts
+( const Matrix<Complex<Real>>& HTail,
+        Int tailBeg,
+        Int winBeg,
+        Int winEnd,
+        Int shiftBeg,
+        Matrix<Complex<Real>>& w )
+{
+    DEBUG_CSE
+    // For some reason, LAPACK suggests only using a single exceptional shift
+    // for complex matrices.
+    const Real exceptShift0(Real(4)/Real(3));
+    for( Int i=winEnd-1; i>=shiftBeg+1; i-=2 )
+    {
+        const Int iTail = i - tailBeg;
+        w(i-1) = w(i) =
+          HTail(iTail,iTail) + exceptShift0*OneAbs(HTail(iTail,iTail-1));
+    }
+}
+
+} // namespace aed
+
+// The distributed analogue of the above. The windows, deflations, and shifts
+// are chosen as in the sequential algorithm, but each sweep chases several
+// chains of bulges concurrently (see aed::Sweep). Only small windows of H are
+// ever redundantly stored (the AED window, the slab of each chain, and the
+// trailing submatrix used for computing shifts), and the level-3 updates of
+// the remainder of H and Z are distributed.
+//
+// The eigenvalue estimates, w, are redundantly stored on every process.
+template<typename F>
+HessenbergSchurInfo
+AED
+( DistMatrix<F>& H,
+  Matrix<Complex<Base<F>>>& w,
+  DistMatrix<F>& Z,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE 
+    typedef Base<F> Real;
+    const Int n = H.Height();
+    const Grid& g = H.Grid();
+    Int winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    Int winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    const Int winSize = winEnd - winBeg;
+    const Real zero(0);
+    const bool progress = ( ctrl.progress && g.Rank() == 0 );
+    HessenbergSchurInfo info;
+
+    if( n < ctrl.minAEDSize )
+    {
+        // Redundantly run the sequential algorithm
+        DistMatrix<F,STAR,STAR> H_STAR_STAR( H ), Z_STAR_STAR( g );
+        if( ctrl.wantSchurVecs )
+            Z_STAR_STAR = Z;
+        auto ctrlSeq( ctrl );
+        ctrlSeq.progress = progress;
+        info = AED( H_STAR_STAR.Matrix(), w, Z_STAR_STAR.Matrix(), ctrlSeq );
+        H = H_STAR_STAR;
+        if( ctrl.wantSchurVecs )
+            Z = Z_STAR_STAR;
+        return info;
+    }
+
+    w.Resize( n, 1 );
+
+    const Int numShiftsRec = ctrl.numShifts( n, winSize );
+    const Int deflationSizeRec = ctrl.deflationSize( n, winSize, numShiftsRec );
+    if( progress )
+    {
+        Output
+        ("Recommending ",numShiftsRec," shifts and a deflation window of size ",
+         deflationSizeRec);
+    }
+    Int deflationSize = deflationSizeRec;
+
+    auto ctrlSub( ctrl );
+
+    Int numIterSinceDeflation = 0;
+    const Int numStaleIterBeforeExceptional = 5;
+    // Cf. LAPACK's DLAQR0 for this choice
+    const Int maxIter =
+      Max(30,2*numStaleIterBeforeExceptional) * Max(10,winSize);
+    Int decreaseLevel = -1;
+    DistMatrix<F,STAR,STAR> hSub(g), HTail_STAR_STAR(g);
+    while( winBeg < winEnd )
+    {
+        if( info.numIterations >= maxIter )
+        {
+            if( ctrl.demandConverged )
+                RuntimeError("AED QR iteration did not converge");
+            else
+                break;
+        }
+
+        // Redundantly store the subdiagonal of the active window so that
+        // H(k,k-1) = hSub(k-1-winBeg)
+        auto winInd = IR(winBeg,winEnd);
+        hSub = GetDiagonal( H(winInd,winInd), -1 );
+        auto subdiag = [&]( Int k ) { return hSub.GetLocal(k-1-winBeg,0); };
+
+        // Detect an irreducible Hessenberg window, [iterBeg,winEnd)
+        // ---------------------------------------------------------
+        Int iterBeg=winEnd-1;
+        for( ; iterBeg>winBeg; --iterBeg )
+            if( subdiag(iterBeg) == zero ) 
+                break;
+        if( progress )
+        {
+            Output("Iter. ",info.numIterations,": ");
+            Output("  window is [",iterBeg,",",winEnd,")");
+        }
+         
+        // Intelligently choose a deflation window size
+        // --------------------------------------------
+        // Cf. LAPACK's DLAQR0 for the high-level approach
+        const Int iterWinSize = winEnd-iterBeg;
+        if( numIterSinceDeflation < numStaleIterBeforeExceptional )
+        {
+            // Use the recommendation if possible
+            deflationSize = Min( iterWinSize, deflationSizeRec );
+        }
+        else
+        {
+            // Double the size if possible
+            deflationSize = Min( iterWinSize, 2*deflationSize );
+        }
+        if( deflationSize >= iterWinSize-1 )
+        {
+            // Go ahead and increase by at most one to use the full window
+            deflationSize = iterWinSize;
+        }
+        else
+        {
+            const Int deflationBeg = winEnd - deflationSize;
+            if( OneAbs(subdiag(deflationBeg)) >
+                OneAbs(subdiag(deflationBeg-1)) )
+            {
+                ++deflationSize;
+            }
+        }
+        if( numIterSinceDeflation < numStaleIterBeforeExceptional )
+        {
+            decreaseLevel = -1; 
+        }
+        else if( decreaseLevel >= 0 || deflationSize == iterWinSize )
+        {
+            ++decreaseLevel;
+            if( deflationSize-decreaseLevel < 2 )
+                decreaseLevel = 0;
+            deflationSize -= decreaseLevel;
+        }
+
+        // Run AED on the bottom-right window of size deflationSize
+        ctrlSub.winBeg = iterBeg;
+        ctrlSub.winEnd = winEnd;
+        auto deflateInfo = aed::Nibble( H, deflationSize, w, Z, ctrlSub );
+        const Int numDeflated = deflateInfo.numDeflated;
+        winEnd -= numDeflated;
+        Int shiftBeg = winEnd - deflateInfo.numShiftCandidates;
+
+        const Int newIterWinSize = winEnd-iterBeg;
+        if( numDeflated == 0 ||
+          (numDeflated <= ctrl.sufficientDeflation(deflationSize) && 
+           newIterWinSize >= ctrl.minAEDSize) )
+        {
+            Int numShifts = Min( numShiftsRec, Max(2,newIterWinSize-1) );
+            numShifts = numShifts - Mod(numShifts,2); 
+
+            // Redundantly store the trailing submatrix which the shifts are
+            // computed from
+            const Int tailBeg = Max( Int(0), winEnd-numShifts-1 );
+            auto tailInd = IR(tailBeg,winEnd);
+            HTail_STAR_STAR = H( tailInd, tailInd );
+            auto& HTail = HTail_STAR_STAR.Matrix();
+
+            if( numIterSinceDeflation > 0 &&
+                Mod(numIterSinceDeflation,numStaleIterBeforeExceptional) == 0 )
+            {
+                // Use exceptional shifts
+                shiftBeg = winEnd - numShifts;
+                aed::ExceptionalShifts
+                ( HTail, tailBeg, winBeg, winEnd, shiftBeg, w );
+            }
+            else
+            {
+                if( winEnd-shiftBeg <= numShifts/2 )
+                {
+                    // Grab more shifts from another trailing submatrix
+                    shiftBeg = winEnd - numShifts;
+                    auto shiftsInd = IR(shiftBeg,shiftBeg+numShifts);
+                    auto tailShiftsInd = shiftsInd - tailBeg;
+                    auto HShifts = HTail(tailShiftsInd,tailShiftsInd);
+                    auto wShifts = w(shiftsInd,ALL);
+                    auto HShiftsCopy( HShifts );
+
+                    auto ctrlShifts( ctrl );
+                    ctrlShifts.winBeg = 0;
+                    ctrlShifts.winEnd = numShifts;
+                    ctrlShifts.fullTriangle = false;
+                    ctrlShifts.demandConverged = false;
+                    ctrlShifts.progress = progress;
+                    auto infoShifts =
+                      HessenbergSchur( HShiftsCopy, wShifts, ctrlShifts );
+
+                    shiftBeg += infoShifts.numUnconverged;
+                    if( shiftBeg >= winEnd-1 )
+                    {
+                        // This should be very rare; use eigenvalues of 2x2
+                        const Int iTail = winEnd-2-tailBeg;
+                        F eta00 = HTail(iTail,  iTail  );
+                        F eta01 = HTail(iTail,  iTail+1);
+                        F eta10 = HTail(iTail+1,iTail  );
+                        F eta11 = HTail(iTail+1,iTail+1);
+                        schur::TwoByTwo
+                        ( eta00, eta01,
+                          eta10, eta11,
+                          w(winEnd-2), w(winEnd-1) );
+                        shiftBeg = winEnd-2;
+                    }
+                }
+                if( winEnd-shiftBeg > numShifts )
+                {
+                    bool sorted = false;
+                    for( Int k=winEnd-1; k>shiftBeg; --k )
+                    {
+                        if( sorted )
+                            break;
+                        sorted = true;
+                        for( Int i=shiftBeg; i<k; ++i )
+                        {
+                            if( OneAbs(w(i)) < OneAbs(w(i+1)) )
+                            {
+                                sorted = false;
+                                RowSwap( w, i, i+1 );
+                            }
+                        }
+                    }
+                }
+                if( !IsComplex<F>::value )
+                {
+                    // Pair together the real shifts
+                    auto wSub = w(IR(shiftBeg,winEnd),ALL); 
+                    aed::PairShifts( wSub );
+                }
+            }
+
+            if( winBeg-shiftBeg == 2 )
+            {
+                // Use a single real shift twice instead of using two separate
+                // real shifts; we choose the one closest to the bottom-right
+                // entry, as it is our best guess as to the smallest eigenvalue
+                if( w(winEnd-1).imag() == zero ) 
+                {
+                    const Int iTail = winEnd-1-tailBeg;
+                    if( Abs(w(winEnd-1).real()-HTail(iTail,iTail)) <
+                        Abs(w(winEnd-2).real()-HTail(iTail,iTail)) )
+                    {
+                        w(winEnd-2) = w(winEnd-1);
+                    }
+                    else
+                    {
+                        w(winEnd-1) = w(winEnd-2);
+                    }
+                }
+            }
+
+            // Use the smallest magnitude shifts
+            numShifts = Min( numShifts, winEnd-shiftBeg );
+            numShifts = numShifts - Mod(numShifts,2);
+            shiftBeg = winEnd - numShifts;
+
+            // Perform a small-bulge sweep
+            auto wSub = w(IR(shiftBeg,winEnd),ALL); 
+            ctrlSub.winBeg = iterBeg;
+            ctrlSub.winEnd = winEnd;
+            aed::Sweep( H, wSub, Z, ctrlSub );
+        }
+        else if( progress )
+            Output("  Skipping QR sweep");
+
+        ++info.numIterations;
+        if( numDeflated > 0 )
+            numIterSinceDeflation = 0;
+        else
+            ++numIterSinceDeflation;
+    }
+    info.numUnconverged = winEnd-winBeg;
+    return info;
+}
+
 } // namespace hess_schur
 } // namespace El
 
@@ -0,0 +1,58 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SCHUR_HESS_AED_APPLY_UNITARY_HPP
+#define EL_SCHUR_HESS_AED_APPLY_UNITARY_HPP
+
+namespace El {
+namespace hess_schur {
+namespace aed {
+
+// Overwrite A := U' A (side=LEFT) or A := A U (side=RIGHT), where the small
+// unitary matrix U, which resulted from a computation on a redundantly-stored
+// window of a distributed Hessenberg matrix, is stored on every process.
+//
+// Only A is communicated, via a gather within each process row (or column).
+template<typename F>
+void ApplyUnitary
+( LeftOrRight side, const Matrix<F>& U, DistMatrix<F>& A )
+{
+    DEBUG_CSE
+    if( A.Height() == 0 || A.Width() == 0 )
+        return;
+    const Grid& g = A.Grid();
+
+    DistMatrix<F,STAR,STAR> U_STAR_STAR( U.Height(), U.Width(), g );
+    U_STAR_STAR.Matrix() = U;
+    if( side == LEFT )
+    {
+        DistMatrix<F,STAR,MC> U_STAR_MC(g);
+        DistMatrix<F,STAR,MR> A_STAR_MR(g);
+        U_STAR_MC.AlignWith( A );
+        A_STAR_MR.AlignWith( A );
+        U_STAR_MC = U_STAR_STAR;
+        A_STAR_MR = A;
+        LocalGemm( ADJOINT, NORMAL, F(1), U_STAR_MC, A_STAR_MR, F(0), A );
+    }
+    else
+    {
+        DistMatrix<F,MC,STAR> A_MC_STAR(g);
+        DistMatrix<F,STAR,MR> U_STAR_MR(g);
+        A_MC_STAR.AlignWith( A );
+        U_STAR_MR.AlignWith( A );
+        A_MC_STAR = A;
+        U_STAR_MR = U_STAR_STAR;
+        LocalGemm( NORMAL, NORMAL, F(1), A_MC_STAR, U_STAR_MR, F(0), A );
+    }
+}
+
+} // namespace aed
+} // namespace hess_schur
+} // namespace El
+
+#endif // ifndef EL_SCHUR_HESS_AED_APPLY_UNITARY_HPP
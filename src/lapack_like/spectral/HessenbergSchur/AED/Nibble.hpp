@@ -10,6 +10,7 @@
 #define EL_SCHUR_HESS_AED_NIBBLE_HPP
 
 #include "./SpikeDeflation.hpp"
+#include "./ApplyUnitary.hpp"
 
 namespace El {
 namespace hess_schur {
@@ -425,6 +426,87 @@ AEDInfo Nibble
     return info;
 }
 
+
+// The deflation window is small enough that every process redundantly runs the
+// sequential algorithm on a copy of it (along with the row containing the
+// spike); only the application of the resulting unitary matrix to the
+// off-window portions of H and Z is distributed.
+template<typename F>
+AEDInfo Nibble
+( DistMatrix<F>& H,
+  Int deflationSize,
+  Matrix<Complex<Base<F>>>& w,
+  DistMatrix<F>& Z,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    const Int n = H.Height();
+    Int winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    Int winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    const Grid& g = H.Grid();
+    AEDInfo info;
+
+    if( winBeg > winEnd )
+        return info;
+    if( deflationSize < 1 )
+        return info;
+
+    const Int blockSize = Min( deflationSize, winEnd-winBeg );
+    const Int deflateBeg = winEnd-blockSize;
+    const Int offset = ( deflateBeg==winBeg ? 0 : 1 );
+    const Int localSize = blockSize + offset;
+
+    auto localInd = IR(deflateBeg-offset,winEnd);
+    DistMatrix<F,STAR,STAR> HLoc_STAR_STAR( H(localInd,localInd) );
+    auto& HLoc = HLoc_STAR_STAR.Matrix();
+    const F spikeValue = ( offset==0 ? F(0) : HLoc(1,0) );
+
+    Matrix<F> ZLoc;
+    Identity( ZLoc, localSize, localSize );
+    auto wLoc = w( localInd, ALL );
+    auto ctrlLoc( ctrl );
+    ctrlLoc.winBeg = 0;
+    ctrlLoc.winEnd = localSize;
+    ctrlLoc.fullTriangle = false;
+    ctrlLoc.wantSchurVecs = true;
+    ctrlLoc.progress = ( ctrl.progress && g.Rank() == 0 );
+    info = Nibble( HLoc, blockSize, wLoc, ZLoc, ctrlLoc );
+
+    // Write back the deflation window and its spike (the row above the window
+    // is updated below along with the rest of the off-window entries)
+    auto deflateInd = IR(deflateBeg,winEnd);
+    auto H11 = H( deflateInd, deflateInd );
+    auto localDeflateInd = IR(offset,localSize);
+    DistMatrix<F,STAR,STAR> H11_STAR_STAR( blockSize, blockSize, g );
+    H11_STAR_STAR.Matrix() = HLoc( localDeflateInd, localDeflateInd );
+    H11 = H11_STAR_STAR;
+    if( offset == 1 )
+        H.Set( deflateBeg, deflateBeg-1, HLoc(1,0) );
+
+    const Int spikeSize = info.numUnconverged + info.numShiftCandidates;
+    if( blockSize > 1 && (spikeSize < blockSize || spikeValue == F(0)) )
+    {
+        auto V = ZLoc( localDeflateInd, localDeflateInd );
+
+        const Int applyBeg = ( ctrl.fullTriangle ? 0 : winBeg );
+        auto H01 = H( IR(applyBeg,deflateBeg), deflateInd );
+        ApplyUnitary( RIGHT, V, H01 );
+
+        if( ctrl.fullTriangle )
+        {
+            auto H12 = H( deflateInd, IR(winEnd,END) );
+            ApplyUnitary( LEFT, V, H12 );
+        }
+
+        if( ctrl.wantSchurVecs )
+        {
+            auto Z1 = Z( ALL, deflateInd );
+            ApplyUnitary( RIGHT, V, Z1 );
+        }
+    }
+    return info;
+}
+
 } // namespace aed
 } // namespace hess_schur
 } // namespace El
@@ -9,6 +9,8 @@
 #ifndef EL_SCHUR_HESS_AED_SWEEP_HPP
 #define EL_SCHUR_HESS_AED_SWEEP_HPP
 
+#include "./ApplyUnitary.hpp"
+
 namespace El {
 namespace hess_schur {
 namespace aed {
@@ -936,6 +938,215 @@ void Sweep
     }
 }
 
+
+// Chase a packet of bulges through the slab beginning at ghostCol using a
+// local copy, HLoc, of H(locInd,locInd), where locInd begins at locBeg, and
+// accumulate the reflections into U
+template<typename F>
+void ChaseSlab
+( Matrix<F>& HLoc,
+  Int locBeg,
+  Int winBeg,
+  Int winEnd,
+  Int ghostCol,
+  Matrix<Complex<Base<F>>>& shifts,
+  Matrix<F>& U,
+  Matrix<F>& W )
+{
+    DEBUG_CSE
+    const Int numBulges = shifts.Height() / 2;
+    const Int ghostEnd = winEnd-2;
+    const Int ghostStride = 3*(numBulges-1) + 1;
+    const Int slabSize = 3*numBulges + ghostStride;
+    const Int slabEnd = ghostCol + slabSize;
+
+    W.Resize( 3, numBulges );
+    Identity( U, slabSize-1, slabSize-1 );
+
+    Matrix<F> ZDummy;
+    const Int packetEnd = Min(ghostCol+ghostStride,ghostEnd);
+    for( Int packetBeg=ghostCol; packetBeg<packetEnd; ++packetBeg )
+    {
+        const Int fullBeg = Max( 0, ((winBeg-1)-packetBeg+2)/3 );
+        const Int fullEnd = Min( numBulges, (winEnd-packetBeg-1)/3 );
+        const bool have3x3 =
+          ( fullEnd < numBulges && packetBeg+3*fullEnd == winEnd-3 );
+
+        ComputeReflectors
+        ( HLoc, winBeg-locBeg, shifts, W, packetBeg-locBeg,
+          fullBeg, fullEnd, have3x3 );
+
+        const Int transformBeg = Max( winBeg, ghostCol );
+        const Int transformEnd = Min( slabEnd, winEnd );
+        ApplyReflectorsOpt
+        ( HLoc, winBeg-locBeg, winEnd-locBeg,
+          slabSize, ghostCol-locBeg, packetBeg-locBeg,
+          transformBeg-locBeg, transformEnd-locBeg,
+          ZDummy, false, U, W,
+          fullBeg, fullEnd, have3x3, true );
+    }
+}
+
+// The shifts are split into ctrl.numBulgeChains chains of bulges (by default,
+// one per process), with the first chain leading the rest down the diagonal.
+// Each movement of a chain only modifies a diagonal window of H (the slab) and
+// then updates the off-diagonal portions of the rows and columns of the slab
+// with the accumulated unitary matrix. Since the updates of disjoint slabs
+// commute, every chain whose slab does not overlap that of the chain ahead of
+// it is moved in each round, with each such chain chased by a different
+// process through a gathered copy of its slab. The off-diagonal updates are
+// then distributed over the process grid.
+//
+// Applying the chains one after another is equivalent to a sequence of
+// small-bulge sweeps using the shifts of each chain.
+template<typename F>
+void Sweep
+( DistMatrix<F>& H,
+  Matrix<Complex<Base<F>>>& shifts,
+  DistMatrix<F>& Z,
+  const HessenbergSchurCtrl& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Real realZero(0);
+    const Int n = H.Height();
+    const Grid& g = H.Grid();
+    Int winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    Int winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+
+    const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+      if( numShifts < 2 )
+          LogicError("Expected at least one pair of shifts..."); 
+      if( numShifts % 2 != 0 )
+          LogicError("Expected an even number of sweeps");
+    )
+    const Int numBulges = numShifts / 2;
+
+    if( !IsComplex<F>::value )
+        PairShifts( shifts );
+
+    H.Set( winBeg+2, winBeg, realZero );
+
+    // Split the (paired) shifts into contiguous chains of bulges
+    const Int numChainsRec =
+      ( ctrl.numBulgeChains > 0 ? ctrl.numBulgeChains : g.Size() );
+    const Int numChains = Min( numChainsRec, numBulges );
+    vector<Matrix<Complex<Real>>> chainShifts(numChains);
+    vector<Int> ghostCols(numChains), ghostStrides(numChains),
+      slabSizes(numChains);
+    for( Int c=0; c<numChains; ++c )
+    {
+        const Int bulgeBeg = (c*numBulges) / numChains;
+        const Int bulgeEnd = ((c+1)*numBulges) / numChains;
+        const Int chainBulges = bulgeEnd - bulgeBeg;
+        chainShifts[c] = shifts( IR(2*bulgeBeg,2*bulgeEnd), ALL );
+
+        // See the sequential implementation for a description of the packet
+        // movement
+        ghostCols[c] = (winBeg-1) - 3*(chainBulges-1);
+        ghostStrides[c] = 3*(chainBulges-1) + 1;
+        slabSizes[c] = 3*chainBulges + ghostStrides[c];
+    }
+    const Int ghostEnd = winEnd-2;
+
+    // The chase of a chain modifies H within [Max(winBeg,ghostCol),slabEnd)
+    // (and the last row formation may touch row slabEnd), while vigilant
+    // deflation can read up to three columns to the left of the slab
+    auto locBeg = [&]( Int c ) { return Max( winBeg, ghostCols[c]-3 ); };
+    auto locEnd =
+      [&]( Int c ) { return Min( ghostCols[c]+slabSizes[c]+1, winEnd ); };
+
+    const Int transformBeg = ( ctrl.fullTriangle ? 0 : winBeg );
+    const Int transformEnd = ( ctrl.fullTriangle ? n : winEnd );
+
+    vector<Int> active;
+    vector<Matrix<F>> HLocs, Us;
+    Matrix<F> W;
+    DistMatrix<F,STAR,STAR> HLoc_STAR_STAR(g);
+    while( true )
+    {
+        // Each chain moves if its slab is disjoint from that of the chain
+        // ahead of it
+        active.resize( 0 );
+        for( Int c=0; c<numChains; ++c )
+        {
+            if( ghostCols[c] >= ghostEnd )
+                continue;
+            if( c > 0 && ghostCols[c-1] < ghostEnd && locEnd(c) > locBeg(c-1) )
+                continue;
+            active.push_back( c );
+        }
+        const Int numActive = active.size();
+        if( numActive == 0 )
+            break;
+
+        // Gather the slabs and concurrently chase each chain through its slab
+        HLocs.resize( numActive );
+        Us.resize( numActive );
+        for( Int k=0; k<numActive; ++k )
+        {
+            const Int c = active[k];
+            const int owner = k % g.Size();
+            auto locInd = IR(locBeg(c),locEnd(c));
+            HLoc_STAR_STAR = H( locInd, locInd );
+            HLocs[k] = HLoc_STAR_STAR.Matrix();
+            if( g.VCRank() == owner )
+                ChaseSlab
+                ( HLocs[k], locBeg(c), winBeg, winEnd, ghostCols[c],
+                  chainShifts[c], Us[k], W );
+            else
+                Zeros( Us[k], slabSizes[c]-1, slabSizes[c]-1 );
+        }
+
+        for( Int k=0; k<numActive; ++k )
+        {
+            const Int c = active[k];
+            const int owner = k % g.Size();
+            const Int ghostCol = ghostCols[c];
+            const Int slabSize = slabSizes[c];
+            // Note that this slab endpoint may be past winEnd
+            const Int slabEnd = ghostCol + slabSize;
+            Broadcast( HLocs[k], g.VCComm(), owner );
+            Broadcast( Us[k], g.VCComm(), owner );
+
+            auto locInd = IR(locBeg(c),locEnd(c));
+            auto HSlab = H( locInd, locInd );
+            HLoc_STAR_STAR.Resize( HLocs[k].Height(), HLocs[k].Width() );
+            HLoc_STAR_STAR.Matrix() = HLocs[k];
+            HSlab = HLoc_STAR_STAR;
+
+            const Int slabRelBeg = Max(0,(winBeg-1)-ghostCol);
+            const Int nU = (slabSize-1) - Max(0,slabEnd-winEnd) - slabRelBeg;
+
+            auto contractInd = IR(0,nU) + slabRelBeg;
+            auto UAccum = Us[k]( contractInd, contractInd );
+
+            // Horizontal far-from-diagonal application
+            const Int rightIndBeg = Min(ghostCol+slabSize,winEnd);
+            const Int rightIndEnd = transformEnd;
+            const auto rightInd = IR(rightIndBeg,rightIndEnd);
+            auto horzInd = IR(0,nU) + (ghostCol+slabRelBeg+1);
+            auto HHorzFar = H( horzInd, rightInd );
+            ApplyUnitary( LEFT, UAccum, HHorzFar );
+
+            // Vertical far-from-diagonal application
+            auto vertInd = IR(transformBeg,Max(winBeg,ghostCol));
+            auto HVertFar = H( vertInd, horzInd );
+            ApplyUnitary( RIGHT, UAccum, HVertFar );
+
+            if( ctrl.wantSchurVecs )
+            {
+                auto ZSub = Z( ALL, horzInd );
+                ApplyUnitary( RIGHT, UAccum, ZSub );
+            }
+        }
+
+        for( Int k=0; k<numActive; ++k )
+            ghostCols[active[k]] += ghostStrides[active[k]];
+    }
+}
+
 } // namespace aed
 } // namespace hess_schur
 } // namespace El
@@ -0,0 +1,201 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename F>
+void RandomizedRange
+( const Matrix<F>& A,
+  const Matrix<F>& guess,
+        Matrix<F>& Q,
+        Int numCols,
+        Int numPowerIts )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numSketch = Min(numCols,Min(m,n));
+    const Int numGuess = Min(guess.Width(),numSketch);
+    DEBUG_ONLY(
+      if( numGuess > 0 && guess.Height() != n )
+          LogicError("The guess must have as many rows as A has columns");
+    )
+
+    Matrix<F> Omega;
+    Gaussian( Omega, n, numSketch );
+    if( numGuess > 0 )
+    {
+        auto OmegaL = Omega( ALL, IR(0,numGuess) );
+        OmegaL = guess( ALL, IR(0,numGuess) );
+    }
+
+    // Orthogonalize after each application of A or A^H to prevent the
+    // sketch from collapsing onto the dominant singular vector
+    Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+    qr::ExplicitUnitary( Q );
+    for( Int it=0; it<numPowerIts; ++it )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), A, Q, Omega );
+        qr::ExplicitUnitary( Omega );
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+        qr::ExplicitUnitary( Q );
+    }
+}
+
+template<typename F>
+void RandomizedRange
+( const ElementalMatrix<F>& APre,
+  const ElementalMatrix<F>& guessPre,
+        ElementalMatrix<F>& Q,
+        Int numCols,
+        Int numPowerIts )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre ), guessProx( guessPre );
+    auto& A = AProx.GetLocked();
+    auto& guess = guessProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numSketch = Min(numCols,Min(m,n));
+    const Int numGuess = Min(guess.Width(),numSketch);
+    DEBUG_ONLY(
+      if( numGuess > 0 && guess.Height() != n )
+          LogicError("The guess must have as many rows as A has columns");
+    )
+
+    DistMatrix<F> Omega(g);
+    Gaussian( Omega, n, numSketch );
+    if( numGuess > 0 )
+    {
+        auto OmegaL = Omega( ALL, IR(0,numGuess) );
+        OmegaL = guess( ALL, IR(0,numGuess) );
+    }
+
+    Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+    qr::ExplicitUnitary( Q );
+    for( Int it=0; it<numPowerIts; ++it )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), A, Q, Omega );
+        qr::ExplicitUnitary( Omega );
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+        qr::ExplicitUnitary( Q );
+    }
+}
+
+template<typename F>
+void RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedSVDCtrl& ctrl )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int rank = Min(ctrl.rank,Min(m,n));
+
+    Matrix<F> Q;
+    if( ctrl.seedWithV )
+    {
+        Matrix<F> guess( V );
+        RandomizedRange
+        ( A, guess, Q, rank+ctrl.oversample, ctrl.numPowerIts );
+    }
+    else
+        RandomizedRange
+        ( A, Matrix<F>(), Q, rank+ctrl.oversample, ctrl.numPowerIts );
+
+    // Since A ~= Q Q^H A, the SVD of the short matrix Q^H A yields that of A,
+    // of which only the leading 'rank' triplets are kept
+    Matrix<F> B, UB, VB;
+    Matrix<Base<F>> sB;
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, B );
+    SVD( B, UB, sB, VB );
+    Gemm( NORMAL, NORMAL, F(1), Q, UB(ALL,IR(0,rank)), U );
+    s = sB( IR(0,rank), ALL );
+    V = VB( ALL, IR(0,rank) );
+}
+
+template<typename F>
+void RandomizedSVD
+( const ElementalMatrix<F>& APre,
+        ElementalMatrix<F>& U,
+        ElementalMatrix<Base<F>>& s,
+        ElementalMatrix<F>& VPre,
+  const RandomizedSVDCtrl& ctrl )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> VProx( VPre );
+    auto& A = AProx.GetLocked();
+    auto& V = VProx.Get();
+    const Grid& g = A.Grid();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int rank = Min(ctrl.rank,Min(m,n));
+
+    DistMatrix<F> Q(g);
+    if( ctrl.seedWithV )
+    {
+        DistMatrix<F> guess( V );
+        RandomizedRange
+        ( A, guess, Q, rank+ctrl.oversample, ctrl.numPowerIts );
+    }
+    else
+        RandomizedRange
+        ( A, DistMatrix<F>(g), Q, rank+ctrl.oversample, ctrl.numPowerIts );
+
+    DistMatrix<F> B(g), UB(g), VB(g);
+    DistMatrix<Base<F>,STAR,STAR> sB(g);
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, B );
+    SVD( B, UB, sB, VB );
+    Gemm( NORMAL, NORMAL, F(1), Q, UB(ALL,IR(0,rank)), U );
+    Copy( sB(IR(0,rank),ALL), s );
+    V = VB( ALL, IR(0,rank) );
+}
+
+#define PROTO(F) \
+  template void RandomizedRange \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& guess, \
+          Matrix<F>& Q, \
+          Int numCols, \
+          Int numPowerIts ); \
+  template void RandomizedRange \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& guess, \
+          ElementalMatrix<F>& Q, \
+          Int numCols, \
+          Int numPowerIts ); \
+  template void RandomizedSVD \
+  ( const Matrix<F>& A, \
+          Matrix<F>& U, \
+          Matrix<Base<F>>& s, \
+          Matrix<F>& V, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template void RandomizedSVD \
+  ( const ElementalMatrix<F>& A, \
+          ElementalMatrix<F>& U, \
+          ElementalMatrix<Base<F>>& s, \
+          ElementalMatrix<F>& V, \
+    const RandomizedSVDCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
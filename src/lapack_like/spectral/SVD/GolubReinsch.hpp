@@ -37,10 +37,13 @@ SVDInfo GolubReinsch
 
     // Bidiagonalize A
     Timer timer;
-    Matrix<F> phaseP, phaseQ;
+    Matrix<F> phaseP, phaseQ, chase;
     if( ctrl.time )
         timer.Start();
-    Bidiag( A, phaseP, phaseQ );
+    if( ctrl.twoStageBidiag )
+        bidiag::TwoStage( A, phaseP, phaseQ, chase, ctrl.bidiagBandwidth );
+    else
+        Bidiag( A, phaseP, phaseQ );
     if( ctrl.time )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
@@ -60,8 +63,17 @@ SVDInfo GolubReinsch
     // Backtransform U and V
     if( ctrl.time )
         timer.Start();
-    if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, phaseQ, U );
-    if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, phaseP, V );
+    if( ctrl.twoStageBidiag )
+    {
+        const Int bw = ctrl.bidiagBandwidth;
+        if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, phaseQ, chase, U, bw );
+        if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, phaseP, chase, V, bw );
+    }
+    else
+    {
+        if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, phaseQ, U );
+        if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, phaseP, V );
+    }
     if( ctrl.time )
         Output("GolubReinsch backtransformation: ",timer.Stop()," seconds");
 
@@ -92,9 +104,13 @@ SVDInfo GolubReinsch
     // Bidiagonalize A
     Timer timer;
     DistMatrix<F,STAR,STAR> phaseP(g), phaseQ(g);
+    DistMatrix<F> chase(g);
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    Bidiag( A, phaseP, phaseQ );
+    if( ctrl.twoStageBidiag )
+        bidiag::TwoStage( A, phaseP, phaseQ, chase, ctrl.bidiagBandwidth );
+    else
+        Bidiag( A, phaseP, phaseQ );
     if( ctrl.time && g.Rank() == 0 )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
@@ -119,8 +135,17 @@ SVDInfo GolubReinsch
     // Backtransform U and V
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, phaseQ, U );
-    if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, phaseP, V );
+    if( ctrl.twoStageBidiag )
+    {
+        const Int bw = ctrl.bidiagBandwidth;
+        if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, phaseQ, chase, U, bw );
+        if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, phaseP, chase, V, bw );
+    }
+    else
+    {
+        if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, phaseQ, U );
+        if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, phaseP, V );
+    }
     if( ctrl.time && g.Rank() == 0 )
         Output("GolubReinsch backtransformation: ",timer.Stop()," seconds");
 
@@ -159,10 +184,13 @@ SVDInfo GolubReinsch
 
     // Bidiagonalize A
     Timer timer;
-    Matrix<F> phaseP, phaseQ;
+    Matrix<F> phaseP, phaseQ, chase;
     if( ctrl.time )
         timer.Start();
-    Bidiag( A, phaseP, phaseQ );
+    if( ctrl.twoStageBidiag )
+        bidiag::TwoStage( A, phaseP, phaseQ, chase, ctrl.bidiagBandwidth );
+    else
+        Bidiag( A, phaseP, phaseQ );
     if( ctrl.time )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
@@ -197,9 +225,13 @@ SVDInfo GolubReinsch
     // Bidiagonalize A
     Timer timer;
     DistMatrix<F,STAR,STAR> phaseP(g), phaseQ(g);
+    DistMatrix<F> chase(g);
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    Bidiag( A, phaseP, phaseQ );
+    if( ctrl.twoStageBidiag )
+        bidiag::TwoStage( A, phaseP, phaseQ, chase, ctrl.bidiagBandwidth );
+    else
+        Bidiag( A, phaseP, phaseQ );
     if( ctrl.time && g.Rank() == 0 )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
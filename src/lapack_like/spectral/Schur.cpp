@@ -62,7 +62,6 @@ void Schur
   const SchurCtrl<Base<F>> ctrl )
 {
     DEBUG_CSE
-#ifdef EL_HAVE_SCALAPACK
     if( ctrl.useSDC )
     {
         if( fullTriangle )
@@ -77,15 +76,6 @@ void Schur
     {
         schur::QR( A, w, fullTriangle, ctrl.qrCtrl, ctrl.time );
     }
-#else
-    if( fullTriangle )
-    {
-        DistMatrix<F> Q(A.Grid());
-        schur::SDC( A, w, Q, fullTriangle, ctrl.sdcCtrl );
-    }
-    else
-        schur::SDC( A, w, ctrl.sdcCtrl );
-#endif
 }
 
 template<typename F>
@@ -108,14 +98,10 @@ void Schur
   const SchurCtrl<Base<F>> ctrl )
 {
     DEBUG_CSE
-#ifdef EL_HAVE_SCALAPACK
     if( ctrl.useSDC )
         schur::SDC( A, w, Q, fullTriangle, ctrl.sdcCtrl );
     else
         schur::QR( A, w, Q, fullTriangle, ctrl.qrCtrl, ctrl.time );
-#else
-    schur::SDC( A, w, Q, fullTriangle, ctrl.sdcCtrl );
-#endif
 }
 
 template<typename F>
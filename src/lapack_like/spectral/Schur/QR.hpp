@@ -255,14 +255,12 @@ void QR
   bool time=false )
 {
     DEBUG_CSE
-    AssertScaLAPACKSupport();
-
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-#ifdef EL_HAVE_SCALAPACK
     Timer timer;
     const int gridRank = A.Grid().Rank();
+#ifdef EL_HAVE_SCALAPACK
 
     // Reduce the matrix to upper-Hessenberg form in an elemental form
     DistMatrix<F,STAR,STAR> t( A.Grid() );
@@ -323,6 +321,28 @@ void QR
     // TODO: Cache context, handle, and exit BLACS during El::Finalize()
     blacs::FreeGrid( context );
     blacs::FreeHandle( bHandle );
+#else
+    // Reduce to upper-Hessenberg form and run the native distributed
+    // multishift QR algorithm with aggressive early deflation
+    DistMatrix<F,STAR,STAR> t( A.Grid() );
+    if( time && gridRank == 0 )
+        timer.Start();
+    Hessenberg( UPPER, A, t );
+    if( time && gridRank == 0 )
+        Output("  Hessenberg: ",timer.Stop()," seconds");
+    MakeTrapezoidal( UPPER, A, -1 );
+
+    HessenbergSchurCtrl hessSchurCtrl;
+    hessSchurCtrl.fullTriangle = fullTriangle;
+    hessSchurCtrl.wantSchurVecs = false;
+    hessSchurCtrl.demandConverged = true;
+    hessSchurCtrl.useAED = true;
+    hessSchurCtrl.recursiveAED = true;
+    if( time && gridRank == 0 )
+        timer.Start();
+    HessenbergSchur( A, w, hessSchurCtrl );
+    if( time && gridRank == 0 )
+        Output("  HessenbergSchur: ",timer.Stop()," seconds");
 #endif
     if( IsComplex<F>::value )
         MakeTrapezoidal( UPPER, A );
@@ -343,14 +363,11 @@ void QR
   bool time=false )
 {
     DEBUG_CSE
-    AssertScaLAPACKSupport();
-
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
     auto& A = AProx.Get();
     auto& Q = QProx.Get();
 
-#ifdef EL_HAVE_SCALAPACK
     Timer timer;
     const int gridRank = A.Grid().Rank();
 
@@ -372,6 +389,8 @@ void QR
         Output("  hessenberg::FormQ: ",timer.Stop()," seconds");
     MakeTrapezoidal( UPPER, A, -1 );
 
+#ifdef EL_HAVE_SCALAPACK
+
     // Run the Hessenberg QR algorithm in block form
     const Int mb = ctrl.blockHeight;
     const Int nb = ctrl.blockWidth;
@@ -416,6 +435,20 @@ void QR
     // TODO: Cache context, handle, and exit BLACS during El::Finalize()
     blacs::FreeGrid( context );
     blacs::FreeHandle( bHandle );
+#else
+    // Run the native distributed multishift QR algorithm with aggressive
+    // early deflation, accumulating the Schur vectors into Q
+    HessenbergSchurCtrl hessSchurCtrl;
+    hessSchurCtrl.fullTriangle = fullTriangle;
+    hessSchurCtrl.wantSchurVecs = true;
+    hessSchurCtrl.demandConverged = true;
+    hessSchurCtrl.useAED = true;
+    hessSchurCtrl.recursiveAED = true;
+    if( time && gridRank == 0 )
+        timer.Start();
+    HessenbergSchur( A, w, Q, hessSchurCtrl );
+    if( time && gridRank == 0 )
+        Output("  HessenbergSchur: ",timer.Stop()," seconds");
 #endif
     if( IsComplex<F>::value )
         MakeTrapezoidal( UPPER, A );
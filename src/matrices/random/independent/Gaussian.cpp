@@ -12,22 +12,64 @@
 
 namespace El {
 
+namespace {
+
+template<typename F,typename=EnableIf<IsCounterSampled<F>>>
+void CounterGaussian
+( Matrix<F>& A, const PhiloxKey& key,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  F mean, Base<F> stddev )
+{
+    auto sampleNormal = [&]( const PhiloxBits& bits )
+      { return CounterSampleNormal( bits, mean, stddev ); };
+    CounterFill
+    ( A, key, colShift, colStride, rowShift, rowStride, sampleNormal );
+}
+
+template<typename F,typename=DisableIf<IsCounterSampled<F>>,typename=void>
+void CounterGaussian
+( Matrix<F>& A, const PhiloxKey& key,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  F mean, Base<F> stddev )
+{ LogicError("Counter-based sampling is not supported for this type"); }
+
+} // anonymous namespace
+
 // Draw each entry from a normal PDF
 template<typename F>
 void MakeGaussian( Matrix<F>& A, F mean, Base<F> stddev )
 {
     DEBUG_CSE
-    auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
-    EntrywiseFill( A, function<F()>(sampleNormal) );
+    if( IsCounterSampled<F>::value )
+    {
+        CounterGaussian( A, LocalCounterKey(), 0, 1, 0, 1, mean, stddev );
+    }
+    else
+    {
+        auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
+        EntrywiseFill( A, function<F()>(sampleNormal) );
+    }
 }
 
 template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     DEBUG_CSE
-    if( A.RedundantRank() == 0 )
-        MakeGaussian( A.Matrix(), mean, stddev );
-    Broadcast( A, A.RedundantComm(), 0 );
+    if( IsCounterSampled<F>::value && A.Wrap() == ELEMENT )
+    {
+        // See MakeUniform
+        const PhiloxKey key = DistCounterKey( A.Grid().ViewingComm() );
+        CounterGaussian
+        ( A.Matrix(), key,
+          A.ColShift(), A.ColStride(), A.RowShift(), A.RowStride(),
+          mean, stddev );
+    }
+    else
+    {
+        if( A.RedundantRank() == 0 )
+            MakeGaussian( A.Matrix(), mean, stddev );
+        Broadcast( A, A.RedundantComm(), 0 );
+    }
 }
 
 template<typename F>
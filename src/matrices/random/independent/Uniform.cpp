@@ -12,14 +12,43 @@
 
 namespace El {
 
+namespace {
+
+template<typename T,typename=EnableIf<IsCounterSampled<T>>>
+void CounterUniform
+( Matrix<T>& A, const PhiloxKey& key,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  T center, Base<T> radius )
+{
+    auto sampleBall = [&]( const PhiloxBits& bits )
+      { return CounterSampleBall( bits, center, radius ); };
+    CounterFill( A, key, colShift, colStride, rowShift, rowStride, sampleBall );
+}
+
+template<typename T,typename=DisableIf<IsCounterSampled<T>>,typename=void>
+void CounterUniform
+( Matrix<T>& A, const PhiloxKey& key,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  T center, Base<T> radius )
+{ LogicError("Counter-based sampling is not supported for this type"); }
+
+} // anonymous namespace
+
 // Draw each entry from a uniform PDF over a closed ball.
 
 template<typename T>
 void MakeUniform( Matrix<T>& A, T center, Base<T> radius )
 {
     DEBUG_CSE
-    auto sampleBall = [=]() { return SampleBall(center,radius); };
-    EntrywiseFill( A, function<T()>(sampleBall) );
+    if( IsCounterSampled<T>::value )
+    {
+        CounterUniform( A, LocalCounterKey(), 0, 1, 0, 1, center, radius );
+    }
+    else
+    {
+        auto sampleBall = [=]() { return SampleBall(center,radius); };
+        EntrywiseFill( A, function<T()>(sampleBall) );
+    }
 }
 
 template<typename T>
@@ -34,9 +63,22 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     DEBUG_CSE
-    if( A.RedundantRank() == 0 )
-        MakeUniform( A.Matrix(), center, radius );
-    Broadcast( A, A.RedundantComm(), 0 );
+    if( IsCounterSampled<T>::value && A.Wrap() == ELEMENT )
+    {
+        // Every entry is a function of its global indices, so the result is
+        // independent of the distribution and redundant copies agree
+        const PhiloxKey key = DistCounterKey( A.Grid().ViewingComm() );
+        CounterUniform
+        ( A.Matrix(), key,
+          A.ColShift(), A.ColStride(), A.RowShift(), A.RowStride(),
+          center, radius );
+    }
+    else
+    {
+        if( A.RedundantRank() == 0 )
+            MakeUniform( A.Matrix(), center, radius );
+        Broadcast( A, A.RedundantComm(), 0 );
+    }
 }
 
 template<typename T>
@@ -225,6 +225,174 @@ Matrix<Real> PrunedUpperBounds( Int n, Real normUpperBound, bool linear )
     return upperBounds;
 }
 
+// Form the scaled Gaussian Normal Form of the basis used by a trial of GNR
+// enumeration. Since we will manually build up a (weakly) pseudorandom
+// unimodular matrix so that the probabalistic enumerations traverse
+// different paths, we must keep track of the unimodular matrix so that
+// 'v' can be returned relative to the original lattice basis.
+template<typename F>
+void GNRTrialBasis
+( const Matrix<F>& B,
+        bool randomize,
+        Matrix<F>& U,
+        Matrix<Base<F>>& d,
+        Matrix<F>& N,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const Int minDim = Min(m,n);
+    Timer timer;
+
+    auto BNew( B );
+    Identity( U, n, n );
+    if( randomize )
+    {
+        // Apply a small random unimodular transformation to B
+        const Int numCombines = n;
+        for( Int j=0; j<numCombines; ++j )
+        {
+            const Int c = SampleUniform( Int(0), n );
+            const Int scale = SampleUniform( Int(-5), Int(5) );
+            if( c == j || scale == 0 )
+                continue; // if scale=-1, we could have singularity
+            if( ctrl.progress )
+                Output("  B(:,",j,") += ",scale,"*B(:,",c,")");
+
+            auto bj = BNew( ALL, j );
+            auto bc = BNew( ALL, c );
+            Axpy( scale, bc, bj );
+
+            auto uj = U(ALL,j);
+            auto uc = U(ALL,c);
+            Axpy( scale, uc, uj );
+        }
+
+        // The BKZ does not need to be particularly powerful
+        BKZCtrl<Real> bkzCtrl;
+        bkzCtrl.jumpstart = true; // accumulate into U
+        bkzCtrl.blocksize = 10;
+        bkzCtrl.recursive = false;
+        bkzCtrl.lllCtrl.recursive = false;
+        if( ctrl.time )
+            timer.Start();
+        Matrix<F> R;
+        BKZ( BNew, U, R, bkzCtrl );
+        if( ctrl.time )
+            Output("  Fix-up BKZ: ",timer.Stop()," seconds");
+    }
+    auto RNew( BNew );
+    qr::ExplicitTriang( RNew ); 
+
+    d = GetRealPartOfDiagonal( RNew );
+    N = RNew;
+    auto NT = N( IR(0,minDim), ALL );
+    DiagonalSolve( LEFT, NORMAL, d, NT );
+}
+
+// Run up to 'ctrl.numTrials' randomized trials of GNR enumeration and return
+// the result of the first successful one (with 'v' relative to B).
+//
+// In parallel mode, the bases for a batch of trials are formed sequentially
+// (so that neither the random number generator nor BKZ is shared between
+// threads) and the enumerations of the batch are then run concurrently. The
+// earliest successful trial of the batch is kept.
+template<typename F>
+Base<F> GNRTrials
+( const Matrix<F>& B,
+  const Matrix<Base<F>>& upperBounds,
+        Base<F> normUpperBound,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = B.Height();
+    const Int n = B.Width();
+    Timer timer;
+
+    Int batchSize = 1;
+#ifdef EL_HYBRID
+    if( ctrl.parallel && IsPacked<F>::value && !omp_in_parallel() )
+        batchSize = MaxThreads();
+#endif
+
+    vector<Matrix<F>> UList(batchSize), NList(batchSize), vList(batchSize);
+    vector<Matrix<Real>> dList(batchSize);
+    vector<Real> results(batchSize);
+    for( Int batchBeg=0; batchBeg<ctrl.numTrials; batchBeg+=batchSize )
+    {
+        const Int numBatch = Min(batchSize,ctrl.numTrials-batchBeg);
+        for( Int t=0; t<numBatch; ++t )
+            GNRTrialBasis
+            ( B, batchBeg+t != 0, UList[t], dList[t], NList[t], ctrl );
+
+        if( ctrl.progress )
+        {
+            if( numBatch == 1 )
+                Output("Starting trial ",batchBeg);
+            else
+                Output("Starting trials ",batchBeg,":",batchBeg+numBatch-1);
+        }
+        if( ctrl.time )
+            timer.Start();
+        if( numBatch == 1 )
+        {
+            results[0] = GNREnumeration
+              ( dList[0], NList[0], upperBounds, vList[0], ctrl );
+        }
+        else
+        {
+#ifdef EL_HYBRID
+            _Pragma("omp parallel for schedule(dynamic,1)")
+#endif
+            for( Int t=0; t<numBatch; ++t )
+                results[t] = GNREnumeration
+                  ( dList[t], NList[t], upperBounds, vList[t], ctrl );
+        }
+        if( ctrl.time )
+            Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
+
+        for( Int t=0; t<numBatch; ++t )
+        {
+            const Real result = results[t];
+            if( result >= normUpperBound )
+                continue;
+
+            const Int trial = batchBeg + t;
+            if( ctrl.progress )
+                Output("Found lattice member with norm ",result);
+            if( trial > 0 )
+            {
+                if( ctrl.progress )
+                {
+                    Print( vList[t], "vInner" );
+                    Matrix<F> y;
+                    CoordinatesToSparse( NList[t], vList[t], y );
+                    Print( y, "y" );
+                }
+                Zeros( v, n, 1 );
+                Gemv( NORMAL, F(1), UList[t], vList[t], F(0), v );
+            }
+            else
+                v = vList[t];
+            if( ctrl.progress )
+            {
+                Matrix<F> b;
+                Zeros( b, m, 1 );
+                Gemv( NORMAL, F(1), B, v, F(0), b );
+                Print( v, "v" );
+                Print( b, "b" );
+            }
+            return result;
+        }
+    }
+    Zeros( v, n, 1 );
+    return 2*normUpperBound+1; // return a value above the upper bound
+}
+
 } // namespace svp
 
 // NOTE: This norm upper bound is *non-inclusive*
@@ -296,95 +464,7 @@ Base<F> ShortVectorEnumeration
         auto upperBounds =
           svp::PrunedUpperBounds( n, normUpperBound, ctrl.linearBounding );
 
-        // Since we will manually build up a (weakly) pseudorandom
-        // unimodular matrix so that the probabalistic enumerations traverse
-        // different paths, we must keep track of the unimodular matrix so that
-        //  'v' can be returned relative to the original lattice basis
-        auto RNew( R );
-        Matrix<F> BNew, U;
-
-        for( Int trial=0; trial<ctrl.numTrials; ++trial )
-        {
-            BNew = B;
-            Identity( U, n, n );
-            if( trial != 0 )
-            {
-                // Apply a small random unimodular transformation to B
-                const Int numCombines = n;
-                for( Int j=0; j<numCombines; ++j )
-                {
-                    const Int c = SampleUniform( Int(0), n );
-                    const Int scale = SampleUniform( Int(-5), Int(5) );
-                    if( c == j || scale == 0 )
-                        continue; // if scale=-1, we could have singularity
-                    if( ctrl.progress )
-                        Output("  B(:,",j,") += ",scale,"*B(:,",c,")");
-
-                    auto bj = BNew( ALL, j );
-                    auto bc = BNew( ALL, c );
-                    Axpy( scale, bc, bj );
-
-                    auto uj = U(ALL,j);
-                    auto uc = U(ALL,c);
-                    Axpy( scale, uc, uj );
-                }
-
-                // The BKZ does not need to be particularly powerful
-                BKZCtrl<Real> ctrl;
-                ctrl.jumpstart = true; // accumulate into U
-                ctrl.blocksize = 10;
-                ctrl.recursive = false;
-                ctrl.lllCtrl.recursive = false;
-                if( ctrl.time )
-                    timer.Start();
-                BKZ( BNew, U, RNew, ctrl );
-                if( ctrl.time )
-                    Output("  Fix-up BKZ: ",timer.Stop()," seconds");
-            }
-            RNew = BNew;
-            qr::ExplicitTriang( RNew ); 
-
-            auto dNew = GetRealPartOfDiagonal( RNew );
-            auto NNew( RNew );
-            auto NNewT = NNew( IR(0,minDim), ALL );
-            DiagonalSolve( LEFT, NORMAL, dNew, NNewT );
-
-            if( ctrl.progress )
-                Output("Starting trial ",trial);
-            if( ctrl.time )
-                timer.Start();
-            Real result =
-              svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
-            if( ctrl.time )
-                Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
-            if( result < normUpperBound )
-            {
-                if( ctrl.progress )
-                    Output("Found lattice member with norm ",result);
-                if( trial > 0 )
-                {
-                    if( ctrl.progress )
-                    {
-                        Print( v, "vInner" );
-                        Matrix<F> y;
-                        svp::CoordinatesToSparse( NNew, v, y );
-                        Print( y, "y" );
-                    }
-                    auto vCopy( v );
-                    Gemv( NORMAL, F(1), U, vCopy, F(0), v );
-                }
-                if( ctrl.progress )
-                {
-                    Matrix<F> b;
-                    Zeros( b, m, 1 );
-                    Gemv( NORMAL, F(1), B, v, F(0), b );
-                    Print( v, "v" );
-                    Print( b, "b" );
-                }
-                return result;
-            }
-        }
-        return 2*normUpperBound+1; // return a value above the upper bound
+        return svp::GNRTrials( B, upperBounds, normUpperBound, v, ctrl );
     }
     else if( ctrl.enumType == YSPARSE_ENUM )
     {
@@ -512,94 +592,10 @@ MultiShortVectorEnumeration
         auto upperBounds =
           svp::PrunedUpperBounds( n, normUpperBound, ctrl.linearBounding );
 
-        // Since we will manually build up a (weakly) pseudorandom
-        // unimodular matrix so that the probabalistic enumerations traverse
-        // different paths, we must keep track of the unimodular matrix so that
-        //  'v' can be returned relative to the original lattice basis
-        auto RNew( R );
-        Matrix<F> BNew, U;
-
-        for( Int trial=0; trial<ctrl.numTrials; ++trial )
-        {
-            BNew = B;
-            Identity( U, n, n );
-            if( trial != 0 )
-            {
-                // Apply a small random unimodular transformation to B
-                const Int numCombines = n;
-                for( Int j=0; j<numCombines; ++j )
-                {
-                    const Int c = SampleUniform( Int(0), n );
-                    const Int scale = SampleUniform( Int(-5), Int(5) );
-                    if( c == j || scale == 0 )
-                        continue; // if scale=-1, we could have singularity
-                    if( ctrl.progress )
-                        Output("  B(:,",j,") += ",scale,"*B(:,",c,")");
-
-                    auto bj = BNew( ALL, j );
-                    auto bc = BNew( ALL, c );
-                    Axpy( scale, bc, bj );
-
-                    auto uj = U(ALL,j);
-                    auto uc = U(ALL,c);
-                    Axpy( scale, uc, uj );
-                }
-
-                // The BKZ does not need to be particularly powerful
-                BKZCtrl<Real> ctrl;
-                ctrl.jumpstart = true; // accumulate into U
-                ctrl.blocksize = 10;
-                ctrl.recursive = false;
-                ctrl.lllCtrl.recursive = false;
-                if( ctrl.time )
-                    timer.Start();
-                BKZ( BNew, U, RNew, ctrl );
-                if( ctrl.time )
-                    Output("  Fix-up BKZ: ",timer.Stop()," seconds");
-            }
-            RNew = BNew;
-            qr::ExplicitTriang( RNew ); 
-
-            auto dNew = GetRealPartOfDiagonal( RNew );
-            auto NNew( RNew );
-            auto NNewT = NNew( IR(0,minDim), ALL );
-            DiagonalSolve( LEFT, NORMAL, dNew, NNewT );
-
-            if( ctrl.progress )
-                Output("Starting trial ",trial);
-            if( ctrl.time )
-                timer.Start();
-            Real result =
-              svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
-            if( ctrl.time )
-                Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
-            if( result < normUpperBound )
-            {
-                if( ctrl.progress )
-                    Output("Found lattice member with norm ",result);
-                if( trial > 0 )
-                {
-                    if( ctrl.progress )
-                    {
-                        Print( v, "vInner" );
-                        Matrix<F> y;
-                        svp::CoordinatesToSparse( NNew, v, y );
-                        Print( y, "y" );
-                    }
-                    auto vCopy( v );
-                    Gemv( NORMAL, F(1), U, vCopy, F(0), v );
-                }
-                if( ctrl.progress )
-                {
-                    Matrix<F> b;
-                    Zeros( b, m, 1 );
-                    Gemv( NORMAL, F(1), B, v, F(0), b );
-                    Print( v, "v" );
-                    Print( b, "b" );
-                }
-                return pair<Real,Int>(result,0);
-            }
-        }
+        const Real result =
+          svp::GNRTrials( B, upperBounds, normUpperBound, v, ctrl );
+        if( result < normUpperBound )
+            return pair<Real,Int>(result,0);
         for( Int j=0; j<numNested; ++j )
         {
             if( modNormUpperBounds(j) < normUpperBounds(j) )
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <atomic>
 
 namespace El {
 
@@ -230,6 +231,270 @@ Base<F> TransposedHelper
     }
 }
 
+
+// A subtree of the enumeration tree rooted at level 'splitLevel', i.e., an
+// assignment of the coordinates v(splitLevel:n-1) whose projection lies
+// beneath the corresponding upper bounds. The subtrees are generated in the
+// order in which the sequential traversal would visit them.
+template<typename F>
+struct Subtree
+{
+    vector<F> coords;
+    Base<F> partialNorm;
+    bool zero; // whether v(splitLevel:n-1) = 0
+};
+
+template<typename F>
+vector<Subtree<F>> SplitTree
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Int splitLevel )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+
+    vector<F> v(n,F(0)), centers(n,F(0));
+    vector<Real> partialNorms(n+1,Real(0));
+    vector<SpiralState<F>> spiralStates(n);
+    Int lastNonzero = splitLevel-1;
+
+    vector<Subtree<F>> subtrees;
+    Int k=splitLevel;
+    while( true )
+    {
+        const F entry = d(k)*(v[k] - centers[k]);
+        const Real partialNorm = SafeNorm( partialNorms[k+1], entry );
+        partialNorms[k] = partialNorm;
+        if( partialNorm < upperBounds((n-1)-k) )
+        {
+            if( k == splitLevel )
+            {
+                Subtree<F> subtree;
+                subtree.coords.assign( v.begin()+splitLevel, v.end() );
+                subtree.partialNorm = partialNorm;
+                subtree.zero = ( lastNonzero < splitLevel );
+                subtrees.push_back( subtree );
+            }
+            else
+            {
+                // Move down the tree (the top levels are cheap enough that
+                // the partial sums need not be cached)
+                --k;
+                F center = F(0);
+                for( Int i=k+1; i<n; ++i )
+                    center -= NTrans(i,k)*v[i];
+                centers[k] = center;
+                v[k] = Round(center);
+                spiralStates[k].Initialize( center );
+                continue;
+            }
+        }
+        else
+        {
+            // Move up the tree
+            ++k;
+            if( k == n )
+                break;
+        }
+
+        if( k > lastNonzero )
+        {
+            // Seed a constrained spiral out from zero
+            spiralStates[k].Initialize( true );
+            v[k] = spiralStates[k].Step();
+            lastNonzero = k;
+        }
+        else
+        {
+            v[k] = spiralStates[k].Step();
+        }
+    }
+    return subtrees;
+}
+
+// Traverse the levels beneath a subtree's root, abandoning the search as soon
+// as a subtree which precedes it in the sequential order has succeeded
+template<typename F>
+Base<F> SubtreeHelper
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Int splitLevel,
+  const Subtree<F>& subtree,
+        Int subtreeIndex,
+  const std::atomic<Int>& firstSuccess,
+        Matrix<F>& v )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+    const Real failure = 2*upperBounds(n-1)+1;
+    // How many nodes to visit between checks of the shared state
+    const Int checkInterval = 1024;
+
+    Matrix<F> partialSums;
+    Zeros( partialSums, n+1, splitLevel );
+
+    Matrix<Int> sumIndices;
+    Zeros( sumIndices, splitLevel+1, 1 );
+
+    Matrix<Real> partialNorms;
+    Zeros( partialNorms, splitLevel+1, 1 );
+
+    Matrix<F> centers;
+    Zeros( centers, splitLevel, 1 );
+
+    vector<SpiralState<F>> spiralStates(splitLevel);
+
+    Zeros( v, n, 1 );
+    F* vBuf = &v(0);
+    for( Int i=splitLevel; i<n; ++i )
+        vBuf[i] = subtree.coords[i-splitLevel];
+
+    Int k, lastNonzero;
+    if( subtree.zero )
+    {
+        // Mirror the beginning of the sequential traversal
+        for( Int j=0; j<=splitLevel; ++j )
+            sumIndices(j) = j-1;
+        vBuf[0] = F(1);
+        lastNonzero = 0;
+        k = 0;
+    }
+    else
+    {
+        // None of the partial sums are synchronized with the subtree's root
+        for( Int j=0; j<=splitLevel; ++j )
+            sumIndices(j) = n-1;
+        partialNorms(splitLevel) = subtree.partialNorm;
+        lastNonzero = n-1;
+        k = splitLevel-1;
+
+        F* s = &partialSums(0,k);
+        const F* nBuf = &NTrans(0,k);
+        for( Int i=n-1; i>=k+1; --i )
+            s[i] = s[i+1] + nBuf[i]*vBuf[i];
+        centers(k) = -partialSums(k+1,k);
+        vBuf[k] = Round(centers(k));
+        spiralStates[k].Initialize( centers(k) );
+    }
+
+    Int numVisited = 0;
+    while( true )
+    {
+        if( ++numVisited == checkInterval )
+        {
+            numVisited = 0;
+            if( firstSuccess.load() < subtreeIndex )
+                return failure;
+        }
+
+        const F entry = d(k)*(vBuf[k] - centers(k));
+        const Real partialNorm = SafeNorm( partialNorms(k+1), entry );
+        partialNorms(k) = partialNorm;
+        if( partialNorm < upperBounds((n-1)-k) )
+        {
+            if( k == 0 )
+            {
+                // Success
+                return partialNorm;
+            }
+            else
+            {
+                // Move down the tree
+                --k;
+                sumIndices(k) = Max(sumIndices(k),sumIndices(k+1));
+
+                      F* s = &partialSums(0,k);
+                const F* nBuf = &NTrans(0,k);
+                for( Int i=sumIndices(k+1); i>=k+1; --i )
+                    s[i] = s[i+1] + nBuf[i]*vBuf[i];
+
+                centers(k) = -partialSums(k+1,k);
+                vBuf[k] = Round(centers(k));
+                spiralStates[k].Initialize( centers(k) );
+            }
+        }
+        else
+        {
+            // Move up the tree
+            ++k;
+            if( k == splitLevel )
+                return failure;
+            sumIndices(k) = k; // indicate that (i,j) are not synchronized
+            if( k > lastNonzero )
+            {
+                // Seed a constrained spiral out from zero
+                spiralStates[k].Initialize( true );
+                vBuf[k] = spiralStates[k].Step();
+                lastNonzero = k;
+            }
+            else
+            {
+                vBuf[k] = spiralStates[k].Step();
+            }
+        }
+    }
+}
+
+// Split the tree 'ctrl.splitDepth' levels beneath its root and traverse the
+// resulting subtrees with a dynamically-scheduled team of threads. The
+// index of the earliest successful subtree is shared between the threads so
+// that every later subtree can be abandoned, which yields the same vector as
+// the sequential traversal.
+template<typename F>
+Base<F> ParallelHelper
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+    const Int splitLevel = n - ctrl.splitDepth;
+
+    auto subtrees = SplitTree( d, NTrans, upperBounds, splitLevel );
+    const Int numSubtrees = subtrees.size();
+    if( ctrl.innerProgress )
+        Output("Split into ",numSubtrees," subtrees at level ",splitLevel);
+
+    std::atomic<Int> firstSuccess( numSubtrees );
+    vector<Real> results( numSubtrees, 2*upperBounds(n-1)+1 );
+    vector<Matrix<F>> candidates( numSubtrees );
+#ifdef EL_HYBRID
+    _Pragma("omp parallel for schedule(dynamic,1)")
+#endif
+    for( Int t=0; t<numSubtrees; ++t )
+    {
+        if( firstSuccess.load() < t )
+            continue;
+        results[t] =
+          SubtreeHelper
+          ( d, NTrans, upperBounds, splitLevel, subtrees[t], t, firstSuccess,
+            candidates[t] );
+        if( results[t] < upperBounds(n-1) )
+        {
+            Int first = firstSuccess.load();
+            while( t < first && !firstSuccess.compare_exchange_weak(first,t) );
+        }
+        else
+            candidates[t].Empty();
+    }
+
+    const Int t = firstSuccess.load();
+    if( t == numSubtrees )
+    {
+        Zeros( v, n, 1 );
+        return 2*upperBounds(n-1)+1;
+    }
+    v = candidates[t];
+    return results[t];
+}
+
 } // namespace gnr_enum
 
 template<typename F>
@@ -241,6 +506,18 @@ Base<F> GNREnumeration
   const EnumCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
+#ifdef EL_HYBRID
+    // Only split the tree when the scalar type can be safely manipulated by
+    // several threads and we are not already within a team
+    const Int n = N.Width();
+    if( ctrl.parallel && IsPacked<F>::value && MaxThreads() > 1 &&
+        !omp_in_parallel() && ctrl.splitDepth >= 1 && n > ctrl.splitDepth )
+    {
+        Matrix<F> NTrans;
+        Transpose( N, NTrans );
+        return gnr_enum::ParallelHelper( d, NTrans, upperBounds, v, ctrl );
+    }
+#endif
     if( ctrl.explicitTranspose )
     {
         Matrix<F> NTrans;
@@ -163,6 +163,8 @@ ElError ElRPCACtrlDefault_s( ElRPCACtrl_s* ctrl )
     ctrl->beta = 1;
     ctrl->rho = 6;
     ctrl->tol = 1e-5;
+    ctrl->useRandomized = false;
+    ElRandomizedSVDCtrlDefault( &ctrl->randomizedCtrl );
     return EL_SUCCESS;
 }
 
@@ -177,6 +179,8 @@ ElError ElRPCACtrlDefault_d( ElRPCACtrl_d* ctrl )
     ctrl->beta = 1;
     ctrl->rho = 6;
     ctrl->tol = 1e-5;
+    ctrl->useRandomized = false;
+    ElRandomizedSVDCtrlDefault( &ctrl->randomizedCtrl );
     return EL_SUCCESS;
 }
 
@@ -58,7 +58,7 @@ void ADMM
     const Base<F> tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    Matrix<F> E, Y;
+    Matrix<F> E, Y, V;
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -87,7 +87,9 @@ void ADMM
         L -= S;
         Axpy( F(1)/beta, Y, L );
         Int rank;
-        if( ctrl.usePivQR )
+        if( ctrl.useRandomized )
+            rank = svt::Randomized( L, Real(1)/beta, V, ctrl.randomizedCtrl );
+        else if( ctrl.usePivQR )
             rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
         else
             rank = SVT( L, Real(1)/beta );
@@ -164,7 +166,7 @@ void ADMM
     const Base<F> tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    DistMatrix<F> E( M.Grid() ), Y( M.Grid() );
+    DistMatrix<F> E( M.Grid() ), Y( M.Grid() ), V( M.Grid() );
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -193,7 +195,9 @@ void ADMM
         L -= S;
         Axpy( F(1)/beta, Y, L );
         Int rank;
-        if( ctrl.usePivQR )
+        if( ctrl.useRandomized )
+            rank = svt::Randomized( L, Real(1)/beta, V, ctrl.randomizedCtrl );
+        else if( ctrl.usePivQR )
             rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
         else
             rank = SVT( L, Real(1)/beta );
@@ -283,7 +287,7 @@ void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
-    Matrix<F> LLast, SLast, E;
+    Matrix<F> LLast, SLast, E, V;
     while( true )
     {
         ++numIts;
@@ -307,7 +311,10 @@ void ALM
             L = M;
             L -= S;
             Axpy( F(1)/beta, Y, L );
-            if( ctrl.usePivQR )
+            if( ctrl.useRandomized )
+                rank =
+                  svt::Randomized( L, Real(1)/beta, V, ctrl.randomizedCtrl );
+            else if( ctrl.usePivQR )
                 rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
             else
                 rank = SVT( L, Real(1)/beta );
@@ -434,7 +441,8 @@ void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
-    DistMatrix<F> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() );
+    DistMatrix<F> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() ),
+                  V( M.Grid() );
     while( true )
     {
         ++numIts;
@@ -458,7 +466,10 @@ void ALM
             L = M;
             L -= S;
             Axpy( F(1)/beta, Y, L );
-            if( ctrl.usePivQR )
+            if( ctrl.useRandomized )
+                rank =
+                  svt::Randomized( L, Real(1)/beta, V, ctrl.randomizedCtrl );
+            else if( ctrl.usePivQR )
                 rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
             else
                 rank = SVT( L, Real(1)/beta );
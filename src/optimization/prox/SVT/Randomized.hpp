@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVT_RANDOMIZED_HPP
+#define EL_SVT_RANDOMIZED_HPP
+
+namespace El {
+namespace svt {
+
+// Approximate the singular values above the threshold with a randomized SVD,
+// doubling the target rank until the smallest approximated singular value
+// falls below the threshold. If V is nonempty on entry, it seeds the sketch
+// and its width is the initial target rank; on exit, it holds the right
+// singular vectors which survived (plus one, so that growth in the rank of
+// the next, nearby matrix can be detected).
+
+template<typename F>
+Int Randomized
+( Matrix<F>& A, Base<F> tau, Matrix<F>& V,
+  const RandomizedSVDCtrl& ctrl, bool relative )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+        return 0;
+
+    RandomizedSVDCtrl svdCtrl( ctrl );
+    svdCtrl.seedWithV = ( V.Height() == n && V.Width() > 0 );
+    svdCtrl.rank = ( svdCtrl.seedWithV ? V.Width() : ctrl.rank );
+    svdCtrl.rank = Max(Min(svdCtrl.rank,minDim),Int(1));
+
+    Matrix<F> U;
+    Matrix<Real> s;
+    while( true )
+    {
+        RandomizedSVD( A, U, s, V, svdCtrl );
+        const Real thresh = ( relative ? tau*s.Get(0,0) : tau );
+        if( svdCtrl.rank == minDim || s.Get(svdCtrl.rank-1,0) <= thresh )
+            break;
+        svdCtrl.rank = Min(2*svdCtrl.rank,minDim);
+        svdCtrl.seedWithV = true;
+    }
+
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, F(1), U, V, F(0), A );
+
+    Matrix<F> VKeep;
+    VKeep = V( ALL, IR(0,Min(rank+1,svdCtrl.rank)) );
+    V = VKeep;
+    return rank;
+}
+
+template<typename F>
+Int Randomized
+( ElementalMatrix<F>& APre, Base<F> tau, ElementalMatrix<F>& VPre,
+  const RandomizedSVDCtrl& ctrl, bool relative )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre ), VProx( VPre );
+    auto& A = AProx.Get();
+    auto& V = VProx.Get();
+    const Grid& g = A.Grid();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+        return 0;
+
+    RandomizedSVDCtrl svdCtrl( ctrl );
+    svdCtrl.seedWithV = ( V.Height() == n && V.Width() > 0 );
+    svdCtrl.rank = ( svdCtrl.seedWithV ? V.Width() : ctrl.rank );
+    svdCtrl.rank = Max(Min(svdCtrl.rank,minDim),Int(1));
+
+    DistMatrix<F> U(g);
+    DistMatrix<Real,STAR,STAR> s(g);
+    while( true )
+    {
+        RandomizedSVD( A, U, s, V, svdCtrl );
+        const Real thresh = ( relative ? tau*s.GetLocal(0,0) : tau );
+        if( svdCtrl.rank == minDim ||
+            s.GetLocal(svdCtrl.rank-1,0) <= thresh )
+            break;
+        svdCtrl.rank = Min(2*svdCtrl.rank,minDim);
+        svdCtrl.seedWithV = true;
+    }
+
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, F(1), U, V, F(0), A );
+
+    DistMatrix<F> VKeep(g);
+    VKeep = V( ALL, IR(0,Min(rank+1,svdCtrl.rank)) );
+    V = VKeep;
+    return rank;
+}
+
+} // namespace svt
+} // namespace El
+
+#endif // ifndef EL_SVT_RANDOMIZED_HPP
@@ -24,9 +24,15 @@ ElError ElMehrotraCtrlDefault_s( ElMehrotraCtrl_s* ctrl )
     ctrl->maxStepRatio = 0.99;
     ctrl->system = EL_FULL_KKT;
     ctrl->mehrotra = true;
+    ctrl->maxGondzioCorrectors = 0;
+    ctrl->gondzioStepIncrease = 0.1;
+    ctrl->gondzioMinImprovement = 0.1;
+    ctrl->gondzioLowerRatio = 0.1;
+    ctrl->gondzioUpperRatio = 10;
     ctrl->forceSameStep = true;
     ElRegSolveCtrlDefault_s( &ctrl->solveCtrl );
     ctrl->resolveReg = true;
+    ctrl->mixedPrecision = false;
     ctrl->outerEquil = true;
     ctrl->basisSize = 6;
     ctrl->print = false;
@@ -60,9 +66,15 @@ ElError ElMehrotraCtrlDefault_d( ElMehrotraCtrl_d* ctrl )
     ctrl->maxStepRatio = 0.99;
     ctrl->system = EL_FULL_KKT;
     ctrl->mehrotra = true;
+    ctrl->maxGondzioCorrectors = 0;
+    ctrl->gondzioStepIncrease = 0.1;
+    ctrl->gondzioMinImprovement = 0.1;
+    ctrl->gondzioLowerRatio = 0.1;
+    ctrl->gondzioUpperRatio = 10;
     ctrl->forceSameStep = true;
     ElRegSolveCtrlDefault_d( &ctrl->solveCtrl );
     ctrl->resolveReg = true;
+    ctrl->mixedPrecision = false;
     ctrl->outerEquil = true;
     ctrl->basisSize = 6;
     ctrl->print = false;
@@ -112,6 +124,28 @@ ElError ElADMMCtrlDefault_d( ElADMMCtrl_d* ctrl )
     return EL_SUCCESS;
 }
 
+/* Presolve
+   ======== */
+ElError ElPresolveCtrlDefault_s( ElPresolveCtrl_s* ctrl )
+{
+    ctrl->enable = false;
+    ctrl->maxPasses = 10;
+    ctrl->maxGatherEntries = 10000000;
+    ctrl->tol = Pow(limits::Epsilon<float>(),float(0.75));
+    ctrl->print = false;
+    return EL_SUCCESS;
+}
+
+ElError ElPresolveCtrlDefault_d( ElPresolveCtrl_d* ctrl )
+{
+    ctrl->enable = false;
+    ctrl->maxPasses = 10;
+    ctrl->maxGatherEntries = 10000000;
+    ctrl->tol = Pow(limits::Epsilon<double>(),double(0.75));
+    ctrl->print = false;
+    return EL_SUCCESS;
+}
+
 /* Linear programs
    =============== */
 
@@ -122,6 +156,7 @@ ElError ElLPDirectCtrlDefault_s( ElLPDirectCtrl_s* ctrl, bool isSparse )
     ctrl->approach = EL_LP_MEHROTRA;
     ElADMMCtrlDefault_s( &ctrl->admmCtrl );
     ElMehrotraCtrlDefault_s( &ctrl->mehrotraCtrl );
+    ElPresolveCtrlDefault_s( &ctrl->presolveCtrl );
     if( isSparse )
         ctrl->mehrotraCtrl.system = EL_AUGMENTED_KKT;
     else
@@ -134,6 +169,7 @@ ElError ElLPDirectCtrlDefault_d( ElLPDirectCtrl_d* ctrl, bool isSparse )
     ctrl->approach = EL_LP_MEHROTRA;
     ElADMMCtrlDefault_d( &ctrl->admmCtrl );
     ElMehrotraCtrlDefault_d( &ctrl->mehrotraCtrl );
+    ElPresolveCtrlDefault_d( &ctrl->presolveCtrl );
     if( isSparse )
         ctrl->mehrotraCtrl.system = EL_AUGMENTED_KKT;
     else
@@ -166,6 +202,7 @@ ElError ElQPDirectCtrlDefault_s( ElQPDirectCtrl_s* ctrl )
 {
     ctrl->approach = EL_QP_MEHROTRA;
     ElMehrotraCtrlDefault_s( &ctrl->mehrotraCtrl );
+    ElPresolveCtrlDefault_s( &ctrl->presolveCtrl );
     ctrl->mehrotraCtrl.system = EL_AUGMENTED_KKT;
     return EL_SUCCESS;
 }
@@ -174,6 +211,7 @@ ElError ElQPDirectCtrlDefault_d( ElQPDirectCtrl_d* ctrl )
 {
     ctrl->approach = EL_QP_MEHROTRA;
     ElMehrotraCtrlDefault_d( &ctrl->mehrotraCtrl );
+    ElPresolveCtrlDefault_d( &ctrl->presolveCtrl );
     ctrl->mehrotraCtrl.system = EL_AUGMENTED_KKT;
     return EL_SUCCESS;
 }
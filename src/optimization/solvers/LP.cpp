@@ -9,6 +9,7 @@
 #include <El.hpp>
 #include "./LP/direct/IPM.hpp"
 #include "./LP/affine/IPM.hpp"
+#include "./Presolve.hpp"
 
 namespace El {
 
@@ -101,10 +102,25 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
-    if( ctrl.approach == LP_MEHROTRA )
-        lp::direct::Mehrotra( A, b, c, x, y, z, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != LP_MEHROTRA )
         LogicError("Unsupported solver");
+
+    if( ctrl.presolveCtrl.enable )
+    {
+        SparseMatrix<Real> Q;
+        Zeros( Q, A.Width(), A.Width() );
+        auto solve =
+          [&]( const SparseMatrix<Real>&, const SparseMatrix<Real>& ARed,
+               const Matrix<Real>& bRed, const Matrix<Real>& cRed,
+               Matrix<Real>& xRed, Matrix<Real>& yRed, Matrix<Real>& zRed )
+          { lp::direct::Mehrotra
+            ( ARed, bRed, cRed, xRed, yRed, zRed, ctrl.mehrotraCtrl ); };
+        presolve::Solve
+        ( Q, A, b, c, x, y, z, ctrl.presolveCtrl,
+          ctrl.mehrotraCtrl.primalInit, ctrl.mehrotraCtrl.dualInit, solve );
+    }
+    else
+        lp::direct::Mehrotra( A, b, c, x, y, z, ctrl.mehrotraCtrl );
 }
 
 template<typename Real>
@@ -138,10 +154,29 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
-    if( ctrl.approach == LP_MEHROTRA )
-        lp::direct::Mehrotra( A, b, c, x, y, z, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != LP_MEHROTRA )
         LogicError("Unsupported solver");
+
+    if( ctrl.presolveCtrl.enable )
+    {
+        DistSparseMatrix<Real> Q(A.Comm());
+        Zeros( Q, A.Width(), A.Width() );
+        auto solve =
+          [&]( const DistSparseMatrix<Real>&,
+               const DistSparseMatrix<Real>& ARed,
+               const DistMultiVec<Real>& bRed,
+               const DistMultiVec<Real>& cRed,
+               DistMultiVec<Real>& xRed,
+               DistMultiVec<Real>& yRed,
+               DistMultiVec<Real>& zRed )
+          { lp::direct::Mehrotra
+            ( ARed, bRed, cRed, xRed, yRed, zRed, ctrl.mehrotraCtrl ); };
+        presolve::Solve
+        ( Q, A, b, c, x, y, z, ctrl.presolveCtrl,
+          ctrl.mehrotraCtrl.primalInit, ctrl.mehrotraCtrl.dualInit, solve );
+    }
+    else
+        lp::direct::Mehrotra( A, b, c, x, y, z, ctrl.mehrotraCtrl );
 }
 
 template<typename Real>
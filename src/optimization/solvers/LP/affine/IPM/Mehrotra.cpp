@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../util/Gondzio.hpp"
 
 namespace El {
 namespace lp {
@@ -49,12 +50,6 @@ void Mehrotra
     DEBUG_CSE
 
     // TODO: Move these into the control structure
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
 
     // Equilibrate the LP by diagonally scaling [A;G]
@@ -119,6 +114,7 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError;
+    GondzioTemps<Matrix<Real>> gondzioTemps;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -270,7 +266,8 @@ void Mehrotra
         const Real muAff = Dot(ds,dz) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
 
@@ -290,12 +287,17 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Construct the new KKT RHS
-        // -------------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the direction
-        // -----------------------
-        try { ldl::SolveAfter( J, dSub, p, d, false ); }
+        auto solveCombined = [&]()
+        {
+            // Construct the new KKT RHS
+            // -------------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            // Solve for the direction
+            // -----------------------
+            ldl::SolveAfter( J, dSub, p, d, false );
+            ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        };
+        try { solveCombined(); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -304,9 +306,14 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
         // TODO: Residual checks
 
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, s, z, sigma, mu, rmu, dx, dy, dz, ds, gondzioTemps,
+          solveCombined, ctrl.print );
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
@@ -357,12 +364,6 @@ void Mehrotra
     DEBUG_CSE
 
     // TODO: Move these into the control structure
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
 
     const Grid& grid = APre.Grid();
@@ -466,6 +467,7 @@ void Mehrotra
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid);
     dzError.AlignWith( s );
+    GondzioTemps<DistMatrix<Real>> gondzioTemps(grid);
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -616,7 +618,8 @@ void Mehrotra
         const Real muAff = Dot(ds,dz) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
             Output("sigma=",sigma);
 
@@ -636,12 +639,17 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Construct the new KKT RHS
-        // -------------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the direction
-        // -----------------------
-        try { ldl::SolveAfter( J, dSub, p, d, false ); }
+        auto solveCombined = [&]()
+        {
+            // Construct the new KKT RHS
+            // -------------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            // Solve for the direction
+            // -----------------------
+            ldl::SolveAfter( J, dSub, p, d, false );
+            ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        };
+        try { solveCombined(); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -650,9 +658,14 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
         // TODO: Residual checks
 
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, s, z, sigma, mu, rmu, dx, dy, dz, ds, gondzioTemps,
+          solveCombined, ctrl.print && commRank == 0 );
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
@@ -703,12 +716,6 @@ void Mehrotra
     DEBUG_CSE
 
     // TODO: Move these into the control structure
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
 
     // Equilibrate the LP by diagonally scaling [A;G]
@@ -799,6 +806,7 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError;
+    GondzioTemps<Matrix<Real>> gondzioTemps;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -983,7 +991,8 @@ void Mehrotra
         const Real muAff = Dot(ds,dz) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
 
@@ -1003,13 +1012,13 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Construct the new KKT RHS
-        // -------------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the proposed step
-        // ---------------------------
-        try
+        auto solveCombined = [&]()
         {
+            // Construct the new KKT RHS
+            // -------------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            // Solve for the proposed step
+            // ---------------------------
             if( ctrl.resolveReg )
                 reg_ldl::SolveAfter
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d,
@@ -1019,7 +1028,9 @@ void Mehrotra
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress );
-        }
+            ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        };
+        try { solveCombined(); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -1028,7 +1039,12 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, s, z, sigma, mu, rmu, dx, dy, dz, ds, gondzioTemps,
+          solveCombined, ctrl.print );
 
         // Update the current estimates
         // ============================
@@ -1080,12 +1096,6 @@ void Mehrotra
     DEBUG_CSE
 
     // TODO: Move these into the control structure
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
 
     mpi::Comm comm = APre.Comm();
@@ -1217,6 +1227,7 @@ void Mehrotra
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+    GondzioTemps<DistMultiVec<Real>> gondzioTemps(comm);
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1419,7 +1430,8 @@ void Mehrotra
         const Real muAff = Dot(ds,dz) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
             Output("sigma=",sigma);
 
@@ -1439,13 +1451,13 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Construct the new KKT RHS
-        // -------------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the direction
-        // -----------------------
-        try
+        auto solveCombined = [&]()
         {
+            // Construct the new KKT RHS
+            // -------------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            // Solve for the direction
+            // -----------------------
             if( commRank == 0 && ctrl.time )
                 timer.Start();
             if( ctrl.resolveReg )
@@ -1459,7 +1471,9 @@ void Mehrotra
                   ctrl.solveCtrl.progress );
             if( commRank == 0 && ctrl.time )
                 Output("Corrector: ",timer.Stop()," secs");
-        }
+            ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        };
+        try { solveCombined(); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -1468,7 +1482,12 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, s, z, sigma, mu, rmu, dx, dy, dz, ds, gondzioTemps,
+          solveCombined, ctrl.print && commRank == 0 );
 
         // Update the current estimates
         // ============================
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../util/Gondzio.hpp"
 
 namespace El {
 namespace lp {
@@ -46,12 +47,6 @@ void Mehrotra
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
     const Real balanceTol = Pow(eps,Real(-0.19));
 
@@ -132,6 +127,7 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, prod;
+    GondzioTemps<Matrix<Real>> gondzioTemps;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -332,7 +328,8 @@ void Mehrotra
         const Real muAff = Dot(dx,dz) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
 
@@ -351,65 +348,59 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
+        auto solveCombined = [&]()
         {
-            // Construct the new KKT RHS
-            // -------------------------
-            KKTRHS( rc, rb, rmu, z, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
+            if( ctrl.system == FULL_KKT )
             {
-                if( relError <= ctrl.minTol ) 
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
+                // Construct the new KKT RHS
+                // -------------------------
+                KKTRHS( rc, rb, rmu, z, d );
 
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol ) 
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance ",ctrl.minTol);
+                // Solve for the direction
+                // -----------------------
+                ldl::SolveAfter( J, dSub, p, d, false );
+                ExpandSolution( m, n, d, dx, dy, dz );
             }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else if( ctrl.system == NORMAL_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
+            else if( ctrl.system == AUGMENTED_KKT )
+            {
+                // Construct the new KKT RHS
+                // -------------------------
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
 
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, dy, false ); }
-            catch(...)
+                // Solve for the direction
+                // -----------------------
+                ldl::SolveAfter( J, dSub, p, d, false );
+                ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+            }
+            else if( ctrl.system == NORMAL_KKT )
             {
-                if( relError <= ctrl.minTol ) 
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance ",ctrl.minTol);
+                // Construct the new KKT RHS
+                // -------------------------
+                NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
+
+                // Solve for the direction
+                // -----------------------
+                ldl::SolveAfter( J, dSub, p, dy, false );
+                ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
             }
-            ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
+        };
+        try { solveCombined(); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol ) 
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance ",ctrl.minTol);
         }
         // TODO: Residual checks
 
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, x, z, sigma, mu, rmu, dx, dy, dz, dx, gondzioTemps,
+          solveCombined, ctrl.print );
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -480,12 +471,6 @@ void Mehrotra
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
     const Real balanceTol = Pow(eps,Real(-0.19));
     // TODO: Implement nonzero regularization
@@ -601,6 +586,7 @@ void Mehrotra
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     dzError.AlignWith( dz );
+    GondzioTemps<DistMatrix<Real>> gondzioTemps(grid);
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -803,7 +789,8 @@ void Mehrotra
         const Real muAff = Dot(dx,dz) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
             Output("sigma=",sigma);
 
@@ -822,65 +809,59 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
+        auto solveCombined = [&]()
         {
-            // Construct the new KKT RHS
-            // -------------------------
-            KKTRHS( rc, rb, rmu, z, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
+            if( ctrl.system == FULL_KKT )
             {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError 
-                    ("Could not achieve minimum tolerance ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
+                // Construct the new KKT RHS
+                // -------------------------
+                KKTRHS( rc, rb, rmu, z, d );
 
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError 
-                    ("Could not achieve minimum tolerance ",ctrl.minTol);
+                // Solve for the direction
+                // -----------------------
+                ldl::SolveAfter( J, dSub, p, d, false );
+                ExpandSolution( m, n, d, dx, dy, dz );
             }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else if( ctrl.system == NORMAL_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
+            else if( ctrl.system == AUGMENTED_KKT )
+            {
+                // Construct the new KKT RHS
+                // -------------------------
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
 
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, dy, false ); }
-            catch(...)
+                // Solve for the direction
+                // -----------------------
+                ldl::SolveAfter( J, dSub, p, d, false );
+                ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+            }
+            else if( ctrl.system == NORMAL_KKT )
             {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError 
-                    ("Could not achieve minimum tolerance ",ctrl.minTol);
+                // Construct the new KKT RHS
+                // -------------------------
+                NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
+
+                // Solve for the direction
+                // -----------------------
+                ldl::SolveAfter( J, dSub, p, dy, false );
+                ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
             }
-            ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
+        };
+        try { solveCombined(); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError 
+                ("Could not achieve minimum tolerance ",ctrl.minTol);
         }
         // TODO: Residual checks
 
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, x, z, sigma, mu, rmu, dx, dy, dz, dx, gondzioTemps,
+          solveCombined, ctrl.print && commRank == 0 );
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -952,12 +933,6 @@ void Mehrotra
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
     Real gammaPerm, deltaPerm, betaPerm, gammaTmp, deltaTmp, betaTmp;
     if( ctrl.system == NORMAL_KKT )
@@ -1086,8 +1061,19 @@ void Mehrotra
     }
     regTmp *= origTwoNormEst;
 
+    // Form the portion of the KKT system which does not depend upon x and z
+    SparseMatrix<Real> JStatic;
+    if( ctrl.system == FULL_KKT )
+        StaticKKT( A, gammaPerm, deltaPerm, betaPerm, JStatic, false );
+    else if( ctrl.system == AUGMENTED_KKT )
+        StaticAugmentedKKT( A, gammaPerm, deltaPerm, JStatic, false );
+
     SparseMatrix<Real> J, JOrig;
     ldl::Front<Real> JFront;
+    const bool mixedPrecision =
+      ctrl.mixedPrecision && !IsSame<Real,Demote<Real>>::value;
+    SparseMatrix<Demote<Real>> JLow;
+    ldl::Front<Demote<Real>> JFrontLow;
     Matrix<Real> d, 
                  w,
                  rc,    rb,    rmu, 
@@ -1098,6 +1084,7 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
+    GondzioTemps<Matrix<Real>> gondzioTemps;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1187,14 +1174,16 @@ void Mehrotra
         {
             // Construct the KKT system
             // ------------------------
+            JOrig = JStatic;
+            JOrig.FreezeSparsity();
             if( ctrl.system == FULL_KKT )
             {
-                KKT( A, gammaPerm, deltaPerm, betaPerm, x, z, JOrig, false );
+                FinishKKT( m, n, x, z, JOrig );
                 KKTRHS( rc, rb, rmu, z, d );
             }
             else
             {
-                AugmentedKKT( A, gammaPerm, deltaPerm, x, z, JOrig, false );
+                FinishAugmentedKKT( x, z, JOrig );
                 AugmentedKKTRHS( x, rc, rb, rmu, d );
             }
 
@@ -1226,10 +1215,22 @@ void Mehrotra
                     NestedDissection( J.LockedGraph(), map, rootSep, info );
                     InvertMap( map, invMap );
                 }
-                JFront.Pull( J, map, info );
-
-                LDL( info, JFront, LDL_2D );
-                if( ctrl.resolveReg )
+                if( mixedPrecision )
+                {
+                    Copy( J, JLow );
+                    JFrontLow.Pull( JLow, map, info );
+                    LDL( info, JFrontLow, LDL_2D );
+                }
+                else
+                {
+                    JFront.Pull( J, map, info );
+                    LDL( info, JFront, LDL_2D );
+                }
+                if( mixedPrecision )
+                    reg_ldl::MixedSolveAfter
+                    ( JOrig, regTmp, dInner, invMap, info, JFrontLow, d,
+                      ctrl.solveCtrl );
+                else if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
                       ctrl.solveCtrl );
@@ -1340,7 +1341,8 @@ void Mehrotra
         const Real muAff = Dot(dx,dz) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
 
@@ -1349,7 +1351,6 @@ void Mehrotra
         rc *= 1-sigma;
         rb *= 1-sigma;
         Shift( rmu, -sigma*mu );
-        // TODO: Gondzio's corrections 
         if( ctrl.mehrotra )
         {
             // r_mu += dxAff o dzAff
@@ -1360,12 +1361,16 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
+        auto solveCombined = [&]()
         {
-            KKTRHS( rc, rb, rmu, z, d );
-            try
+            if( ctrl.system == FULL_KKT )
             {
-                if( ctrl.resolveReg )
+                KKTRHS( rc, rb, rmu, z, d );
+                if( mixedPrecision )
+                    reg_ldl::MixedSolveAfter
+                    ( JOrig, regTmp, dInner, invMap, info, JFrontLow, d,
+                      ctrl.solveCtrl );
+                else if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
                       ctrl.solveCtrl );
@@ -1374,23 +1379,16 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                ExpandSolution( m, n, d, dx, dy, dz );
             }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-            try
+            else if( ctrl.system == AUGMENTED_KKT )
             {
-                if( ctrl.resolveReg )
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
+                if( mixedPrecision )
+                    reg_ldl::MixedSolveAfter
+                    ( JOrig, regTmp, dInner, invMap, info, JFrontLow, d,
+                      ctrl.solveCtrl );
+                else if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
                       ctrl.solveCtrl );
@@ -1399,39 +1397,35 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
             }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else
-        {
-            NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
-            try
+            else
             {
+                NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
                 // NOTE: regTmp should be all zeros; replace with unregularized
                 reg_ldl::RegularizedSolveAfter
                 ( J, regTmp, invMap, info, JFront, dy,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
+                ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
             }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
+        };
+        try { solveCombined(); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        // TODO: Residual checks 
+        // TODO: Residual checks
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, x, z, sigma, mu, rmu, dx, dy, dz, dx, gondzioTemps,
+          solveCombined, ctrl.print );
 
         // Update the current estimates
         // ============================
@@ -1506,12 +1500,6 @@ void Mehrotra
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
     Real gammaPerm, deltaPerm, betaPerm, gammaTmp, deltaTmp, betaTmp;
     if( ctrl.system == NORMAL_KKT )
@@ -1663,9 +1651,22 @@ void Mehrotra
     }
     regTmp *= origTwoNormEst;
 
-    DistGraphMultMeta metaOrig, meta;
+    // Form the portion of the KKT system which does not depend upon x and z
+    DistSparseMatrix<Real> JStatic(comm);
+    if( ctrl.system == FULL_KKT )
+        StaticKKT( A, gammaPerm, deltaPerm, betaPerm, JStatic, false );
+    else if( ctrl.system == AUGMENTED_KKT )
+        StaticAugmentedKKT( A, gammaPerm, deltaPerm, JStatic, false );
+    if( ctrl.system == FULL_KKT || ctrl.system == AUGMENTED_KKT )
+        JStatic.InitializeMultMeta();
+
+    DistGraphMultMeta meta;
     DistSparseMatrix<Real> J(comm), JOrig(comm);
     ldl::DistFront<Real> JFront;
+    const bool mixedPrecision =
+      ctrl.mixedPrecision && !IsSame<Real,Demote<Real>>::value;
+    DistSparseMatrix<Demote<Real>> JLow(comm);
+    ldl::DistFront<Demote<Real>> JFrontLow;
     DistMultiVec<Real> d(comm), 
                        w(comm),
                        rc(comm),    rb(comm),    rmu(comm), 
@@ -1677,6 +1678,7 @@ void Mehrotra
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm), prod(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+    GondzioTemps<DistMultiVec<Real>> gondzioTemps(comm);
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1763,14 +1765,18 @@ void Mehrotra
         {
             // Assemble the KKT system
             // -----------------------
+            JOrig = JStatic;
+            JOrig.FreezeSparsity();
+            JOrig.LockedDistGraph().multMeta =
+              JStatic.LockedDistGraph().multMeta;
             if( ctrl.system == FULL_KKT )
             {
-                KKT( A, gammaPerm, deltaPerm, betaPerm, x, z, JOrig, false );
+                FinishKKT( m, n, x, z, JOrig );
                 KKTRHS( rc, rb, rmu, z, d );
             }
             else
             {
-                AugmentedKKT( A, gammaPerm, deltaPerm, x, z, JOrig, false );
+                FinishAugmentedKKT( x, z, JOrig );
                 AugmentedKKTRHS( x, rc, rb, rmu, d );
             }
 
@@ -1778,11 +1784,6 @@ void Mehrotra
             // -----------------------
             try
             {
-                // Cache the metadata for the finalized JOrig
-                if( numIts == 0 )
-                    metaOrig = JOrig.InitializeMultMeta();
-                else
-                    JOrig.LockedDistGraph().multMeta = metaOrig;
                 J = JOrig;
 
                 UpdateDiagonal( J, Real(1), regTmp );
@@ -1827,19 +1828,34 @@ void Mehrotra
                 if( commRank == 0 && ctrl.time )
                     Output("Equilibration: ",timer.Stop()," secs");
 
-                JFront.Pull
-                ( J, map, rootSep, info, 
-                  mappedSources, mappedTargets, colOffs );
+                if( mixedPrecision )
+                {
+                    Copy( J, JLow );
+                    JFrontLow.Pull
+                    ( JLow, map, rootSep, info,
+                      mappedSources, mappedTargets, colOffs );
+                }
+                else
+                    JFront.Pull
+                    ( J, map, rootSep, info, 
+                      mappedSources, mappedTargets, colOffs );
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                LDL( info, JFront, LDL_2D );
+                if( mixedPrecision )
+                    LDL( info, JFrontLow, LDL_2D );
+                else
+                    LDL( info, JFront, LDL_2D );
                 if( commRank == 0 && ctrl.time )
                     Output("LDL: ",timer.Stop()," secs");
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                if( ctrl.resolveReg )
+                if( mixedPrecision )
+                    reg_ldl::MixedSolveAfter
+                    ( JOrig, regTmp, dInner, invMap, info, JFrontLow, d,
+                      dmvMeta, ctrl.solveCtrl );
+                else if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl );
@@ -1978,7 +1994,8 @@ void Mehrotra
         const Real muAff = Dot(dx,dz) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
             Output("sigma=",sigma);
 
@@ -1997,14 +2014,18 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
+        auto solveCombined = [&]()
         {
-            KKTRHS( rc, rb, rmu, z, d );
-            try
+            if( ctrl.system == FULL_KKT )
             {
+                KKTRHS( rc, rb, rmu, z, d );
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                if( ctrl.resolveReg )
+                if( mixedPrecision )
+                    reg_ldl::MixedSolveAfter
+                    ( JOrig, regTmp, dInner, invMap, info, JFrontLow, d,
+                      dmvMeta, ctrl.solveCtrl );
+                else if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl );
@@ -2015,25 +2036,18 @@ void Mehrotra
                       ctrl.solveCtrl.progress );
                 if( commRank == 0 && ctrl.time )
                     Output("Corrector: ",timer.Stop()," secs");
+                ExpandSolution( m, n, d, dx, dy, dz );
             }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-            try
+            else if( ctrl.system == AUGMENTED_KKT )
             {
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                if( ctrl.resolveReg )
+                if( mixedPrecision )
+                    reg_ldl::MixedSolveAfter
+                    ( JOrig, regTmp, dInner, invMap, info, JFrontLow, d,
+                      dmvMeta, ctrl.solveCtrl );
+                else if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl );
@@ -2044,22 +2058,11 @@ void Mehrotra
                       ctrl.solveCtrl.progress );
                 if( commRank == 0 && ctrl.time )
                     Output("Corrector: ",timer.Stop()," secs");
+                ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
             }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
-        }
-        else
-        {
-            NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
-            try
+            else
             {
+                NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dy );
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
                 reg_ldl::RegularizedSolveAfter
@@ -2068,18 +2071,25 @@ void Mehrotra
                   ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
                 if( commRank == 0 && ctrl.time )
                     Output("Corrector: ",timer.Stop()," secs");
+                ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
             }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandNormalSolution( A, gammaPerm, x, z, rc, rmu, dx, dy, dz );
+        };
+        try { solveCombined(); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        // TODO: Residual checks 
+        // TODO: Residual checks
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, x, z, sigma, mu, rmu, dx, dy, dz, dx, gondzioTemps,
+          solveCombined, ctrl.print && commRank == 0 );
 
         // Update the current estimates
         // ============================
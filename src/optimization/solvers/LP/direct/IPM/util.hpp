@@ -102,6 +102,24 @@ void KKT
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
 
+template<typename Real>
+void StaticKKT
+( const SparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+        SparseMatrix<Real>& J,
+  bool onlyLower );
+template<typename Real>
+void StaticKKT
+( const DistSparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower );
+
+using qp::direct::FinishKKT;
 using qp::direct::KKTRHS;
 using qp::direct::ExpandSolution;
 
@@ -140,6 +158,22 @@ void AugmentedKKT
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
 
+template<typename Real>
+void StaticAugmentedKKT
+( const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        SparseMatrix<Real>& J,
+  bool onlyLower );
+template<typename Real>
+void StaticAugmentedKKT
+( const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower );
+
+using qp::direct::FinishAugmentedKKT;
 using qp::direct::AugmentedKKTRHS;
 using qp::direct::ExpandAugmentedSolution;
 
@@ -114,6 +114,36 @@ void AugmentedKKT
     qp::direct::AugmentedKKT( Q, A, gamma, delta, x, z, J, onlyLower );
 }
 
+template<typename Real>
+void StaticAugmentedKKT
+( const SparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        SparseMatrix<Real>& J,
+  bool onlyLower )
+{
+    DEBUG_CSE
+    const Int n = A.Width();
+    SparseMatrix<Real> Q;
+    Zeros( Q, n, n );
+    qp::direct::StaticAugmentedKKT( Q, A, gamma, delta, J, onlyLower );
+}
+
+template<typename Real>
+void StaticAugmentedKKT
+( const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower )
+{
+    DEBUG_CSE
+    const Int n = A.Width();
+    DistSparseMatrix<Real> Q(A.Comm());
+    Zeros( Q, n, n );
+    qp::direct::StaticAugmentedKKT( Q, A, gamma, delta, J, onlyLower );
+}
+
 #define PROTO(Real) \
   template void AugmentedKKT \
   ( const Matrix<Real>& A, \
@@ -142,6 +172,18 @@ void AugmentedKKT
     const DistMultiVec<Real>& x, \
     const DistMultiVec<Real>& z, \
           DistSparseMatrix<Real>& J, \
+    bool onlyLower ); \
+  template void StaticAugmentedKKT \
+  ( const SparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          SparseMatrix<Real>& J, \
+    bool onlyLower ); \
+  template void StaticAugmentedKKT \
+  ( const DistSparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          DistSparseMatrix<Real>& J, \
     bool onlyLower );
 
 #define EL_NO_INT_PROTO
@@ -140,7 +140,7 @@ void KKT
     DEBUG_CSE
     const Int n = A.Width();
     SparseMatrix<Real> Q;
-    Q.Resize( n, n );
+    Zeros( Q, n, n );
     qp::direct::KKT( Q, A, gamma, delta, beta, x, z, J, onlyLower );
 }
 
@@ -157,10 +157,40 @@ void KKT
     DEBUG_CSE
     const Int n = A.Width();
     DistSparseMatrix<Real> Q(A.Comm());
-    Q.Resize( n, n );
+    Zeros( Q, n, n );
     qp::direct::KKT( Q, A, gamma, delta, beta, x, z, J, onlyLower );
 }
 
+template<typename Real>
+void StaticKKT
+( const SparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+        SparseMatrix<Real>& J, bool onlyLower )
+{
+    DEBUG_CSE
+    const Int n = A.Width();
+    SparseMatrix<Real> Q;
+    Zeros( Q, n, n );
+    qp::direct::StaticKKT( Q, A, gamma, delta, beta, J, onlyLower );
+}
+
+template<typename Real>
+void StaticKKT
+( const DistSparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+        DistSparseMatrix<Real>& J, bool onlyLower )
+{
+    DEBUG_CSE
+    const Int n = A.Width();
+    DistSparseMatrix<Real> Q(A.Comm());
+    Zeros( Q, n, n );
+    qp::direct::StaticKKT( Q, A, gamma, delta, beta, J, onlyLower );
+}
+
 #define PROTO(Real) \
   template void KKT \
   ( const Matrix<Real>& A, \
@@ -187,6 +217,18 @@ void KKT
           Real beta, \
     const DistMultiVec<Real>& x, \
     const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void StaticKKT \
+  ( const SparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          Real beta, \
+          SparseMatrix<Real>& J, bool onlyLower ); \
+  template void StaticKKT \
+  ( const DistSparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          Real beta, \
           DistSparseMatrix<Real>& J, bool onlyLower );
 
 #define EL_NO_INT_PROTO
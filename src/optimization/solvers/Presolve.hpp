@@ -0,0 +1,856 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_SOLVERS_PRESOLVE_HPP
+#define EL_OPTIMIZATION_SOLVERS_PRESOLVE_HPP
+
+#include <unordered_map>
+
+namespace El {
+namespace presolve {
+
+// Reductions of a sparse QP in "direct" conic form (with Q = 0 for an LP),
+//
+//   min (1/2) x^T Q x + c^T x,
+//   s.t. A x = b, x >= 0,
+//
+//   max (1/2) (A^T y - z + c)^T pinv(Q) (A^T y - z + c) - b^T y,
+//   s.t. A^T y - z + c in range(Q), z >= 0,
+//
+// which remove the rows and columns that can be resolved without an Interior
+// Point Method. Every removed column has a known value, so the primal solution
+// is recovered directly, while the dual variables of the removed rows are
+// recovered by undoing the reductions in reverse order. The dual variable of a
+// removed row is chosen so that the columns removed alongside it have
+// nonnegative reduced costs, z = c + Q x + A^T y (which are zero whenever the
+// column is positive), and the reduced costs of the remaining removed columns
+// follow from the recovered y.
+//
+// Each removed row only has nonzeros in columns which were removed no later
+// than itself, unless it was a duplicate (whose dual variable is zero), so the
+// rows which have yet to be restored never contribute to a reduced cost.
+
+enum StepType {
+  EMPTY_ROW,
+  DUPLICATE_ROW,
+  SINGLETON_ROW,
+  FORCING_ROW,
+  FIXED_COLUMN
+};
+
+struct Step
+{
+    StepType type;
+    Int row, col;
+};
+
+template<typename Real>
+struct Reduction
+{
+    // The dimensions of the original problem
+    Int m=0, n=0;
+
+    // Maps from the reduced row and column indices to the original ones
+    vector<Int> rowMap, colMap;
+
+    // The values of the removed columns and the step which removed each
+    // (-1 for the columns which were kept)
+    vector<Real> xFixed;
+    vector<Int> removedAt;
+
+    vector<Step> steps;
+};
+
+template<typename Real>
+void Presolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& QRed,
+        SparseMatrix<Real>& ARed,
+        Matrix<Real>& bRed,
+        Matrix<Real>& cRed,
+        Reduction<Real>& red,
+  const PresolveCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real tol = ctrl.tol;
+    red.m = m;
+    red.n = n;
+    red.xFixed.assign( n, Real(0) );
+    red.removedAt.assign( n, -1 );
+    red.steps.clear();
+
+    // Form A^T for access to the columns of A
+    SparseMatrix<Real> AT;
+    Transpose( A, AT );
+
+    // Count the nonzeros of each row and column of A, as well as those of
+    // each column of Q (which is assumed to be explicitly symmetric)
+    vector<bool> rowActive(m,true), colActive(n,true);
+    vector<Int> rowCount(m,0), colCount(n,0), qCount(n,0);
+    vector<Real> qDiag(n,Real(0));
+    for( Int i=0; i<m; ++i )
+    {
+        for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+        {
+            if( A.Value(e) != Real(0) )
+            {
+                ++rowCount[i];
+                ++colCount[A.Col(e)];
+            }
+        }
+    }
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int e=Q.RowOffset(j); e<Q.RowOffset(j+1); ++e )
+        {
+            if( Q.Value(e) != Real(0) )
+            {
+                ++qCount[j];
+                if( Q.Col(e) == j )
+                    qDiag[j] = Q.Value(e);
+            }
+        }
+    }
+
+    // The right-hand side and costs after moving the removed columns over
+    vector<Real> bRes(m), cRes(n);
+    for( Int i=0; i<m; ++i )
+        bRes[i] = b(i);
+    for( Int j=0; j<n; ++j )
+        cRes[j] = c(j);
+
+    auto isZero = [&]( Real resid, Real scale )
+    { return Abs(resid) <= tol*Max(Abs(scale),Real(1)); };
+
+    auto fixColumn = [&]( Int j, Real value )
+    {
+        colActive[j] = false;
+        red.xFixed[j] = value;
+        red.removedAt[j] = red.steps.size();
+        for( Int e=AT.RowOffset(j); e<AT.RowOffset(j+1); ++e )
+        {
+            const Int i = AT.Col(e);
+            if( rowActive[i] && AT.Value(e) != Real(0) )
+            {
+                bRes[i] -= AT.Value(e)*value;
+                --rowCount[i];
+            }
+        }
+        for( Int e=Q.RowOffset(j); e<Q.RowOffset(j+1); ++e )
+        {
+            const Int k = Q.Col(e);
+            if( k != j && colActive[k] && Q.Value(e) != Real(0) )
+            {
+                cRes[k] += Q.Value(e)*value;
+                --qCount[k];
+            }
+        }
+    };
+
+    auto removeRow = [&]( Int i )
+    {
+        rowActive[i] = false;
+        for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+        {
+            const Int j = A.Col(e);
+            if( colActive[j] && A.Value(e) != Real(0) )
+                --colCount[j];
+        }
+    };
+
+    auto activeRow = [&]( Int i, vector<Int>& inds, vector<Real>& vals )
+    {
+        inds.resize(0);
+        vals.resize(0);
+        for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+        {
+            if( colActive[A.Col(e)] && A.Value(e) != Real(0) )
+            {
+                inds.push_back( A.Col(e) );
+                vals.push_back( A.Value(e) );
+            }
+        }
+    };
+
+    Int numEmptyRows=0, numDuplicateRows=0, numSingletonRows=0,
+        numForcingRows=0, numEmptyCols=0, numDominatedCols=0;
+
+    auto removeEmptyRow = [&]( Int i )
+    {
+        if( !isZero(bRes[i],b(i)) )
+            RuntimeError
+            ("Row ",i," is empty but has a right-hand side of ",bRes[i]);
+        removeRow( i );
+        red.steps.push_back( Step{EMPTY_ROW,i,-1} );
+        ++numEmptyRows;
+    };
+
+    // Columns without nonzeros in the active rows are fixed at their minimizers
+    // unless they are coupled to other columns through Q
+    auto removeEmptyColumns = [&]()
+    {
+        for( Int j=0; j<n; ++j )
+        {
+            if( !colActive[j] || colCount[j] != 0 )
+                continue;
+            Real value;
+            if( qCount[j] == 0 )
+            {
+                if( cRes[j] < Real(0) )
+                    RuntimeError
+                    ("Column ",j," is empty but has a negative cost of ",
+                     cRes[j],", so the problem is unbounded");
+                value = 0;
+            }
+            else if( qCount[j] == 1 && qDiag[j] > Real(0) )
+                value = Max(-cRes[j]/qDiag[j],Real(0));
+            else
+                continue;
+            fixColumn( j, value );
+            red.steps.push_back( Step{FIXED_COLUMN,-1,j} );
+            ++numEmptyCols;
+        }
+    };
+
+    vector<Int> inds, otherInds;
+    vector<Real> vals, otherVals;
+    for( Int pass=0; pass<ctrl.maxPasses; ++pass )
+    {
+        const Int numStepsOld = red.steps.size();
+
+        // Empty, singleton, and forcing rows
+        // ==================================
+        for( Int i=0; i<m; ++i )
+        {
+            if( !rowActive[i] )
+                continue;
+            if( rowCount[i] == 0 )
+            {
+                removeEmptyRow( i );
+            }
+            else if( rowCount[i] == 1 )
+            {
+                // The row fixes the value of its only variable
+                activeRow( i, inds, vals );
+                const Int j = inds[0];
+                Real value = bRes[i] / vals[0];
+                if( value < Real(0) )
+                {
+                    if( !isZero(bRes[i],b(i)) )
+                        RuntimeError
+                        ("Singleton row ",i," forces x(",j,") = ",value);
+                    value = 0;
+                }
+                fixColumn( j, value );
+                removeRow( i );
+                red.steps.push_back( Step{SINGLETON_ROW,i,j} );
+                ++numSingletonRows;
+            }
+            else if( isZero(bRes[i],b(i)) )
+            {
+                // If the coefficients all share a sign, x >= 0 forces each
+                // of the row's variables to zero
+                activeRow( i, inds, vals );
+                bool positive=false, negative=false;
+                for( const Real& alpha : vals )
+                {
+                    if( alpha > Real(0) )
+                        positive = true;
+                    else
+                        negative = true;
+                }
+                if( positive != negative )
+                {
+                    for( const Int& j : inds )
+                        fixColumn( j, Real(0) );
+                    removeRow( i );
+                    red.steps.push_back( Step{FORCING_ROW,i,-1} );
+                    ++numForcingRows;
+                }
+            }
+        }
+
+        // Empty columns
+        // =============
+        removeEmptyColumns();
+
+        // Duplicate rows
+        // ==============
+        // Bucket the rows by a hash of their sparsity patterns and then
+        // compare the members of each bucket
+        std::unordered_map<size_t,vector<Int>> buckets;
+        for( Int i=0; i<m; ++i )
+        {
+            if( !rowActive[i] || rowCount[i] < 2 )
+                continue;
+            size_t hash = rowCount[i];
+            for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+                if( colActive[A.Col(e)] && A.Value(e) != Real(0) )
+                    hash = hash*1000003 ^ size_t(A.Col(e));
+            buckets[hash].push_back( i );
+        }
+        for( auto& bucket : buckets )
+        {
+            const vector<Int>& rows = bucket.second;
+            const Int numRows = rows.size();
+            for( Int s=0; s<numRows; ++s )
+            {
+                const Int i = rows[s];
+                if( !rowActive[i] )
+                    continue;
+                activeRow( i, inds, vals );
+                for( Int t=s+1; t<numRows; ++t )
+                {
+                    const Int k = rows[t];
+                    if( !rowActive[k] || rowCount[k] != rowCount[i] )
+                        continue;
+                    activeRow( k, otherInds, otherVals );
+                    if( otherInds != inds )
+                        continue;
+                    const Real ratio = otherVals[0] / vals[0];
+                    bool parallel = true;
+                    for( Int l=1; l<Int(vals.size()); ++l )
+                    {
+                        if( Abs(otherVals[l]-ratio*vals[l]) >
+                            tol*Abs(otherVals[l]) )
+                        {
+                            parallel = false;
+                            break;
+                        }
+                    }
+                    if( !parallel )
+                        continue;
+                    if( !isZero(bRes[k]-ratio*bRes[i],b(k)) )
+                        RuntimeError
+                        ("Rows ",i," and ",k," are parallel but have "
+                         "inconsistent right-hand sides");
+                    removeRow( k );
+                    red.steps.push_back( Step{DUPLICATE_ROW,k,-1} );
+                    ++numDuplicateRows;
+                }
+            }
+        }
+
+        // Dominated columns
+        // =================
+        // Each column singleton without a quadratic term, with a nonzero
+        // alpha in row i, implies that c_j + alpha y_i >= 0, which bounds y_i.
+        // If these bounds show that the reduced cost of another such column
+        // is positive for every dual feasible y, then it is zero at the
+        // solution. The column singletons themselves are kept so that the
+        // reduced dual problem continues to enforce the bounds.
+        vector<bool> haveLower(m,false), haveUpper(m,false);
+        vector<Real> yLower(m), yUpper(m);
+        bool haveBounds = false;
+        for( Int j=0; j<n; ++j )
+        {
+            if( !colActive[j] || colCount[j] != 1 || qCount[j] != 0 )
+                continue;
+            for( Int e=AT.RowOffset(j); e<AT.RowOffset(j+1); ++e )
+            {
+                const Int i = AT.Col(e);
+                const Real alpha = AT.Value(e);
+                if( !rowActive[i] || alpha == Real(0) )
+                    continue;
+                const Real bound = -cRes[j] / alpha;
+                if( alpha > Real(0) )
+                {
+                    yLower[i] = ( haveLower[i] ? Max(yLower[i],bound) : bound );
+                    haveLower[i] = true;
+                }
+                else
+                {
+                    yUpper[i] = ( haveUpper[i] ? Min(yUpper[i],bound) : bound );
+                    haveUpper[i] = true;
+                }
+                haveBounds = true;
+            }
+        }
+        if( haveBounds )
+        {
+            for( Int j=0; j<n; ++j )
+            {
+                if( !colActive[j] || colCount[j] < 2 || qCount[j] != 0 )
+                    continue;
+                Real zLower = cRes[j];
+                bool bounded = true;
+                for( Int e=AT.RowOffset(j); e<AT.RowOffset(j+1); ++e )
+                {
+                    const Int i = AT.Col(e);
+                    const Real alpha = AT.Value(e);
+                    if( !rowActive[i] || alpha == Real(0) )
+                        continue;
+                    if( alpha > Real(0) && haveLower[i] )
+                        zLower += alpha*yLower[i];
+                    else if( alpha < Real(0) && haveUpper[i] )
+                        zLower += alpha*yUpper[i];
+                    else
+                    {
+                        bounded = false;
+                        break;
+                    }
+                }
+                if( bounded && zLower > tol*Max(Abs(c(j)),Real(1)) )
+                {
+                    fixColumn( j, Real(0) );
+                    red.steps.push_back( Step{FIXED_COLUMN,-1,j} );
+                    ++numDominatedCols;
+                }
+            }
+        }
+
+        if( Int(red.steps.size()) == numStepsOld )
+            break;
+    }
+    // Fixing columns in the last pass may have emptied rows, and removing
+    // rows may have emptied columns
+    for( Int i=0; i<m; ++i )
+        if( rowActive[i] && rowCount[i] == 0 )
+            removeEmptyRow( i );
+    removeEmptyColumns();
+
+    // Form the reduced problem
+    // ========================
+    vector<Int> rowInv(m,-1), colInv(n,-1);
+    red.rowMap.resize(0);
+    red.colMap.resize(0);
+    for( Int i=0; i<m; ++i )
+    {
+        if( rowActive[i] )
+        {
+            rowInv[i] = red.rowMap.size();
+            red.rowMap.push_back( i );
+        }
+    }
+    for( Int j=0; j<n; ++j )
+    {
+        if( colActive[j] )
+        {
+            colInv[j] = red.colMap.size();
+            red.colMap.push_back( j );
+        }
+    }
+    const Int mRed = red.rowMap.size();
+    const Int nRed = red.colMap.size();
+
+    Zeros( ARed, mRed, nRed );
+    ARed.Reserve( A.NumEntries() );
+    for( Int iRed=0; iRed<mRed; ++iRed )
+    {
+        const Int i = red.rowMap[iRed];
+        for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+        {
+            const Int jRed = colInv[A.Col(e)];
+            if( jRed >= 0 && A.Value(e) != Real(0) )
+                ARed.QueueUpdate( iRed, jRed, A.Value(e) );
+        }
+    }
+    ARed.ProcessQueues();
+
+    Zeros( QRed, nRed, nRed );
+    QRed.Reserve( Q.NumEntries() );
+    for( Int iRed=0; iRed<nRed; ++iRed )
+    {
+        const Int i = red.colMap[iRed];
+        for( Int e=Q.RowOffset(i); e<Q.RowOffset(i+1); ++e )
+        {
+            const Int jRed = colInv[Q.Col(e)];
+            if( jRed >= 0 && Q.Value(e) != Real(0) )
+                QRed.QueueUpdate( iRed, jRed, Q.Value(e) );
+        }
+    }
+    QRed.ProcessQueues();
+
+    bRed.Resize( mRed, 1 );
+    for( Int iRed=0; iRed<mRed; ++iRed )
+        bRed(iRed) = bRes[red.rowMap[iRed]];
+    cRed.Resize( nRed, 1 );
+    for( Int jRed=0; jRed<nRed; ++jRed )
+        cRed(jRed) = cRes[red.colMap[jRed]];
+
+    if( ctrl.print )
+        Output
+        ("Presolve reduced ",m," x ",n," to ",mRed," x ",nRed," by removing ",
+         numEmptyRows," empty, ",numSingletonRows," singleton, ",
+         numForcingRows," forcing, and ",numDuplicateRows," duplicate rows, "
+         "as well as ",numEmptyCols," empty and ",numDominatedCols,
+         " dominated columns");
+}
+
+template<typename Real>
+void Postsolve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const Reduction<Real>& red,
+  const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+  const Matrix<Real>& zRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z )
+{
+    DEBUG_CSE
+    const Int m = red.m;
+    const Int n = red.n;
+    const Int mRed = red.rowMap.size();
+    const Int nRed = red.colMap.size();
+
+    Zeros( x, n, 1 );
+    for( Int j=0; j<n; ++j )
+        x(j) = red.xFixed[j];
+    for( Int jRed=0; jRed<nRed; ++jRed )
+        x(red.colMap[jRed]) = xRed(jRed);
+    Zeros( y, m, 1 );
+    for( Int iRed=0; iRed<mRed; ++iRed )
+        y(red.rowMap[iRed]) = yRed(iRed);
+    Zeros( z, n, 1 );
+    for( Int jRed=0; jRed<nRed; ++jRed )
+        z(red.colMap[jRed]) = zRed(jRed);
+
+    SparseMatrix<Real> AT;
+    Transpose( A, AT );
+    auto reducedCost = [&]( Int j ) -> Real
+    {
+        Real gamma = c(j);
+        for( Int e=Q.RowOffset(j); e<Q.RowOffset(j+1); ++e )
+            gamma += Q.Value(e)*x(Q.Col(e));
+        for( Int e=AT.RowOffset(j); e<AT.RowOffset(j+1); ++e )
+            gamma += AT.Value(e)*y(AT.Col(e));
+        return gamma;
+    };
+
+    for( Int s=Int(red.steps.size())-1; s>=0; --s )
+    {
+        const Step& step = red.steps[s];
+        const Int i = step.row;
+        if( step.type == SINGLETON_ROW )
+        {
+            // Choose y_i so that the reduced cost of the fixed column is zero
+            const Int j = step.col;
+            Real alpha = 0;
+            for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+                if( A.Col(e) == j )
+                    alpha = A.Value(e);
+            y(i) = -reducedCost(j) / alpha;
+            z(j) = 0;
+        }
+        else if( step.type == FORCING_ROW )
+        {
+            // The coefficients of the row share a sign, so each of its
+            // (zeroed) columns bounds y_i from the same side. Choosing the
+            // tightest of these bounds keeps every reduced cost nonnegative.
+            bool first = true;
+            Real eta = 0;
+            for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+            {
+                const Int j = A.Col(e);
+                const Real alpha = A.Value(e);
+                if( red.removedAt[j] != s || alpha == Real(0) )
+                    continue;
+                const Real bound = -reducedCost(j) / alpha;
+                if( first )
+                    eta = bound;
+                else
+                    eta = ( alpha > Real(0) ? Max(eta,bound) : Min(eta,bound) );
+                first = false;
+            }
+            y(i) = eta;
+            for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+            {
+                const Int j = A.Col(e);
+                if( red.removedAt[j] == s )
+                    z(j) = reducedCost(j);
+            }
+        }
+        else if( step.type == FIXED_COLUMN )
+        {
+            z(step.col) = reducedCost(step.col);
+        }
+        // The dual variables of empty and duplicate rows remain zero
+    }
+}
+
+template<typename Real>
+void Restrict
+( const vector<Int>& map, const Matrix<Real>& v, Matrix<Real>& vRed )
+{
+    const Int numRed = map.size();
+    vRed.Resize( numRed, 1 );
+    for( Int iRed=0; iRed<numRed; ++iRed )
+        vRed(iRed) = v(map[iRed]);
+}
+
+// Solve a sparse direct conic-form QP (with Q = 0 for an LP) by calling
+// 'solve' on the presolved problem and then recovering the solution of the
+// original problem. If the reductions remove every row but not every column,
+// the remaining columns are coupled through Q, and 'solve' is instead called
+// on the original problem.
+template<typename Real,typename SolveType>
+void Solve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const PresolveCtrl<Real>& ctrl,
+  bool primalInit,
+  bool dualInit,
+  SolveType solve )
+{
+    DEBUG_CSE
+    SparseMatrix<Real> QRed, ARed;
+    Matrix<Real> bRed, cRed, xRed, yRed, zRed;
+    Reduction<Real> red;
+    Presolve( Q, A, b, c, QRed, ARed, bRed, cRed, red, ctrl );
+    if( ARed.Height() == 0 && ARed.Width() > 0 )
+    {
+        // Only columns coupled through Q remain, and, rather than handing the
+        // IPM a problem without any equality constraints, solve the original
+        if( ctrl.print )
+            Output("Presolve removed every row, so solving the original");
+        solve( Q, A, b, c, x, y, z );
+        return;
+    }
+    if( primalInit )
+        Restrict( red.colMap, x, xRed );
+    if( dualInit )
+    {
+        Restrict( red.rowMap, y, yRed );
+        Restrict( red.colMap, z, zRed );
+    }
+
+    if( ARed.Width() > 0 )
+        solve( QRed, ARed, bRed, cRed, xRed, yRed, zRed );
+    else
+    {
+        Zeros( xRed, 0, 1 );
+        Zeros( yRed, 0, 1 );
+        Zeros( zRed, 0, 1 );
+    }
+
+    Postsolve( Q, A, c, red, xRed, yRed, zRed, x, y, z );
+}
+
+template<typename Real>
+void ScatterFromRoot
+( const SparseMatrix<Real>& ALoc, DistSparseMatrix<Real>& A, bool isRoot )
+{
+    DEBUG_CSE
+    if( isRoot )
+    {
+        const Int numEntries = ALoc.NumEntries();
+        A.Reserve( numEntries, numEntries );
+        for( Int i=0; i<ALoc.Height(); ++i )
+            for( Int e=ALoc.RowOffset(i); e<ALoc.RowOffset(i+1); ++e )
+                A.QueueUpdate( i, ALoc.Col(e), ALoc.Value(e) );
+    }
+    A.ProcessQueues();
+}
+
+template<typename Real>
+void ScatterFromRoot
+( const Matrix<Real>& xLoc, DistMultiVec<Real>& x, bool isRoot )
+{
+    DEBUG_CSE
+    if( isRoot )
+    {
+        x.Reserve( xLoc.Height() );
+        for( Int i=0; i<xLoc.Height(); ++i )
+            x.QueueUpdate( i, 0, xLoc(i) );
+    }
+    x.ProcessQueues();
+}
+
+// The distributed analogue of the above. The reductions are sequential, so
+// the problem is gathered onto the root process, presolved and postsolved
+// there, and only the reduced problem is solved in parallel. Problems too
+// large to gather (see PresolveCtrl::maxGatherEntries) are instead solved
+// directly.
+template<typename Real,typename SolveType>
+void Solve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const PresolveCtrl<Real>& ctrl,
+  bool primalInit,
+  bool dualInit,
+  SolveType solve )
+{
+    DEBUG_CSE
+    mpi::Comm comm = A.Comm();
+    const int root = 0;
+    const bool isRoot = ( mpi::Rank(comm) == root );
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    const Int numEntries = Q.NumEntries() + A.NumEntries();
+    if( ctrl.maxGatherEntries >= 0 && numEntries > ctrl.maxGatherEntries )
+    {
+        if( ctrl.print && isRoot )
+            Output
+            ("Skipping presolve, as gathering ",numEntries," nonzeros onto the "
+             "root would exceed the limit of ",ctrl.maxGatherEntries);
+        solve( Q, A, b, c, x, y, z );
+        return;
+    }
+
+    SparseMatrix<Real> QLoc, ALoc, QRedLoc, ARedLoc;
+    Matrix<Real> bLoc, cLoc, xLoc, yLoc, zLoc,
+                 bRedLoc, cRedLoc, xRedLoc, yRedLoc, zRedLoc;
+    Reduction<Real> red;
+    if( isRoot )
+    {
+        CopyFromRoot( Q, QLoc );
+        CopyFromRoot( A, ALoc );
+        CopyFromRoot( b, bLoc );
+        CopyFromRoot( c, cLoc );
+        if( primalInit )
+            CopyFromRoot( x, xLoc );
+        if( dualInit )
+        {
+            CopyFromRoot( y, yLoc );
+            CopyFromRoot( z, zLoc );
+        }
+    }
+    else
+    {
+        CopyFromNonRoot( Q, root );
+        CopyFromNonRoot( A, root );
+        CopyFromNonRoot( b, root );
+        CopyFromNonRoot( c, root );
+        if( primalInit )
+            CopyFromNonRoot( x, root );
+        if( dualInit )
+        {
+            CopyFromNonRoot( y, root );
+            CopyFromNonRoot( z, root );
+        }
+    }
+
+    // Presolve on the root and make sure that every process learns of any
+    // detected infeasibility or unboundedness
+    int failed = 0;
+    string failure;
+    Int reducedDims[2] = { 0, 0 };
+    if( isRoot )
+    {
+        try
+        {
+            Presolve
+            ( QLoc, ALoc, bLoc, cLoc, QRedLoc, ARedLoc, bRedLoc, cRedLoc,
+              red, ctrl );
+            if( primalInit )
+                Restrict( red.colMap, xLoc, xRedLoc );
+            if( dualInit )
+            {
+                Restrict( red.rowMap, yLoc, yRedLoc );
+                Restrict( red.colMap, zLoc, zRedLoc );
+            }
+            reducedDims[0] = ARedLoc.Height();
+            reducedDims[1] = ARedLoc.Width();
+        }
+        catch( const std::exception& e )
+        {
+            failed = 1;
+            failure = e.what();
+        }
+    }
+    mpi::Broadcast( failed, root, comm );
+    if( failed )
+    {
+        if( isRoot )
+            RuntimeError(failure);
+        else
+            RuntimeError("Presolve failed on the root process");
+    }
+    mpi::Broadcast( reducedDims, 2, root, comm );
+    const Int mRed = reducedDims[0];
+    const Int nRed = reducedDims[1];
+    if( mRed == 0 && nRed > 0 )
+    {
+        if( ctrl.print && isRoot )
+            Output("Presolve removed every row, so solving the original");
+        solve( Q, A, b, c, x, y, z );
+        return;
+    }
+
+    // Distribute and solve the reduced problem
+    DistSparseMatrix<Real> QRed(comm), ARed(comm);
+    DistMultiVec<Real> bRed(comm), cRed(comm),
+                       xRed(comm), yRed(comm), zRed(comm);
+    Zeros( QRed, nRed, nRed );
+    Zeros( ARed, mRed, nRed );
+    Zeros( bRed, mRed, 1 );
+    Zeros( cRed, nRed, 1 );
+    ScatterFromRoot( QRedLoc, QRed, isRoot );
+    ScatterFromRoot( ARedLoc, ARed, isRoot );
+    ScatterFromRoot( bRedLoc, bRed, isRoot );
+    ScatterFromRoot( cRedLoc, cRed, isRoot );
+    if( primalInit )
+    {
+        Zeros( xRed, nRed, 1 );
+        ScatterFromRoot( xRedLoc, xRed, isRoot );
+    }
+    if( dualInit )
+    {
+        Zeros( yRed, mRed, 1 );
+        Zeros( zRed, nRed, 1 );
+        ScatterFromRoot( yRedLoc, yRed, isRoot );
+        ScatterFromRoot( zRedLoc, zRed, isRoot );
+    }
+    if( nRed > 0 )
+        solve( QRed, ARed, bRed, cRed, xRed, yRed, zRed );
+    else
+    {
+        Zeros( xRed, 0, 1 );
+        Zeros( yRed, 0, 1 );
+        Zeros( zRed, 0, 1 );
+    }
+
+    // Postsolve on the root and distribute the result
+    if( isRoot )
+    {
+        CopyFromRoot( xRed, xRedLoc );
+        CopyFromRoot( yRed, yRedLoc );
+        CopyFromRoot( zRed, zRedLoc );
+        Postsolve
+        ( QLoc, ALoc, cLoc, red, xRedLoc, yRedLoc, zRedLoc, xLoc, yLoc, zLoc );
+    }
+    else
+    {
+        CopyFromNonRoot( xRed, root );
+        CopyFromNonRoot( yRed, root );
+        CopyFromNonRoot( zRed, root );
+    }
+    x.SetComm( comm );
+    y.SetComm( comm );
+    z.SetComm( comm );
+    Zeros( x, n, 1 );
+    Zeros( y, m, 1 );
+    Zeros( z, n, 1 );
+    ScatterFromRoot( xLoc, x, isRoot );
+    ScatterFromRoot( yLoc, y, isRoot );
+    ScatterFromRoot( zLoc, z, isRoot );
+}
+
+} // namespace presolve
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_SOLVERS_PRESOLVE_HPP
@@ -9,6 +9,7 @@
 #include <El.hpp>
 #include "./QP/direct/IPM.hpp"
 #include "./QP/affine/IPM.hpp"
+#include "./Presolve.hpp"
 
 namespace El {
 
@@ -62,10 +63,23 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
-    if( ctrl.approach == QP_MEHROTRA )
-        qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != QP_MEHROTRA )
         LogicError("Unsupported solver");
+
+    if( ctrl.presolveCtrl.enable )
+    {
+        auto solve =
+          [&]( const SparseMatrix<Real>& QRed, const SparseMatrix<Real>& ARed,
+               const Matrix<Real>& bRed, const Matrix<Real>& cRed,
+               Matrix<Real>& xRed, Matrix<Real>& yRed, Matrix<Real>& zRed )
+          { qp::direct::Mehrotra
+            ( QRed, ARed, bRed, cRed, xRed, yRed, zRed, ctrl.mehrotraCtrl ); };
+        presolve::Solve
+        ( Q, A, b, c, x, y, z, ctrl.presolveCtrl,
+          ctrl.mehrotraCtrl.primalInit, ctrl.mehrotraCtrl.dualInit, solve );
+    }
+    else
+        qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
 }
 
 template<typename Real>
@@ -80,10 +94,27 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl )
 {
     DEBUG_CSE
-    if( ctrl.approach == QP_MEHROTRA )
-        qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != QP_MEHROTRA )
         LogicError("Unsupported solver");
+
+    if( ctrl.presolveCtrl.enable )
+    {
+        auto solve =
+          [&]( const DistSparseMatrix<Real>& QRed,
+               const DistSparseMatrix<Real>& ARed,
+               const DistMultiVec<Real>& bRed,
+               const DistMultiVec<Real>& cRed,
+               DistMultiVec<Real>& xRed,
+               DistMultiVec<Real>& yRed,
+               DistMultiVec<Real>& zRed )
+          { qp::direct::Mehrotra
+            ( QRed, ARed, bRed, cRed, xRed, yRed, zRed, ctrl.mehrotraCtrl ); };
+        presolve::Solve
+        ( Q, A, b, c, x, y, z, ctrl.presolveCtrl,
+          ctrl.mehrotraCtrl.primalInit, ctrl.mehrotraCtrl.dualInit, solve );
+    }
+    else
+        qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
 }
 
 // Affine conic form
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../util/Gondzio.hpp"
 
 namespace El {
 namespace qp {
@@ -50,12 +51,6 @@ void Mehrotra
     DEBUG_CSE
 
     // TODO: Move these into the control structure
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
 
     // Equilibrate the QP by diagonally scaling [A;G]
@@ -127,6 +122,7 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError;
+    GondzioTemps<Matrix<Real>> gondzioTemps;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -281,7 +277,8 @@ void Mehrotra
         const Real muAff = Dot(ds,dz) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
 
@@ -301,13 +298,23 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Compute the proposed step from the KKT system
-        // ---------------------------------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        ldl::SolveAfter( J, dSub, p, d, false );
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        auto solveCombined = [&]()
+        {
+            // Compute the proposed step from the KKT system
+            // ---------------------------------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            ldl::SolveAfter( J, dSub, p, d, false );
+            ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        };
+        solveCombined();
         // TODO: Residual checks
 
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, s, z, sigma, mu, rmu, dx, dy, dz, ds, gondzioTemps,
+          solveCombined, ctrl.print );
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
@@ -359,12 +366,6 @@ void Mehrotra
     DEBUG_CSE
 
     // TODO: Move these into the control structure
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
 
     const Grid& grid = APre.Grid();
@@ -485,6 +486,7 @@ void Mehrotra
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid);
     dzError.AlignWith( s );
+    GondzioTemps<DistMatrix<Real>> gondzioTemps(grid);
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -650,7 +652,8 @@ void Mehrotra
         const Real muAff = Dot(ds,dz) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
             Output("sigma=",sigma);
 
@@ -670,19 +673,21 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Form the new KKT RHS
-        // --------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the new direction
-        // ---------------------------
-        try 
-        { 
+        auto solveCombined = [&]()
+        {
+            // Form the new KKT RHS
+            // --------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            // Solve for the new direction
+            // ---------------------------
             if( ctrl.time && commRank == 0 )
                 timer.Start();
-            ldl::SolveAfter( J, dSub, p, d, false ); 
+            ldl::SolveAfter( J, dSub, p, d, false );
             if( ctrl.time && commRank == 0 )
                 Output("Combined solve: ",timer.Stop()," secs");
-        }
+            ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        };
+        try { solveCombined(); }
         catch(...)
         {
             if( relError <= ctrl.minTol )    
@@ -691,9 +696,14 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
         // TODO: Residual checks
 
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, s, z, sigma, mu, rmu, dx, dy, dz, ds, gondzioTemps,
+          solveCombined, ctrl.print && commRank == 0 );
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
@@ -745,12 +755,6 @@ void Mehrotra
     DEBUG_CSE
 
     // TODO: Move these into the control structure
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
 
     // Equilibrate the QP by diagonally scaling [A;G]
@@ -848,6 +852,7 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError;
+    GondzioTemps<Matrix<Real>> gondzioTemps;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1032,7 +1037,8 @@ void Mehrotra
         const Real muAff = Dot(ds,dz) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
 
@@ -1052,13 +1058,13 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Set up the new KKT RHS
-        // ----------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the new direction
-        // ---------------------------
-        try
+        auto solveCombined = [&]()
         {
+            // Set up the new KKT RHS
+            // ----------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            // Solve for the new direction
+            // ---------------------------
             if( ctrl.resolveReg )
                 reg_ldl::SolveAfter
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d,
@@ -1068,7 +1074,9 @@ void Mehrotra
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress );
-        }
+            ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        };
+        try { solveCombined(); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -1077,7 +1085,12 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, s, z, sigma, mu, rmu, dx, dy, dz, ds, gondzioTemps,
+          solveCombined, ctrl.print );
 
         // Update the current estimates
         // ============================
@@ -1130,12 +1143,6 @@ void Mehrotra
     DEBUG_CSE
 
     // TODO: Move these into the control structure
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
     //const Real selInvTol = Pow(eps,Real(-0.25));
     const Real selInvTol = 0;
@@ -1278,6 +1285,7 @@ void Mehrotra
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+    GondzioTemps<DistMultiVec<Real>> gondzioTemps(comm);
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1487,7 +1495,8 @@ void Mehrotra
         const Real muAff = Dot(ds,dz) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
             Output("sigma=",sigma);
 
@@ -1507,13 +1516,13 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Set up the new RHS
-        // ------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Compute the new direction
-        // -------------------------
-        try
+        auto solveCombined = [&]()
         {
+            // Set up the new RHS
+            // ------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            // Compute the new direction
+            // -------------------------
             if( commRank == 0 && ctrl.time )
                 timer.Start();
             if( ctrl.resolveReg )
@@ -1527,7 +1536,9 @@ void Mehrotra
                   ctrl.solveCtrl.progress );
             if( commRank == 0 && ctrl.time )
                 Output("Corrector solver: ",timer.Stop()," secs");
-        }
+            ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+        };
+        try { solveCombined(); }
         catch(...)
         {
             if( relError <= ctrl.minTol )
@@ -1536,7 +1547,12 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, s, z, sigma, mu, rmu, dx, dy, dz, ds, gondzioTemps,
+          solveCombined, ctrl.print && commRank == 0 );
 
         // Update the current estimates
         // ============================
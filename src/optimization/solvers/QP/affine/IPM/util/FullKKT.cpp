@@ -163,9 +163,10 @@ void KKT
     if( onlyLower )
     {
         numUsedEntriesQ = 0;
-        for( Int e=0; e<numEntriesQ; ++e )
-            if( Q.Row(e) >= Q.Col(e) )
-                ++numUsedEntriesQ;
+        for( Int i=0; i<n; ++i )
+            for( Int e=Q.RowOffset(i); e<Q.RowOffset(i+1); ++e )
+                if( i >= Q.Col(e) )
+                    ++numUsedEntriesQ;
     }
     else
         numUsedEntriesQ = numEntriesQ;
@@ -177,30 +178,38 @@ void KKT
 
     // Jxx = Q
     // =======
-    for( Int e=0; e<numEntriesQ; ++e )
+    for( Int i=0; i<n; ++i )
     {
-        const Int i = Q.Row(e);
-        const Int j = Q.Col(e);
-        if( i >= j || !onlyLower )
-            J.QueueUpdate( i, j, Q.Value(e) );
+        for( Int e=Q.RowOffset(i); e<Q.RowOffset(i+1); ++e )
+        {
+            const Int j = Q.Col(e);
+            if( i >= j || !onlyLower )
+                J.QueueUpdate( i, j, Q.Value(e) );
+        }
     }
 
     // Jyx = A (and Jxy = A^T)
     // =======================
-    for( Int e=0; e<numEntriesA; ++e )
+    for( Int i=0; i<m; ++i )
     {
-        J.QueueUpdate( n+A.Row(e), A.Col(e), A.Value(e) );
-        if( !onlyLower )
-            J.QueueUpdate( A.Col(e), n+A.Row(e), A.Value(e) );
+        for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+        {
+            J.QueueUpdate( n+i, A.Col(e), A.Value(e) );
+            if( !onlyLower )
+                J.QueueUpdate( A.Col(e), n+i, A.Value(e) );
+        }
     }
 
     // Jzx = G (and Jxz = G^T)
     // =======================
-    for( Int e=0; e<numEntriesG; ++e )
+    for( Int i=0; i<k; ++i )
     {
-        J.QueueUpdate( n+m+G.Row(e), G.Col(e), G.Value(e) );
-        if( !onlyLower )
-            J.QueueUpdate( G.Col(e), n+m+G.Row(e), G.Value(e) );
+        for( Int e=G.RowOffset(i); e<G.RowOffset(i+1); ++e )
+        {
+            J.QueueUpdate( n+m+i, G.Col(e), G.Value(e) );
+            if( !onlyLower )
+                J.QueueUpdate( G.Col(e), n+m+i, G.Value(e) );
+        }
     }
 
     // Jzz = -z <> s
@@ -236,9 +245,10 @@ void StaticKKT
     if( onlyLower )
     {
         numUsedEntriesQ = 0;
-        for( Int e=0; e<numEntriesQ; ++e )
-            if( Q.Row(e) >= Q.Col(e) )
-                ++numUsedEntriesQ;
+        for( Int i=0; i<n; ++i )
+            for( Int e=Q.RowOffset(i); e<Q.RowOffset(i+1); ++e )
+                if( i >= Q.Col(e) )
+                    ++numUsedEntriesQ;
     }
     else
         numUsedEntriesQ = numEntriesQ;
@@ -250,12 +260,14 @@ void StaticKKT
 
     // Jxx = Q + gamma^2*I
     // ===================
-    for( Int e=0; e<numEntriesQ; ++e )
+    for( Int i=0; i<n; ++i )
     {
-        const Int i = Q.Row(e);
-        const Int j = Q.Col(e);
-        if( i >= j || !onlyLower )
-            J.QueueUpdate( i, j, Q.Value(e) );
+        for( Int e=Q.RowOffset(i); e<Q.RowOffset(i+1); ++e )
+        {
+            const Int j = Q.Col(e);
+            if( i >= j || !onlyLower )
+                J.QueueUpdate( i, j, Q.Value(e) );
+        }
     }
     for( Int i=0; i<n; ++i )
         J.QueueUpdate( i, i, gamma*gamma );
@@ -267,20 +279,26 @@ void StaticKKT
 
     // Jyx = A (and Jxy = A^T)
     // =======================
-    for( Int e=0; e<numEntriesA; ++e )
+    for( Int i=0; i<m; ++i )
     {
-        J.QueueUpdate( n+A.Row(e), A.Col(e), A.Value(e) );
-        if( !onlyLower )
-            J.QueueUpdate( A.Col(e), n+A.Row(e), A.Value(e) );
+        for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+        {
+            J.QueueUpdate( n+i, A.Col(e), A.Value(e) );
+            if( !onlyLower )
+                J.QueueUpdate( A.Col(e), n+i, A.Value(e) );
+        }
     }
 
     // Jzx = G (and Jxz = G^T)
     // =======================
-    for( Int e=0; e<numEntriesG; ++e )
+    for( Int i=0; i<k; ++i )
     {
-        J.QueueUpdate( n+m+G.Row(e), G.Col(e), G.Value(e) );
-        if( !onlyLower )
-            J.QueueUpdate( G.Col(e), n+m+G.Row(e), G.Value(e) );
+        for( Int e=G.RowOffset(i); e<G.RowOffset(i+1); ++e )
+        {
+            J.QueueUpdate( n+m+i, G.Col(e), G.Value(e) );
+            if( !onlyLower )
+                J.QueueUpdate( G.Col(e), n+m+i, G.Value(e) );
+        }
     }
 
     // Jzz = -beta^2*I
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../util/Gondzio.hpp"
 
 namespace El {
 namespace qp {
@@ -45,13 +46,7 @@ void Mehrotra
 {
     DEBUG_CSE
 
-    const bool stepLengthSigma = true;
     const bool standardShift = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
 
     // Equilibrate the QP by diagonally scaling A
     auto Q = QPre;
@@ -110,6 +105,7 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, prod;
+    GondzioTemps<Matrix<Real>> gondzioTemps;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -286,7 +282,8 @@ void Mehrotra
         const Real muAff = Dot(dx,dz) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
 
@@ -305,48 +302,50 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
+        auto solveCombined = [&]()
         {
-            // Construct the new KKT RHS
-            // -------------------------
-            KKTRHS( rc, rb, rmu, z, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
+            if( ctrl.system == FULL_KKT )
             {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
+                // Construct the new KKT RHS
+                // -------------------------
+                KKTRHS( rc, rb, rmu, z, d );
 
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
+                // Solve for the direction
+                // -----------------------
+                ldl::SolveAfter( J, dSub, p, d, false );
+                ExpandSolution( m, n, d, dx, dy, dz );
+            }
+            else if( ctrl.system == AUGMENTED_KKT )
             {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+                // Construct the new KKT RHS
+                // -------------------------
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
+
+                // Solve for the direction
+                // -----------------------
+                ldl::SolveAfter( J, dSub, p, d, false );
+                ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
             }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+            else
+                LogicError("Invalid KKT system choice");
+        };
+        try { solveCombined(); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        else
-            LogicError("Invalid KKT system choice");
         // TODO: Residual checks
 
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, x, z, sigma, mu, rmu, dx, dy, dz, dx, gondzioTemps,
+          solveCombined, ctrl.print );
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -392,13 +391,7 @@ void Mehrotra
 {
     DEBUG_CSE
 
-    const bool stepLengthSigma = true;
     const bool standardShift = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
 
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
@@ -494,6 +487,7 @@ void Mehrotra
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     dzError.AlignWith( dz );
+    GondzioTemps<DistMatrix<Real>> gondzioTemps(grid);
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -672,7 +666,8 @@ void Mehrotra
         const Real muAff = Dot(dx,dz) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
             Output("sigma=",sigma);
 
@@ -691,48 +686,50 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
+        auto solveCombined = [&]()
         {
-            // Construct the new KKT RHS
-            // -------------------------
-            KKTRHS( rc, rb, rmu, z, d );
-
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
+            if( ctrl.system == FULL_KKT )
             {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Construct the new KKT RHS
-            // -------------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
+                // Construct the new KKT RHS
+                // -------------------------
+                KKTRHS( rc, rb, rmu, z, d );
 
-            // Solve for the direction
-            // -----------------------
-            try { ldl::SolveAfter( J, dSub, p, d, false ); }
-            catch(...)
+                // Solve for the direction
+                // -----------------------
+                ldl::SolveAfter( J, dSub, p, d, false );
+                ExpandSolution( m, n, d, dx, dy, dz );
+            }
+            else if( ctrl.system == AUGMENTED_KKT )
             {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+                // Construct the new KKT RHS
+                // -------------------------
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
+
+                // Solve for the direction
+                // -----------------------
+                ldl::SolveAfter( J, dSub, p, d, false );
+                ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
             }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+            else
+                LogicError("Invalid KKT system choice");
+        };
+        try { solveCombined(); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        else
-            LogicError("Invalid KKT system choice");
         // TODO: Residual checks
 
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, x, z, sigma, mu, rmu, dx, dy, dz, dx, gondzioTemps,
+          solveCombined, ctrl.print && commRank == 0 );
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -778,12 +775,6 @@ void Mehrotra
 {
     DEBUG_CSE
 
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
 
     // Equilibrate the QP by diagonally scaling A
@@ -839,7 +830,7 @@ void Mehrotra
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
-    // TODO: Add permanent regularization and cache J metadata
+    // TODO: Add permanent regularization
     if( ctrl.system == AUGMENTED_KKT )
     {
         Initialize
@@ -878,8 +869,21 @@ void Mehrotra
     }
     regTmp *= origTwoNormEst;
 
+    // Form the portion of the KKT system which does not depend upon x and z
+    SparseMatrix<Real> JStatic;
+    if( ctrl.system == FULL_KKT )
+        StaticKKT
+        ( Q, A, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm, JStatic, false );
+    else if( ctrl.system == AUGMENTED_KKT )
+        StaticAugmentedKKT
+        ( Q, A, ctrl.reg0Perm, ctrl.reg1Perm, JStatic, false );
+
     SparseMatrix<Real> J, JOrig;
     ldl::Front<Real> JFront;
+    const bool mixedPrecision =
+      ctrl.mixedPrecision && !IsSame<Real,Demote<Real>>::value;
+    SparseMatrix<Demote<Real>> JLow;
+    ldl::Front<Demote<Real>> JFrontLow;
     Matrix<Real> d, 
                  w,
                  rc,    rb,    rmu, 
@@ -889,6 +893,7 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
+    GondzioTemps<Matrix<Real>> gondzioTemps;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -975,17 +980,16 @@ void Mehrotra
         {
             // Form the KKT system
             // -------------------
+            JOrig = JStatic;
+            JOrig.FreezeSparsity();
             if( ctrl.system == FULL_KKT )
             {
-                KKT
-                ( Q, A, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm, x, z,
-                  JOrig, false );
+                FinishKKT( m, n, x, z, JOrig );
                 KKTRHS( rc, rb, rmu, z, d );
             }
             else
             {
-                AugmentedKKT
-                ( Q, A, ctrl.reg0Perm, ctrl.reg1Perm, x, z, JOrig, false );
+                FinishAugmentedKKT( x, z, JOrig );
                 // TODO: Incorporate ctrl.reg2Perm?
                 AugmentedKKTRHS( x, rc, rb, rmu, d );
             }
@@ -1012,10 +1016,22 @@ void Mehrotra
                     NestedDissection( J.LockedGraph(), map, rootSep, info );
                     InvertMap( map, invMap );
                 }
-                JFront.Pull( J, map, info );
-
-                LDL( info, JFront, LDL_2D );
-                if( ctrl.resolveReg )
+                if( mixedPrecision )
+                {
+                    Copy( J, JLow );
+                    JFrontLow.Pull( JLow, map, info );
+                    LDL( info, JFrontLow, LDL_2D );
+                }
+                else
+                {
+                    JFront.Pull( J, map, info );
+                    LDL( info, JFront, LDL_2D );
+                }
+                if( mixedPrecision )
+                    reg_ldl::MixedSolveAfter
+                    ( JOrig, regTmp, dInner, invMap, info, JFrontLow, d,
+                      ctrl.solveCtrl );
+                else if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, 
                       ctrl.solveCtrl );
@@ -1089,7 +1105,8 @@ void Mehrotra
         const Real muAff = Dot(dx,dz) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
 
@@ -1108,16 +1125,20 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
+        auto solveCombined = [&]()
         {
-            // Form the new KKT RHS
-            // --------------------
-            KKTRHS( rc, rb, rmu, z, d );
-            // Solve for the direction
-            // -----------------------
-            try
+            if( ctrl.system == FULL_KKT )
             {
-                if( ctrl.resolveReg )
+                // Form the new KKT RHS
+                // --------------------
+                KKTRHS( rc, rb, rmu, z, d );
+                // Solve for the direction
+                // -----------------------
+                if( mixedPrecision )
+                    reg_ldl::MixedSolveAfter
+                    ( JOrig, regTmp, dInner, invMap, info, JFrontLow, d,
+                      ctrl.solveCtrl );
+                else if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
                       ctrl.solveCtrl );
@@ -1126,51 +1147,50 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                ExpandSolution( m, n, d, dx, dy, dz );
             }
-            catch(...)
+            else if( ctrl.system == AUGMENTED_KKT )
             {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Form the new KKT RHS
-            // --------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-            // Solve for the direction
-            // -----------------------
-            try
-            {
-                if( ctrl.resolveReg )
+                // Form the new KKT RHS
+                // --------------------
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
+                // Solve for the direction
+                // -----------------------
+                if( mixedPrecision )
+                    reg_ldl::MixedSolveAfter
+                    ( JOrig, regTmp, dInner, invMap, info, JFrontLow, d,
+                      ctrl.solveCtrl );
+                else if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
-                      ctrl.solveCtrl ); 
+                      ctrl.solveCtrl );
                 else
                     reg_ldl::RegularizedSolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
-
+                ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
             }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+            else
+                LogicError("Invalid KKT system choice");
+        };
+        try { solveCombined(); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        else
-            LogicError("Invalid KKT system choice");
         // TODO: Residual checks
 
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, x, z, sigma, mu, rmu, dx, dy, dz, dx, gondzioTemps,
+          solveCombined, ctrl.print );
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -1216,12 +1236,6 @@ void Mehrotra
 {
     DEBUG_CSE
 
-    const bool stepLengthSigma = true;
-    function<Real(Real,Real,Real,Real)> centralityRule;
-    if( stepLengthSigma )
-        centralityRule = StepLengthCentrality<Real>;
-    else
-        centralityRule = MehrotraCentrality<Real>;
     const bool standardShift = true;
 
     mpi::Comm comm = APre.Comm();
@@ -1293,7 +1307,7 @@ void Mehrotra
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
-    // TODO: Add permanent regularization and cache J metadata
+    // TODO: Add permanent regularization
     if( commRank == 0 && ctrl.time )
         timer.Start();
     if( ctrl.system == AUGMENTED_KKT )
@@ -1344,9 +1358,24 @@ void Mehrotra
     }
     regTmp *= origTwoNormEst;
 
-    DistGraphMultMeta metaOrig, meta;
+    // Form the portion of the KKT system which does not depend upon x and z
+    DistSparseMatrix<Real> JStatic(comm);
+    if( ctrl.system == FULL_KKT )
+        StaticKKT
+        ( Q, A, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm, JStatic, false );
+    else if( ctrl.system == AUGMENTED_KKT )
+        StaticAugmentedKKT
+        ( Q, A, ctrl.reg0Perm, ctrl.reg1Perm, JStatic, false );
+    if( ctrl.system == FULL_KKT || ctrl.system == AUGMENTED_KKT )
+        JStatic.InitializeMultMeta();
+
+    DistGraphMultMeta meta;
     DistSparseMatrix<Real> J(comm), JOrig(comm);
     ldl::DistFront<Real> JFront;
+    const bool mixedPrecision =
+      ctrl.mixedPrecision && !IsSame<Real,Demote<Real>>::value;
+    DistSparseMatrix<Demote<Real>> JLow(comm);
+    ldl::DistFront<Demote<Real>> JFrontLow;
     DistMultiVec<Real> d(comm), 
                        w(comm),
                        rc(comm),    rb(comm),    rmu(comm), 
@@ -1357,6 +1386,7 @@ void Mehrotra
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm), prod(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+    GondzioTemps<DistMultiVec<Real>> gondzioTemps(comm);
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1442,17 +1472,18 @@ void Mehrotra
         {
             // Form the KKT system
             // -------------------
+            JOrig = JStatic;
+            JOrig.FreezeSparsity();
+            JOrig.LockedDistGraph().multMeta =
+              JStatic.LockedDistGraph().multMeta;
             if( ctrl.system == FULL_KKT )
             {
-                KKT
-                ( Q, A, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm, x, z,
-                  JOrig, false );
+                FinishKKT( m, n, x, z, JOrig );
                 KKTRHS( rc, rb, rmu, z, d );
             }
             else
             {
-                AugmentedKKT
-                ( Q, A, ctrl.reg0Perm, ctrl.reg1Perm, x, z, JOrig, false );
+                FinishAugmentedKKT( x, z, JOrig );
                 AugmentedKKTRHS( x, rc, rb, rmu, d );
             }
 
@@ -1460,11 +1491,6 @@ void Mehrotra
             // -----------------------
             try
             {
-                // Cache the metadata for the finalized JOrig
-                if( numIts == 0 )
-                    metaOrig = JOrig.InitializeMultMeta();
-                else
-                    JOrig.LockedDistGraph().multMeta = metaOrig;
                 J = JOrig;
 
                 UpdateDiagonal( J, Real(1), regTmp );
@@ -1506,19 +1532,34 @@ void Mehrotra
                 if( commRank == 0 && ctrl.time )
                     Output("Equilibration: ",timer.Stop()," secs");
 
-                JFront.Pull
-                ( J, map, rootSep, info, 
-                  mappedSources, mappedTargets, colOffs );
+                if( mixedPrecision )
+                {
+                    Copy( J, JLow );
+                    JFrontLow.Pull
+                    ( JLow, map, rootSep, info,
+                      mappedSources, mappedTargets, colOffs );
+                }
+                else
+                    JFront.Pull
+                    ( J, map, rootSep, info, 
+                      mappedSources, mappedTargets, colOffs );
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                LDL( info, JFront, LDL_2D );
+                if( mixedPrecision )
+                    LDL( info, JFrontLow, LDL_2D );
+                else
+                    LDL( info, JFront, LDL_2D );
                 if( commRank == 0 && ctrl.time )
                     Output("LDL: ",timer.Stop()," secs");
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                if( ctrl.resolveReg )
+                if( mixedPrecision )
+                    reg_ldl::MixedSolveAfter
+                    ( JOrig, regTmp, dInner, invMap, info, JFrontLow, d,
+                      dmvMeta, ctrl.solveCtrl );
+                else if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl );
@@ -1595,7 +1636,8 @@ void Mehrotra
         const Real muAff = Dot(dx,dz) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
-        const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
+        const Real sigma =
+          ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
 
@@ -1614,18 +1656,22 @@ void Mehrotra
             rmu += dz;
         }
 
-        if( ctrl.system == FULL_KKT )
+        auto solveCombined = [&]()
         {
-            // Form the KKT system
-            // -------------------
-            KKTRHS( rc, rb, rmu, z, d );
-            // Solve for the direction
-            // -----------------------
-            try
+            if( ctrl.system == FULL_KKT )
             {
+                // Form the KKT system
+                // -------------------
+                KKTRHS( rc, rb, rmu, z, d );
+                // Solve for the direction
+                // -----------------------
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                if( ctrl.resolveReg )
+                if( mixedPrecision )
+                    reg_ldl::MixedSolveAfter
+                    ( JOrig, regTmp, dInner, invMap, info, JFrontLow, d,
+                      dmvMeta, ctrl.solveCtrl );
+                else if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl );
@@ -1636,29 +1682,22 @@ void Mehrotra
                       ctrl.solveCtrl.progress );
                 if( commRank == 0 && ctrl.time )
                     Output("Corrector: ",timer.Stop()," secs");
+                ExpandSolution( m, n, d, dx, dy, dz );
             }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandSolution( m, n, d, dx, dy, dz );
-        }
-        else if( ctrl.system == AUGMENTED_KKT )
-        {
-            // Form the KKT system
-            // -------------------
-            AugmentedKKTRHS( x, rc, rb, rmu, d );
-            // Solve for the direction
-            // -----------------------
-            try
+            else if( ctrl.system == AUGMENTED_KKT )
             {
+                // Form the KKT system
+                // -------------------
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
+                // Solve for the direction
+                // -----------------------
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                if( ctrl.resolveReg )
+                if( mixedPrecision )
+                    reg_ldl::MixedSolveAfter
+                    ( JOrig, regTmp, dInner, invMap, info, JFrontLow, d,
+                      dmvMeta, ctrl.solveCtrl );
+                else if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl );
@@ -1669,21 +1708,28 @@ void Mehrotra
                       ctrl.solveCtrl.progress );
                 if( commRank == 0 && ctrl.time )
                     Output("Corrector: ",timer.Stop()," secs");
+                ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
             }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
-            }
-            ExpandAugmentedSolution( x, z, rmu, d, dx, dy, dz );
+            else
+                LogicError("Invalid KKT system choice");
+        };
+        try { solveCombined(); }
+        catch(...)
+        {
+            if( relError <= ctrl.minTol )
+                break;
+            else
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
-        else
-            LogicError("Invalid KKT system choice");
         // TODO: Residual checks
 
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        GondzioCorrectors
+        ( ctrl, x, z, sigma, mu, rmu, dx, dy, dz, dx, gondzioTemps,
+          solveCombined, ctrl.print && commRank == 0 );
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -108,6 +108,36 @@ void KKT
   const DistMultiVec<Real>& z,
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
+template<typename Real>
+void StaticKKT
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+        SparseMatrix<Real>& J,
+  bool onlyLower );
+template<typename Real>
+void FinishKKT
+( Int m, Int n,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J );
+template<typename Real>
+void StaticKKT
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower );
+template<typename Real>
+void FinishKKT
+( Int m, Int n,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J );
 
 template<typename Real>
 void KKTRHS
@@ -191,6 +221,32 @@ void AugmentedKKT
   const DistMultiVec<Real>& z,
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
+template<typename Real>
+void StaticAugmentedKKT
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        SparseMatrix<Real>& J,
+  bool onlyLower );
+template<typename Real>
+void FinishAugmentedKKT
+( const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J );
+template<typename Real>
+void StaticAugmentedKKT
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower );
+template<typename Real>
+void FinishAugmentedKKT
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J );
 
 template<typename Real>
 void AugmentedKKTRHS
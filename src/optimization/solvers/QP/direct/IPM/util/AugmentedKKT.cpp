@@ -81,14 +81,16 @@ void AugmentedKKT
         Transpose( A, Jxy );
 }
 
+// As with the full KKT system, the sparse augmented systems are split into a
+// static portion with the final sparsity pattern and the x <> z diagonal
+// block, which is updated in place each iteration.
+
 template<typename Real>
-void AugmentedKKT
+void StaticAugmentedKKT
 ( const SparseMatrix<Real>& Q,
   const SparseMatrix<Real>& A, 
         Real gamma,
         Real delta,
-  const Matrix<Real>& x,
-  const Matrix<Real>& z,
         SparseMatrix<Real>& J, bool onlyLower )
 {
     DEBUG_CSE
@@ -102,9 +104,10 @@ void AugmentedKKT
     if( onlyLower )
     {
         numUsedEntriesQ = 0;
-        for( Int e=0; e<numEntriesQ; ++e )
-            if( Q.Row(e) >= Q.Col(e) )
-                ++numUsedEntriesQ;
+        for( Int i=0; i<n; ++i )
+            for( Int e=Q.RowOffset(i); e<Q.RowOffset(i+1); ++e )
+                if( i >= Q.Col(e) )
+                    ++numUsedEntriesQ;
     }
     else
         numUsedEntriesQ = numEntriesQ;
@@ -115,27 +118,30 @@ void AugmentedKKT
     else
         J.Reserve( 2*numEntriesA + numUsedEntriesQ + n+m ); 
 
-    // x o inv(z) + gamma^2*I updates
+    // gamma^2*I updates
     for( Int j=0; j<n; ++j )
-        J.QueueUpdate( j, j, z(j)/x(j)+gamma*gamma );
+        J.QueueUpdate( j, j, gamma*gamma );
 
-    // Q update
-    for( Int e=0; e<numEntriesQ; ++e )
+    // Q update (traversed by row so that compressed storage suffices)
+    for( Int i=0; i<n; ++i )
     {
-        const Int i = Q.Row(e);
-        const Int j = Q.Col(e);
-        if( i >= j )
-            J.QueueUpdate( i, j, Q.Value(e) );
-        else if( !onlyLower )
-            J.QueueUpdate( i, j, Q.Value(e) );
+        for( Int e=Q.RowOffset(i); e<Q.RowOffset(i+1); ++e )
+        {
+            const Int j = Q.Col(e);
+            if( i >= j || !onlyLower )
+                J.QueueUpdate( i, j, Q.Value(e) );
+        }
     }
 
     // A and A^T updates
-    for( Int e=0; e<numEntriesA; ++e )
+    for( Int i=0; i<m; ++i )
     {
-        J.QueueUpdate( A.Row(e)+n, A.Col(e), A.Value(e) );
-        if( !onlyLower )
-            J.QueueUpdate( A.Col(e), A.Row(e)+n, A.Value(e) );
+        for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+        {
+            J.QueueUpdate( i+n, A.Col(e), A.Value(e) );
+            if( !onlyLower )
+                J.QueueUpdate( A.Col(e), i+n, A.Value(e) );
+        }
     }
 
     // -delta^2*I 
@@ -146,14 +152,44 @@ void AugmentedKKT
     J.FreezeSparsity();
 }
 
+template<typename Real>
+void FinishAugmentedKKT
+( const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J )
+{
+    DEBUG_CSE
+    const Int n = x.Height();
+
+    // x o inv(z) updates
+    if( !J.FrozenSparsity() )
+        J.Reserve( J.NumEntries()+n );
+    for( Int j=0; j<n; ++j )
+        J.QueueUpdate( j, j, z(j)/x(j) );
+    J.ProcessQueues();
+}
+
 template<typename Real>
 void AugmentedKKT
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J, bool onlyLower )
+{
+    DEBUG_CSE
+    StaticAugmentedKKT( Q, A, gamma, delta, J, onlyLower );
+    FinishAugmentedKKT( x, z, J );
+}
+
+template<typename Real>
+void StaticAugmentedKKT
 ( const DistSparseMatrix<Real>& Q,
   const DistSparseMatrix<Real>& A,
         Real gamma,
         Real delta,
-  const DistMultiVec<Real>& x,
-  const DistMultiVec<Real>& z,
         DistSparseMatrix<Real>& J, bool onlyLower )
 {
     DEBUG_CSE
@@ -161,8 +197,6 @@ void AugmentedKKT
     const Int n = A.Width();
     const Int numEntriesQ = Q.NumLocalEntries();
     const Int numEntriesA = A.NumLocalEntries();
-    auto& xLoc = x.LockedMatrix();
-    auto& zLoc = z.LockedMatrix();
 
     J.SetComm( A.Comm() );
     Zeros( J, m+n, m+n );
@@ -174,7 +208,6 @@ void AugmentedKKT
     numEntries += numEntriesA;
     if( !onlyLower ) 
         numEntries += numEntriesA;
-    numEntries += x.LocalHeight(); 
     for( Int e=0; e<numEntriesQ; ++e )
     {
         const Int i = Q.Row(e);
@@ -182,16 +215,10 @@ void AugmentedKKT
         if( i >= j || !onlyLower )
             ++numEntries;
     }
-    for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
-    {
-        const Int i = J.GlobalRow(iLoc);
-        if( i > n )
-            ++numEntries;
-    }
 
     // Queue the entries
     // =================
-    J.Reserve( numEntries, numEntries );
+    J.Reserve( numEntries+JLocalHeight, numEntries );
     // Pack A
     // ------
     for( Int e=0; e<numEntriesA; ++e )
@@ -202,14 +229,6 @@ void AugmentedKKT
         if( !onlyLower )
             J.QueueUpdate( j, i, A.Value(e) );
     }
-    // Pack x o inv(z) + gamma^2*I
-    // ---------------------------
-    for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
-    {
-        const Int i = x.GlobalRow(iLoc);
-        const Real value = zLoc(iLoc)/xLoc(iLoc)+gamma*gamma;
-        J.QueueUpdate( i, i, value );
-    }
     // Pack Q
     // ------
     for( Int e=0; e<numEntriesQ; ++e )
@@ -219,19 +238,59 @@ void AugmentedKKT
         if( i >= j || !onlyLower )
             J.QueueUpdate( i, j, Q.Value(e) );
     }
-    // Pack -delta^2*I
-    // ---------------
+    // Pack gamma^2*I and -delta^2*I
+    // -----------------------------
     for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
     {
         const Int i = J.GlobalRow(iLoc);
-        if( i > n )
-            J.QueueUpdate( i, i, -delta*delta );
+        if( i < n )
+            J.QueueLocalUpdate( iLoc, i, gamma*gamma );
+        else
+            J.QueueLocalUpdate( iLoc, i, -delta*delta );
     }
 
     J.ProcessQueues();
     J.FreezeSparsity();
 }
 
+template<typename Real>
+void FinishAugmentedKKT
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J )
+{
+    DEBUG_CSE
+    auto& xLoc = x.LockedMatrix();
+    auto& zLoc = z.LockedMatrix();
+
+    // Pack x o inv(z)
+    // ---------------
+    const Int numEntries = x.LocalHeight();
+    if( !J.FrozenSparsity() )
+        J.Reserve( numEntries, numEntries );
+    for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
+    {
+        const Int i = x.GlobalRow(iLoc);
+        J.QueueUpdate( i, i, zLoc(iLoc)/xLoc(iLoc) );
+    }
+    J.ProcessQueues();
+}
+
+template<typename Real>
+void AugmentedKKT
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J, bool onlyLower )
+{
+    DEBUG_CSE
+    StaticAugmentedKKT( Q, A, gamma, delta, J, onlyLower );
+    FinishAugmentedKKT( x, z, J );
+}
+
 template<typename Real>
 void AugmentedKKTRHS
 ( const Matrix<Real>& x, 
@@ -481,6 +540,26 @@ void ExpandAugmentedSolution
     const DistMultiVec<Real>& z, \
           DistSparseMatrix<Real>& J, \
     bool onlyLower ); \
+  template void StaticAugmentedKKT \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          SparseMatrix<Real>& J, bool onlyLower ); \
+  template void StaticAugmentedKKT \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void FinishAugmentedKKT \
+  ( const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          SparseMatrix<Real>& J ); \
+  template void FinishAugmentedKKT \
+  ( const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J ); \
   template void AugmentedKKTRHS \
   ( const Matrix<Real>& x, \
     const Matrix<Real>& rc, \
@@ -137,15 +137,17 @@ void KKT
     }
 }
 
+// The sparse KKT systems are split into a static portion, which is formed
+// once and has the final sparsity pattern, and the -z <> x diagonal block,
+// which is updated in place (on a copy with frozen sparsity) each iteration.
+
 template<typename Real>
-void KKT
+void StaticKKT
 ( const SparseMatrix<Real>& Q,
   const SparseMatrix<Real>& A, 
         Real gamma,
         Real delta,
         Real beta,
-  const Matrix<Real>& x,
-  const Matrix<Real>& z,
         SparseMatrix<Real>& J, bool onlyLower )
 {
     DEBUG_CSE
@@ -160,9 +162,10 @@ void KKT
     if( onlyLower )
     {
         numUsedEntriesQ = 0;
-        for( Int e=0; e<numEntriesQ; ++e )
-            if( Q.Row(e) >= Q.Col(e) )
-                ++numUsedEntriesQ;
+        for( Int i=0; i<n; ++i )
+            for( Int e=Q.RowOffset(i); e<Q.RowOffset(i+1); ++e )
+                if( i >= Q.Col(e) )
+                    ++numUsedEntriesQ;
     }
     else
         numUsedEntriesQ = numEntriesQ;
@@ -174,20 +177,25 @@ void KKT
 
     // Jxx = Q + gamma^2*I
     // ===================
-    for( Int e=0; e<numEntriesQ; ++e )
+    // (Q and A are traversed by row so that their row indices, which are not
+    // stored in compressed storage, are never needed)
+    for( Int i=0; i<n; ++i )
     {
-        const Int i = Q.Row(e);
-        const Int j = Q.Col(e);
-        if( i >= j || !onlyLower )
-            J.QueueUpdate( Q.Row(e), Q.Col(e), Q.Value(e) );
+        for( Int e=Q.RowOffset(i); e<Q.RowOffset(i+1); ++e )
+        {
+            const Int j = Q.Col(e);
+            if( i >= j || !onlyLower )
+                J.QueueUpdate( i, j, Q.Value(e) );
+        }
     }
     for( Int i=0; i<n; ++i )
         J.QueueUpdate( i, i, gamma*gamma );
 
     // Jyx = A
     // =======
-    for( Int e=0; e<numEntriesA; ++e )
-        J.QueueUpdate( n+A.Row(e), A.Col(e), A.Value(e) );
+    for( Int i=0; i<m; ++i )
+        for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+            J.QueueUpdate( n+i, A.Col(e), A.Value(e) );
 
     // Jyy = -delta^2*I
     // ================
@@ -199,17 +207,18 @@ void KKT
     for( Int i=0; i<n; ++i )
         J.QueueUpdate( n+m+i, i, Real(-1) );
 
-    // Jzz = - z <> x - beta^2*I
-    // =========================
+    // Jzz = -beta^2*I
+    // ===============
     for( Int i=0; i<n; ++i )
-        J.QueueUpdate( n+m+i, n+m+i, -x.Get(i,0)/z.Get(i,0)-beta*beta );
+        J.QueueUpdate( n+m+i, n+m+i, -beta*beta );
 
     if( !onlyLower )
     {
         // Jxy := A^T
         // ==========
-        for( Int e=0; e<numEntriesA; ++e )
-            J.QueueUpdate( A.Col(e), n+A.Row(e), A.Value(e) );
+        for( Int i=0; i<m; ++i )
+            for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+                J.QueueUpdate( A.Col(e), n+i, A.Value(e) );
 
         // Jxz := -I
         // =========
@@ -220,15 +229,46 @@ void KKT
     J.FreezeSparsity();
 }
 
+template<typename Real>
+void FinishKKT
+( Int m, Int n,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J )
+{
+    DEBUG_CSE
+    // Jzz -= z <> x
+    // =============
+    if( !J.FrozenSparsity() )
+        J.Reserve( J.NumEntries()+n );
+    for( Int i=0; i<n; ++i )
+        J.QueueUpdate( n+m+i, n+m+i, -x(i)/z(i) );
+    J.ProcessQueues();
+}
+
 template<typename Real>
 void KKT
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J, bool onlyLower )
+{
+    DEBUG_CSE
+    StaticKKT( Q, A, gamma, delta, beta, J, onlyLower );
+    FinishKKT( A.Height(), A.Width(), x, z, J );
+}
+
+template<typename Real>
+void StaticKKT
 ( const DistSparseMatrix<Real>& Q,
   const DistSparseMatrix<Real>& A, 
         Real gamma,
         Real delta,
         Real beta,
-  const DistMultiVec<Real>& x,
-  const DistMultiVec<Real>& z,
         DistSparseMatrix<Real>& J, bool onlyLower )
 {
     DEBUG_CSE
@@ -239,7 +279,6 @@ void KKT
     J.SetComm( A.Comm() );
     Zeros( J, m+2*n, m+2*n );
 
-    const Int xLocalHeight = x.LocalHeight();
     const Int JLocalHeight = J.LocalHeight();
 
     // Count the number of entries to send
@@ -255,10 +294,8 @@ void KKT
     numEntries += numEntriesA;
     if( !onlyLower )
         numEntries += numEntriesA;
-    numEntries += xLocalHeight;
     // Count the number of analytical updates
     // --------------------------------------
-    // NOTE: -beta^2*I is merged in with -inv(z) o s
     Int analyticUpdates = 0;
     for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
     {
@@ -274,7 +311,7 @@ void KKT
             ++analyticUpdates; // for -delta^2*I
         }
         else
-            ++analyticUpdates; // for -I
+            analyticUpdates += 2; // for -I and -beta^2*I
     }
 
     // Pack and process the updates
@@ -294,7 +331,10 @@ void KKT
         else if( i < n+m )
             J.QueueUpdate( i, i, -delta*delta );
         else
+        {
             J.QueueUpdate( i, i-(n+m), Real(-1) );
+            J.QueueUpdate( i, i, -beta*beta );
+        }
     }
     // Pack Q
     // ------
@@ -315,16 +355,48 @@ void KKT
         if( !onlyLower ) 
             J.QueueUpdate( j, i, A.Value(e) );
     }
-    // Pack -inv(z) o x - beta^2*I
-    // ---------------------------
-    for( Int iLoc=0; iLoc<xLocalHeight; ++iLoc )
+    J.ProcessQueues();
+    J.FreezeSparsity();
+}
+
+template<typename Real>
+void FinishKKT
+( Int m, Int n,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J )
+{
+    DEBUG_CSE
+    auto& xLoc = x.LockedMatrix();
+    auto& zLoc = z.LockedMatrix();
+
+    // Pack -z <> x
+    // ------------
+    const Int numEntries = x.LocalHeight();
+    if( !J.FrozenSparsity() )
+        J.Reserve( numEntries, numEntries );
+    for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
     {
-        const Int i = m+n + x.GlobalRow(iLoc);
-        const Real value = -x.GetLocal(iLoc,0)/z.GetLocal(iLoc,0)-beta*beta;
-        J.QueueUpdate( i+(n+m), i+(n+m), value );
+        const Int i = n+m + x.GlobalRow(iLoc);
+        J.QueueUpdate( i, i, -xLoc(iLoc)/zLoc(iLoc) );
     }
     J.ProcessQueues();
-    J.FreezeSparsity();
+}
+
+template<typename Real>
+void KKT
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+        Real beta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J, bool onlyLower )
+{
+    DEBUG_CSE
+    StaticKKT( Q, A, gamma, delta, beta, J, onlyLower );
+    FinishKKT( A.Height(), A.Width(), x, z, J );
 }
 
 template<typename Real>
@@ -488,6 +560,30 @@ void ExpandSolution
     const DistMultiVec<Real>& x, \
     const DistMultiVec<Real>& z, \
           DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void StaticKKT \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          Real beta, \
+          SparseMatrix<Real>& J, bool onlyLower ); \
+  template void StaticKKT \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+          Real beta, \
+          DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void FinishKKT \
+  ( Int m, Int n, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          SparseMatrix<Real>& J ); \
+  template void FinishKKT \
+  ( Int m, Int n, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J ); \
   template void KKTRHS \
   ( const Matrix<Real>& rc, \
     const Matrix<Real>& rb, \
@@ -402,15 +402,16 @@ void KKT
         // Queue the nonzeros
         // ------------------
         J.Reserve( numEntries );
-        for( Int e=0; e<A.NumEntries(); ++e )
-            J.QueueUpdate( n+A.Row(e), A.Col(e), A.Value(e) );
-        for( Int e=0; e<G.NumEntries(); ++e )
+        for( Int i=0; i<m; ++i )
+            for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+                J.QueueUpdate( n+i, A.Col(e), A.Value(e) );
+        for( Int i=0; i<k; ++i )
         {
-            const Int i = G.Row(e);
             const Int firstInd = firstInds(i);
             const Int sparseFirstInd = origToSparseFirstInds(i);
             const Int iSparse = i + (sparseFirstInd-firstInd);
-            J.QueueUpdate( n+m+iSparse, G.Col(e), G.Value(e) );
+            for( Int e=G.RowOffset(i); e<G.RowOffset(i+1); ++e )
+                J.QueueUpdate( n+m+iSparse, G.Col(e), G.Value(e) );
         }
         for( Int i=0; i<k; ++i )
         {
@@ -514,19 +515,24 @@ void KKT
         // Queue the nonzeros
         // ------------------
         J.Reserve( numEntries );
-        for( Int e=0; e<A.NumEntries(); ++e )
+        for( Int i=0; i<m; ++i )
         {
-            J.QueueUpdate( A.Row(e)+n, A.Col(e),   A.Value(e) );
-            J.QueueUpdate( A.Col(e),   A.Row(e)+n, A.Value(e) );
+            for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+            {
+                J.QueueUpdate( n+i, A.Col(e), A.Value(e) );
+                J.QueueUpdate( A.Col(e), n+i, A.Value(e) );
+            }
         }
-        for( Int e=0; e<G.NumEntries(); ++e )
+        for( Int i=0; i<k; ++i )
         {
-            const Int i = G.Row(e);
             const Int firstInd = firstInds(i);
             const Int sparseFirstInd = origToSparseFirstInds(i);
             const Int iSparse = i + (sparseFirstInd-firstInd);
-            J.QueueUpdate( n+m+iSparse, G.Col(e),    G.Value(e) );
-            J.QueueUpdate( G.Col(e),    n+m+iSparse, G.Value(e) );
+            for( Int e=G.RowOffset(i); e<G.RowOffset(i+1); ++e )
+            {
+                J.QueueUpdate( n+m+iSparse, G.Col(e),    G.Value(e) );
+                J.QueueUpdate( G.Col(e),    n+m+iSparse, G.Value(e) );
+            }
         }
         for( Int i=0; i<k; ++i )
         {
@@ -665,17 +671,18 @@ void StaticKKT
         J.Reserve( numEntries );
         for( Int i=0; i<n; ++i )
             J.QueueUpdate( i, i, gamma*gamma );
-        for( Int e=0; e<numEntriesA; ++e )
-            J.QueueUpdate( n+A.Row(e), A.Col(e), A.Value(e) );
+        for( Int i=0; i<m; ++i )
+            for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+                J.QueueUpdate( n+i, A.Col(e), A.Value(e) );
         for( Int i=0; i<m; ++i )
             J.QueueUpdate( i+n, i+n, -delta*delta );
-        for( Int e=0; e<numEntriesG; ++e )
+        for( Int i=0; i<k; ++i )
         {
-            const Int i = G.Row(e);
             const Int firstInd = firstInds(i);
             const Int sparseFirstInd = origToSparseFirstInds(i);
             const Int iSparse = i + (sparseFirstInd-firstInd);
-            J.QueueUpdate( n+m+iSparse, G.Col(e), G.Value(e) );
+            for( Int e=G.RowOffset(i); e<G.RowOffset(i+1); ++e )
+                J.QueueUpdate( n+m+iSparse, G.Col(e), G.Value(e) );
         }
         for( Int i=0; i<k; ++i )
         {
@@ -746,21 +753,26 @@ void StaticKKT
         J.Reserve( numEntries );
         for( Int i=0; i<n; ++i )
             J.QueueUpdate( i, i, gamma*gamma );
-        for( Int e=0; e<numEntriesA; ++e )
+        for( Int i=0; i<m; ++i )
         {
-            J.QueueUpdate( A.Row(e)+n, A.Col(e),   A.Value(e) );
-            J.QueueUpdate( A.Col(e),   A.Row(e)+n, A.Value(e) );
+            for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+            {
+                J.QueueUpdate( n+i, A.Col(e), A.Value(e) );
+                J.QueueUpdate( A.Col(e), n+i, A.Value(e) );
+            }
         }
         for( Int i=0; i<m; ++i )
             J.QueueUpdate( i+n, i+n, -delta*delta );
-        for( Int e=0; e<numEntriesG; ++e )
+        for( Int i=0; i<k; ++i )
         {
-            const Int i = G.Row(e);
             const Int firstInd = firstInds(i);
             const Int sparseFirstInd = origToSparseFirstInds(i);
             const Int iSparse = i + (sparseFirstInd-firstInd);
-            J.QueueUpdate( n+m+iSparse, G.Col(e),    G.Value(e) );
-            J.QueueUpdate( G.Col(e),    n+m+iSparse, G.Value(e) );
+            for( Int e=G.RowOffset(i); e<G.RowOffset(i+1); ++e )
+            {
+                J.QueueUpdate( n+m+iSparse, G.Col(e),    G.Value(e) );
+                J.QueueUpdate( G.Col(e),    n+m+iSparse, G.Value(e) );
+            }
         }
         for( Int i=0; i<k; ++i )
         {
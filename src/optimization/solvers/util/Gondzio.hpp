@@ -0,0 +1,116 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_SOLVERS_UTIL_GONDZIO_HPP
+#define EL_OPTIMIZATION_SOLVERS_UTIL_GONDZIO_HPP
+
+namespace El {
+
+// The temporaries of Gondzio's multiple centrality correctors, which are
+// constructed once per Interior Point Method rather than once per corrector
+template<class Vec>
+struct GondzioTemps
+{
+    Vec t, dxOld, dyOld, dzOld, dsOld;
+
+    GondzioTemps() { }
+    GondzioTemps( const Grid& grid )
+    : t(grid), dxOld(grid), dyOld(grid), dzOld(grid), dsOld(grid)
+    { }
+    GondzioTemps( mpi::Comm comm )
+    : t(comm), dxOld(comm), dyOld(comm), dzOld(comm), dsOld(comm)
+    { }
+};
+
+// Apply up to ctrl.maxGondzioCorrectors of Gondzio's multiple centrality
+// correctors to the combined direction (dx,dy,dz,ds), which 'solve' must
+// recompute from the current complementarity residual, rmu. Each corrector
+// subtracts a vector t from rmu which pushes the complementarity products of
+// a longer step back into the neighborhood of sigma*mu, and it is only kept
+// if the resulting step is sufficiently longer. The progress of each
+// corrector is reported when 'print' is true.
+//
+// For the "direct" conic form, x plays the role of s, and so s may alias x
+// and ds may alias dx.
+template<typename Real,class Vec,class SolveFunctor>
+void GondzioCorrectors
+( const MehrotraCtrl<Real>& ctrl,
+  const Vec& s,
+  const Vec& z,
+  Real sigma,
+  Real mu,
+        Vec& rmu,
+        Vec& dx,
+        Vec& dy,
+        Vec& dz,
+        Vec& ds,
+        GondzioTemps<Vec>& temps,
+        SolveFunctor solve,
+  bool print )
+{
+    DEBUG_CSE
+    const bool aliasedStep = (&ds == &dx);
+    for( Int corr=0; corr<ctrl.maxGondzioCorrectors; ++corr )
+    {
+        Real alphaPri = pos_orth::MaxStep( s, ds, Real(1) );
+        Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+        if( ctrl.forceSameStep )
+            alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        const Real alphaOld = Min(alphaPri,alphaDual);
+        if( alphaOld >= Real(1) )
+            break;
+
+        // r_mu -= t
+        // ---------
+        pos_orth::GondzioCorrection
+        ( s, ds, z, dz,
+          Min(alphaPri+ctrl.gondzioStepIncrease,Real(1)),
+          Min(alphaDual+ctrl.gondzioStepIncrease,Real(1)),
+          sigma*mu, ctrl.gondzioLowerRatio, ctrl.gondzioUpperRatio, temps.t );
+        rmu -= temps.t;
+        temps.dxOld = dx;
+        temps.dyOld = dy;
+        temps.dzOld = dz;
+        if( !aliasedStep )
+            temps.dsOld = ds;
+
+        // Keep the corrected direction only if it lengthens the step
+        // ----------------------------------------------------------
+        bool accept = false;
+        try
+        {
+            solve();
+            alphaPri = pos_orth::MaxStep( s, ds, Real(1) );
+            alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            const Real alphaNew = Min(alphaPri,alphaDual);
+            if( print )
+                Output
+                ("Gondzio corrector ",corr,": step ",alphaOld," -> ",
+                 alphaNew);
+            accept = alphaNew >= alphaOld +
+              ctrl.gondzioMinImprovement*ctrl.gondzioStepIncrease;
+        }
+        catch(...) { }
+        if( !accept )
+        {
+            rmu += temps.t;
+            dx = temps.dxOld;
+            dy = temps.dyOld;
+            dz = temps.dzOld;
+            if( !aliasedStep )
+                ds = temps.dsOld;
+            break;
+        }
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_SOLVERS_UTIL_GONDZIO_HPP
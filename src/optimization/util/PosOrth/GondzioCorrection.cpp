@@ -0,0 +1,178 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace pos_orth {
+
+namespace {
+
+template<typename Real>
+void GondzioCorrectionLocal
+( Int localHeight,
+  const Real* sBuf,
+  const Real* dsBuf,
+  const Real* zBuf,
+  const Real* dzBuf,
+  Real alphaPri,
+  Real alphaDual,
+  Real lower,
+  Real upper,
+        Real* tBuf )
+{
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real prod =
+          (sBuf[iLoc]+alphaPri*dsBuf[iLoc])*(zBuf[iLoc]+alphaDual*dzBuf[iLoc]);
+        if( prod < lower )
+            tBuf[iLoc] = lower - prod;
+        else if( prod > upper )
+            tBuf[iLoc] = Max(upper-prod,-upper);
+        else
+            tBuf[iLoc] = 0;
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real,typename>
+void GondzioCorrection
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real mu,
+  Real lowerRatio,
+  Real upperRatio,
+        Matrix<Real>& t )
+{
+    DEBUG_CSE
+    const Int height = s.Height();
+    t.Resize( height, 1 );
+    GondzioCorrectionLocal
+    ( height,
+      s.LockedBuffer(), ds.LockedBuffer(),
+      z.LockedBuffer(), dz.LockedBuffer(),
+      alphaPri, alphaDual, lowerRatio*mu, upperRatio*mu,
+      t.Buffer() );
+}
+
+template<typename Real,typename>
+void GondzioCorrection
+( const ElementalMatrix<Real>& sPre,
+  const ElementalMatrix<Real>& dsPre,
+  const ElementalMatrix<Real>& zPre,
+  const ElementalMatrix<Real>& dzPre,
+  Real alphaPri,
+  Real alphaDual,
+  Real mu,
+  Real lowerRatio,
+  Real upperRatio,
+        ElementalMatrix<Real>& tPre )
+{
+    DEBUG_CSE
+    AssertSameGrids( sPre, dsPre, zPre, dzPre, tPre );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      dsProx( dsPre, ctrl ),
+      zProx( zPre, ctrl ),
+      dzProx( dzPre, ctrl );
+    auto& s = sProx.GetLocked();
+    auto& ds = dsProx.GetLocked();
+    auto& z = zProx.GetLocked();
+    auto& dz = dzProx.GetLocked();
+
+    tPre.Resize( s.Height(), 1 );
+    DistMatrixWriteProxy<Real,Real,VC,STAR> tProx( tPre, ctrl );
+    auto& t = tProx.Get();
+
+    GondzioCorrectionLocal
+    ( s.LocalHeight(),
+      s.LockedBuffer(), ds.LockedBuffer(),
+      z.LockedBuffer(), dz.LockedBuffer(),
+      alphaPri, alphaDual, lowerRatio*mu, upperRatio*mu,
+      t.Buffer() );
+}
+
+template<typename Real,typename>
+void GondzioCorrection
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real mu,
+  Real lowerRatio,
+  Real upperRatio,
+        DistMultiVec<Real>& t )
+{
+    DEBUG_CSE
+    t.SetComm( s.Comm() );
+    t.Resize( s.Height(), 1 );
+    GondzioCorrectionLocal
+    ( s.LocalHeight(),
+      s.LockedMatrix().LockedBuffer(), ds.LockedMatrix().LockedBuffer(),
+      z.LockedMatrix().LockedBuffer(), dz.LockedMatrix().LockedBuffer(),
+      alphaPri, alphaDual, lowerRatio*mu, upperRatio*mu,
+      t.Matrix().Buffer() );
+}
+
+#define PROTO(Real) \
+  template void GondzioCorrection \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& ds, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& dz, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real mu, \
+    Real lowerRatio, \
+    Real upperRatio, \
+          Matrix<Real>& t ); \
+  template void GondzioCorrection \
+  ( const ElementalMatrix<Real>& s, \
+    const ElementalMatrix<Real>& ds, \
+    const ElementalMatrix<Real>& z, \
+    const ElementalMatrix<Real>& dz, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real mu, \
+    Real lowerRatio, \
+    Real upperRatio, \
+          ElementalMatrix<Real>& t ); \
+  template void GondzioCorrection \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& ds, \
+    const DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& dz, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real mu, \
+    Real lowerRatio, \
+    Real upperRatio, \
+          DistMultiVec<Real>& t );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace pos_orth
+} // namespace El
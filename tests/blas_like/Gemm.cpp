@@ -164,6 +164,26 @@ void TestGemm
             ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
         PopIndent();
     }
+
+    // Test the 2.5D variant, which splits the summation dimension over
+    // layers of the process grid
+    C = COrig;
+    OutputFromRoot(g.Comm(),"2.5D Algorithm with depth ",GemmDepth(),":");
+    PushIndent();
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_25D );
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
     PopIndent();
 }
 
@@ -183,8 +203,10 @@ main( int argc, char* argv[] )
         const Int n = Input("--n","width of result",100);
         const Int k = Input("--k","inner dimension",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int depth = Input("--depth","layers for 2.5D Gemm (0=auto)",0);
         const bool print = Input("--print","print matrices?",false);
         const bool correctness = Input("--correctness","correctness?",true);
+        const bool tune = Input("--tune","tune the algorithm first?",false);
         const Int colAlignA = Input("--colAlignA","column align of A",0);
         const Int colAlignB = Input("--colAlignB","column align of B",0);
         const Int colAlignC = Input("--colAlignC","column align of C",0);
@@ -201,8 +223,23 @@ main( int argc, char* argv[] )
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        SetGemmDepth( depth );
 
         ComplainIfDebug();
+        if( tune )
+        {
+            // Round-trip the tuning table through a file so that the tests
+            // below use the loaded choice
+            const GemmAlgorithm alg =
+              TuneGemm<double>( orientA, orientB, m, n, k, g );
+            OutputFromRoot(comm,"Tuned Gemm algorithm: ",alg);
+            const string filename = "GemmTuning.txt";
+            SaveTuning( filename, comm );
+            ClearTuning();
+            LoadTuning( filename, comm );
+            if( mpi::Rank(comm) == 0 )
+                std::remove( filename.c_str() );
+        }
         OutputFromRoot(comm,"Will test Gemm",transA,transB);
 
         TestGemm<float>
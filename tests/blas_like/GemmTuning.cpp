@@ -0,0 +1,118 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Write a tuning table which selects 'alg' for GemmNN with the given sizes
+// on grids with the shape of g
+template<typename T>
+void WriteTable
+( const string& filename, const Grid& g, Int m, Int n, Int k,
+  GemmAlgorithm alg )
+{
+    if( mpi::Rank(g.Comm()) != 0 )
+        return;
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    // The bucket of each dimension is the floor of its base-two logarithm
+    file << "# routine type gridHeight gridWidth numDims buckets param value\n"
+         << "GemmNN " << TypeName<T>() << " "
+         << g.Height() << " " << g.Width() << " 3 "
+         << Int(Log2(double(m))) << " " << Int(Log2(double(n))) << " "
+         << Int(Log2(double(k))) << " algorithm " << Int(alg) << "\n";
+}
+
+template<typename T>
+void TestTunedGemm( const Grid& g, Int m, Int n, Int k, bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    // Cannon's algorithm requires a square grid whose height divides k, so
+    // make sure that it does not apply
+    if( g.Height() == g.Width() && k % g.Height() == 0 )
+        ++k;
+    OutputFromRoot
+    (g.Comm(),"Loading a Cannon entry for m=",m,", n=",n,", k=",k,
+     " on a ",g.Height()," x ",g.Width()," grid");
+    const string filename = "GemmTuning.txt";
+    WriteTable<T>( filename, g, m, n, k, GEMM_CANNON );
+    mpi::Barrier( g.Comm() );
+    ClearTuning();
+    LoadTuning( filename, g.Comm() );
+    if( mpi::Rank(g.Comm()) == 0 )
+        std::remove( filename.c_str() );
+
+    Int tunedAlg;
+    if( !TuningParameter
+        ( "GemmNN", TypeName<T>(), g, {m,n,k}, "algorithm", tunedAlg ) ||
+        tunedAlg != Int(GEMM_CANNON) )
+        LogicError("The loaded entry was not found");
+    // Entries should not stand in for problems of a very different size
+    if( TuningParameter
+        ( "GemmNN", TypeName<T>(), g, {64*m,64*n,64*k}, "algorithm",
+          tunedAlg ) )
+        LogicError("A distant entry was used");
+
+    DistMatrix<T> A(g), B(g), C(g), CRef(g);
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    Uniform( CRef, m, n );
+    C = CRef;
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+    }
+
+    // The default must recognize that the tuned algorithm does not apply
+    Gemm( NORMAL, NORMAL, T(2), A, B, T(-1), C );
+    Gemm( NORMAL, NORMAL, T(2), A, B, T(-1), CRef, GEMM_SUMMA_C );
+    if( print )
+        Print( C, "C" );
+    const Base<T> CRefFrob = FrobeniusNorm( CRef );
+    CRef -= C;
+    const Base<T> errorFrob = FrobeniusNorm( CRef );
+    OutputFromRoot
+    (g.Comm(),"|| C - CRef ||_F / || CRef ||_F = ",errorFrob/CRefFrob);
+    if( errorFrob > 10*Max(m,Max(n,k))*limits::Epsilon<Base<T>>()*CRefFrob )
+        LogicError("The tuned Gemm disagreed with SUMMA");
+    ClearTuning();
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int m = Input("--m","height of result",100);
+        const Int n = Input("--n","width of result",100);
+        const Int k = Input("--k","inner dimension",100);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+
+        TestTunedGemm<float>( g, m, n, k, print );
+        TestTunedGemm<double>( g, m, n, k, print );
+        TestTunedGemm<Complex<double>>( g, m, n, k, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -28,11 +28,19 @@ void TestMultiply(Int m, Int n=1)
     auto nrm = FrobeniusNorm(D);
     std::cout << "error = " << nrm << std::endl;
     if( nrm > limits::Epsilon<T>()){ RuntimeError("Sparse(I)*x != Graph(I)*x"); }
+
+    Multiply(TRANSPOSE, T(1), A, B, T(0), C);
+    Multiply(TRANSPOSE, T(1), G, B, T(0), D);
+    Axpy(T(-1), C, D);
+    nrm = FrobeniusNorm(D);
+    std::cout << "transpose error = " << nrm << std::endl;
+    if( nrm > limits::Epsilon<T>()){ RuntimeError("Sparse(I)^T*x != Graph(I)^T*x"); }
 }
 
 void RunTests( Int m)
 {
   TestMultiply<double>( m);
+  TestMultiply<double>( m, 5);
   //List all the types here..
 }
 
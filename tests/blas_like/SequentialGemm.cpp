@@ -0,0 +1,170 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestAssociativity
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& B,
+  T beta,  const Matrix<T>& COrig,
+           const Matrix<T>& CFinal,
+  bool print )
+{
+    DEBUG_ONLY(CallStackEntry cse("TestAssociativity"))
+
+    // Test (alpha op(A) op(B) + beta C) X = alpha op(A) (op(B) X) + beta C X
+    const Int numRHS = 100;
+    const Int n = COrig.Width();
+    Matrix<T> X, Y, Z;
+    Uniform( X, n, numRHS );
+    Gemm( orientB, NORMAL, T(1), B, X, Z );
+    Gemm( orientA, NORMAL, alpha, A, Z, Y );
+    Gemm( NORMAL, NORMAL, beta, COrig, X, T(1), Y );
+    const Base<T> YFrobNorm = FrobeniusNorm( Y );
+    if( print )
+        Print( Y, "Y := alpha op(A) op(B) + beta C" );
+    Gemm( NORMAL, NORMAL, T(-1), CFinal, X, T(1), Y );
+    const Base<T> EFrobNorm = FrobeniusNorm( Y );
+    if( print )
+        Print( Y, "E" );
+    Output
+    ("|| E ||_F / || Y ||_F = ",
+     EFrobNorm, "/", YFrobNorm, "=", EFrobNorm/YFrobNorm);
+}
+
+template<typename T>
+void TestSequentialGemm
+( Orientation orientA,
+  Orientation orientB,
+  Int m,
+  Int n,
+  Int k,
+  T alpha,
+  T beta,
+  bool print,
+  bool correctness )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+
+    Matrix<T> A, B, COrig, C;
+    if( orientA == NORMAL )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( orientB == NORMAL )
+        Uniform( B, k, n );
+    else
+        Uniform( B, n, k );
+    Uniform( COrig, m, n );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+        Print( COrig, "COrig" );
+    }
+
+    Timer timer;
+    C = COrig;
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C );
+    const double runTime = timer.Stop();
+    const double realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    const double gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    Output("Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const char transA = Input("--transA","orientation of A: N/T/C",'N');
+        const char transB = Input("--transB","orientation of B: N/T/C",'N');
+        const Int m = Input("--m","height of result",200);
+        const Int n = Input("--n","width of result",200);
+        const Int k = Input("--k","inner dimension",200);
+        const bool print = Input("--print","print matrices?",false);
+        const bool correctness = Input("--correctness","correctness?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        const Orientation orientA = CharToOrientation( transA );
+        const Orientation orientB = CharToOrientation( transB );
+
+        ComplainIfDebug();
+        OutputFromRoot
+        (mpi::COMM_WORLD,"Will test sequential Gemm",transA,transB);
+        if( mpi::Rank() != 0 )
+            return 0;
+
+        TestSequentialGemm<float>
+        ( orientA, orientB, m, n, k, float(3), float(4),
+          print, correctness );
+        TestSequentialGemm<Complex<float>>
+        ( orientA, orientB, m, n, k, Complex<float>(3), Complex<float>(4),
+          print, correctness );
+
+        TestSequentialGemm<double>
+        ( orientA, orientB, m, n, k, double(3), double(4),
+          print, correctness );
+        TestSequentialGemm<Complex<double>>
+        ( orientA, orientB, m, n, k, Complex<double>(3), Complex<double>(4),
+          print, correctness );
+
+#ifdef EL_HAVE_QD
+        TestSequentialGemm<DoubleDouble>
+        ( orientA, orientB, m, n, k, DoubleDouble(3), DoubleDouble(4),
+          print, correctness );
+        TestSequentialGemm<QuadDouble>
+        ( orientA, orientB, m, n, k, QuadDouble(3), QuadDouble(4),
+          print, correctness );
+
+        TestSequentialGemm<Complex<DoubleDouble>>
+        ( orientA, orientB, m, n, k,
+          Complex<DoubleDouble>(3), Complex<DoubleDouble>(4),
+          print, correctness );
+        TestSequentialGemm<Complex<QuadDouble>>
+        ( orientA, orientB, m, n, k,
+          Complex<QuadDouble>(3), Complex<QuadDouble>(4),
+          print, correctness );
+#endif
+
+#ifdef EL_HAVE_QUAD
+        TestSequentialGemm<Quad>
+        ( orientA, orientB, m, n, k, Quad(3), Quad(4),
+          print, correctness );
+        TestSequentialGemm<Complex<Quad>>
+        ( orientA, orientB, m, n, k, Complex<Quad>(3), Complex<Quad>(4),
+          print, correctness );
+#endif
+
+#ifdef EL_HAVE_MPC
+        TestSequentialGemm<BigFloat>
+        ( orientA, orientB, m, n, k, BigFloat(3), BigFloat(4),
+          print, correctness );
+        TestSequentialGemm<Complex<BigFloat>>
+        ( orientA, orientB, m, n, k,
+          Complex<BigFloat>(3), Complex<BigFloat>(4),
+          print, correctness );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
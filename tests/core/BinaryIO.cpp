@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestBinaryIO
+( const Grid& grid, Int m, Int n, FileFormat format, const string basename )
+{
+    const string filename = basename + "." + FileExtension(format);
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot
+    (comm,"Testing ",grid.Height(),"x",grid.Width()," grid with ",
+     TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T> A(grid), B(grid);
+    Uniform( A, m, n );
+    const double gigaBytes = double(m)*double(n)*sizeof(T)/1.e9;
+
+    Timer timer;
+    mpi::Barrier( comm );
+    timer.Start();
+    Write( A, basename, format );
+    mpi::Barrier( comm );
+    const double writeTime = timer.Stop();
+    OutputFromRoot
+    (comm,"Write: ",writeTime," seconds (",gigaBytes/writeTime," GB/s)");
+
+    if( format == BINARY_FLAT )
+        B.Resize( m, n );
+    mpi::Barrier( comm );
+    timer.Start();
+    Read( B, filename, format );
+    mpi::Barrier( comm );
+    const double readTime = timer.Stop();
+    OutputFromRoot
+    (comm,"Read:  ",readTime," seconds (",gigaBytes/readTime," GB/s)");
+
+    B -= A;
+    const Base<T> errorNorm = FrobeniusNorm( B );
+    OutputFromRoot(comm,"|| A - Read(Write(A)) ||_F = ",errorNorm);
+    if( errorNorm != Base<T>(0) )
+        LogicError("Matrix was not recovered exactly");
+
+    if( grid.Size() == 1 )
+    {
+        timer.Start();
+        MappedMatrix<T> AMapped( filename, format, m, n );
+        const double mapTime = timer.Stop();
+        Output("Map:   ",mapTime," seconds");
+        Matrix<T> E( AMapped.LockedMatrix() );
+        E -= A.LockedMatrix();
+        const Base<T> mapErrorNorm = FrobeniusNorm( E );
+        Output("|| A - MapRead(Write(A)) ||_F = ",mapErrorNorm);
+        if( mapErrorNorm != Base<T>(0) )
+            LogicError("Mapped matrix was not recovered exactly");
+    }
+
+    if( mpi::Rank(comm) == 0 )
+        std::remove( filename.c_str() );
+    PopIndent();
+}
+
+int 
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",1000);
+        const Int n = Input("--width","width of matrix",1000);
+        const bool flat = Input("--flat","use BINARY_FLAT format?",false);
+        const string basename =
+          Input("--basename","basename of file",string("BinaryIO"));
+        ProcessInput();
+        PrintInputReport();
+
+        const FileFormat format = ( flat ? BINARY_FLAT : BINARY );
+
+        // A single process reading and writing the entire file
+        if( commRank == 0 )
+        {
+            const Grid selfGrid( mpi::COMM_SELF );
+            TestBinaryIO<double>( selfGrid, m, n, format, basename );
+        }
+        mpi::Barrier( comm );
+
+        // A p x 1 grid
+        const Grid colGrid( comm, commSize );
+        TestBinaryIO<double>( colGrid, m, n, format, basename );
+        TestBinaryIO<Complex<double>>( colGrid, m, n, format, basename );
+
+        // The default (roughly square) 2D grid
+        const Grid grid( comm );
+        TestBinaryIO<double>( grid, m, n, format, basename );
+        TestBinaryIO<Complex<double>>( grid, m, n, format, basename );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The Philox4x32-10 known-answer vectors distributed with Random123
+void TestKnownAnswers( mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing Philox4x32-10 known-answer vectors");
+    const Int numVectors = 3;
+    const PhiloxBits counters[numVectors] =
+    { {{0x00000000,0x00000000,0x00000000,0x00000000}},
+      {{0xffffffff,0xffffffff,0xffffffff,0xffffffff}},
+      {{0x243f6a88,0x85a308d3,0x13198a2e,0x03707344}} };
+    const PhiloxKey keys[numVectors] =
+    { {{0x00000000,0x00000000}},
+      {{0xffffffff,0xffffffff}},
+      {{0xa4093822,0x299f31d0}} };
+    const PhiloxBits answers[numVectors] =
+    { {{0x6627e8d5,0xe169c58d,0xbc57ac4c,0x9b00dbd8}},
+      {{0x408f276d,0x41c83b0e,0xa20bc7c6,0x6d5451fd}},
+      {{0xd16cfe09,0x94fdcceb,0x5001e420,0x24126ea1}} };
+    for( Int k=0; k<numVectors; ++k )
+    {
+        const PhiloxBits bits = Philox4x32( counters[k], keys[k] );
+        if( bits != answers[k] )
+            LogicError("Philox4x32-10 failed known-answer vector ",k);
+    }
+}
+
+// Counter-based generation should produce the same matrix for any grid shape
+template<typename F>
+void TestReproducibility( Int m, Int n, mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing with ",TypeName<F>());
+    PushIndent();
+
+    const Grid grid( comm );
+    const Grid colGrid( comm, mpi::Size(comm) );
+    DistMatrix<F> A(grid), B(colGrid), C(colGrid);
+
+    Timer timer;
+    SetCounterSeed( 17 );
+    mpi::Barrier( comm );
+    timer.Start();
+    Gaussian( A, m, n );
+    mpi::Barrier( comm );
+    const double genTime = timer.Stop();
+    OutputFromRoot
+    (comm,"Gaussian: ",genTime," seconds (",
+     double(m)*double(n)/(1.e6*genTime)," million samples/s)");
+
+    SetCounterSeed( 17 );
+    Gaussian( B, m, n );
+    C = A;
+    C -= B;
+    const Base<F> diffNorm = FrobeniusNorm( C );
+    OutputFromRoot(comm,"|| A_{2D} - A_{p x 1} ||_F = ",diffNorm);
+    if( diffNorm != Base<F>(0) )
+        LogicError("Gaussian samples depended upon the grid");
+
+    SetCounterSeed( 17 );
+    Uniform( A, m, n );
+    SetCounterSeed( 17 );
+    Uniform( B, m, n );
+    C = A;
+    C -= B;
+    const Base<F> uniformDiffNorm = FrobeniusNorm( C );
+    OutputFromRoot(comm,"|| U_{2D} - U_{p x 1} ||_F = ",uniformDiffNorm);
+    if( uniformDiffNorm != Base<F>(0) )
+        LogicError("Uniform samples depended upon the grid");
+
+    PopIndent();
+}
+
+int 
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",1000);
+        const Int n = Input("--width","width of matrix",1000);
+        ProcessInput();
+        PrintInputReport();
+
+        TestKnownAnswers( comm );
+        TestReproducibility<float>( m, n, comm );
+        TestReproducibility<Complex<float>>( m, n, comm );
+        TestReproducibility<double>( m, n, comm );
+        TestReproducibility<Complex<double>>( m, n, comm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,324 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+typedef pair<Int,Int> Edge;
+
+void CheckGraph( const Graph& graph, const std::set<Edge>& edges )
+{
+    if( !graph.Consistent() )
+        LogicError("Graph was not consistent");
+    if( graph.NumEdges() != Int(edges.size()) )
+        LogicError
+        ("Graph had ",graph.NumEdges()," edges rather than ",edges.size());
+    Int e = 0;
+    for( const auto& edge : edges )
+    {
+        if( graph.Source(e) != edge.first || graph.Target(e) != edge.second )
+            LogicError
+            ("Edge ",e," was (",graph.Source(e),",",graph.Target(e),
+             ") rather than (",edge.first,",",edge.second,")");
+        ++e;
+    }
+    for( Int s=0; s<graph.NumSources(); ++s )
+    {
+        const Int numConnections =
+          std::distance
+          ( edges.lower_bound(Edge(s,0)), edges.lower_bound(Edge(s+1,0)) );
+        if( graph.NumConnections(s) != numConnections )
+            LogicError("Source ",s," had the wrong number of connections");
+    }
+}
+
+template<typename T>
+void CheckMatrix( const SparseMatrix<T>& A, const std::map<Edge,T>& entries )
+{
+    if( A.NumEntries() != Int(entries.size()) )
+        LogicError
+        ("Matrix had ",A.NumEntries()," entries rather than ",entries.size());
+    Int e = 0;
+    for( const auto& entry : entries )
+    {
+        if( A.Row(e) != entry.first.first || A.Col(e) != entry.first.second ||
+            A.Value(e) != entry.second )
+            LogicError
+            ("Entry ",e," was (",A.Row(e),",",A.Col(e),",",A.Value(e),
+             ") rather than (",entry.first.first,",",entry.first.second,",",
+             entry.second,")");
+        ++e;
+    }
+}
+
+// Queue random edges (with many duplicates) and removals, and compare the
+// sorted result against an ordered set
+void TestGraphQueues( Int numSources, Int numTargets, Int numEdges )
+{
+    Output("Testing graph queues");
+    Graph graph( numSources, numTargets );
+    std::set<Edge> edges;
+    vector<Edge> removals;
+    graph.Reserve( numEdges );
+    for( Int k=0; k<numEdges; ++k )
+    {
+        const Int s = SampleUniform( Int(0), numSources );
+        const Int t = SampleUniform( Int(0), numTargets );
+        graph.QueueConnection( s, t );
+        edges.insert( Edge(s,t) );
+        // Remove roughly one in ten edges, some of which are queued later
+        if( k % 10 == 0 )
+            removals.push_back
+            ( Edge(SampleUniform(Int(0),numSources),t) );
+    }
+    for( const auto& removal : removals )
+    {
+        graph.QueueDisconnection( removal.first, removal.second );
+        edges.erase( removal );
+    }
+    graph.ProcessQueues();
+    CheckGraph( graph, edges );
+
+    // Processing again should be a no-op, and a further batch should merge
+    // with the existing edges
+    graph.ProcessQueues();
+    CheckGraph( graph, edges );
+    for( Int k=0; k<numEdges/2; ++k )
+    {
+        const Int s = SampleUniform( Int(0), numSources );
+        const Int t = SampleUniform( Int(0), numTargets );
+        graph.QueueConnection( s, t );
+        edges.insert( Edge(s,t) );
+    }
+    graph.ProcessQueues();
+    CheckGraph( graph, edges );
+
+    // An empty queue should leave an empty graph
+    Graph empty( numSources, numTargets );
+    empty.ProcessQueues();
+    CheckGraph( empty, std::set<Edge>() );
+}
+
+// Duplicate updates should be summed, and zeroed entries should be removed
+// along with every queued update of them
+void TestMatrixQueues( Int m, Int n, Int numUpdates )
+{
+    Output("Testing sparse matrix queues");
+    SparseMatrix<double> A( m, n );
+    std::map<Edge,double> entries;
+    vector<Edge> zeros;
+    A.Reserve( numUpdates );
+    for( Int k=0; k<numUpdates; ++k )
+    {
+        const Int i = SampleUniform( Int(0), m );
+        const Int j = SampleUniform( Int(0), n );
+        // Integer values keep the sums exact regardless of their order
+        const double value = double(SampleUniform( Int(1), Int(10) ));
+        A.QueueUpdate( i, j, value );
+        entries[Edge(i,j)] += value;
+        if( k % 10 == 0 )
+            zeros.push_back( Edge(i,SampleUniform(Int(0),n)) );
+    }
+    for( const auto& zero : zeros )
+    {
+        A.QueueZero( zero.first, zero.second );
+        entries.erase( zero );
+    }
+    A.ProcessQueues();
+    CheckMatrix( A, entries );
+}
+
+// Adopting CSR data should reproduce the graph (and matrix) that queueing the
+// same entries produces
+void TestSetCSR( Int m, Int n, Int numUpdates )
+{
+    Output("Testing SetCSR");
+    SparseMatrix<double> A( m, n );
+    for( Int k=0; k<numUpdates; ++k )
+        A.QueueUpdate
+        ( SampleUniform(Int(0),m), SampleUniform(Int(0),n),
+          double(SampleUniform(Int(1),Int(10))) );
+    A.ProcessQueues();
+
+    const Int numEntries = A.NumEntries();
+    vector<Int> rowOffsets( m+1 ), colIndices( numEntries );
+    vector<double> values( numEntries );
+    std::map<Edge,double> entries;
+    std::set<Edge> edges;
+    for( Int i=0; i<=m; ++i )
+        rowOffsets[i] = A.RowOffset(i);
+    for( Int e=0; e<numEntries; ++e )
+    {
+        colIndices[e] = A.Col(e);
+        values[e] = A.Value(e);
+        entries[Edge(A.Row(e),A.Col(e))] = A.Value(e);
+        edges.insert( Edge(A.Row(e),A.Col(e)) );
+    }
+
+    SparseMatrix<double> B;
+    B.SetCSR( m, n, rowOffsets, colIndices, values );
+    if( B.Height() != m || B.Width() != n )
+        LogicError("SetCSR produced a ",B.Height()," x ",B.Width()," matrix");
+    CheckMatrix( B, entries );
+    for( Int i=0; i<=m; ++i )
+        if( B.RowOffset(i) != rowOffsets[i] )
+            LogicError("Row offset ",i," was not preserved");
+
+    Graph graph;
+    graph.SetCSR( m, n, rowOffsets, colIndices );
+    CheckGraph( graph, edges );
+
+    // Queued updates should merge with the adopted entries
+    if( m > 0 && n > 0 )
+    {
+        B.QueueUpdate( m-1, n-1, 1. );
+        entries[Edge(m-1,n-1)] += 1.;
+        B.QueueZero( 0, 0 );
+        entries.erase( Edge(0,0) );
+        B.ProcessQueues();
+        CheckMatrix( B, entries );
+    }
+
+    // Inconsistent offsets should be rejected
+    bool threw = false;
+    try
+    {
+        vector<Int> badOffsets( rowOffsets );
+        badOffsets[m] += 1;
+        graph.SetCSR( m, n, badOffsets, colIndices );
+    }
+    catch( std::exception& e ) { threw = true; }
+    if( !threw )
+        LogicError("Inconsistent source offsets were accepted");
+}
+
+// Compressing the storage, reading the sources back through each accessor,
+// and uncompressing should preserve the graph
+void TestCompression( Int numSources, Int numTargets, Int numEdges )
+{
+    Output("Testing compressed storage");
+    Graph graph( numSources, numTargets );
+    std::set<Edge> edges;
+    for( Int k=0; k<numEdges; ++k )
+    {
+        const Int s = SampleUniform( Int(0), numSources );
+        const Int t = SampleUniform( Int(0), numTargets );
+        graph.QueueConnection( s, t );
+        edges.insert( Edge(s,t) );
+    }
+    graph.CompressStorage();
+    if( !graph.CompressedStorage() )
+        LogicError("Storage was not compressed");
+    CheckGraph( graph, edges );
+
+    // The sources are not stored, so the locked buffer should be refused
+    // rather than lazily filled, while each source should still be recovered
+    // from the offsets
+    bool threw = false;
+    try { graph.LockedSourceBuffer(); }
+    catch( std::exception& e ) { threw = true; }
+    if( !threw )
+        LogicError("LockedSourceBuffer succeeded with compressed storage");
+    if( !graph.CompressedStorage() )
+        LogicError("LockedSourceBuffer uncompressed the storage");
+    for( Int s=0; s<graph.NumSources(); ++s )
+        for( Int e=graph.SourceOffset(s); e<graph.SourceOffset(s+1); ++e )
+            if( graph.Source(e) != s )
+                LogicError("Source ",e," was wrong");
+
+    // Queued edges should be merged without leaving compressed storage
+    for( Int k=0; k<numEdges/4; ++k )
+    {
+        const Int s = SampleUniform( Int(0), numSources );
+        const Int t = SampleUniform( Int(0), numTargets );
+        graph.QueueConnection( s, t );
+        edges.insert( Edge(s,t) );
+    }
+    graph.ProcessQueues();
+    if( !graph.CompressedStorage() )
+        LogicError("Processing the queues uncompressed the storage");
+    CheckGraph( graph, edges );
+
+    // The mutable buffer requires the explicit sources
+    const Int* sources = graph.SourceBuffer();
+    if( graph.CompressedStorage() )
+        LogicError("SourceBuffer did not uncompress the storage");
+    for( Int e=0; e<graph.NumEdges(); ++e )
+        if( sources[e] != graph.Source(e) )
+            LogicError("Source ",e," was wrong after uncompressing");
+    graph.CompressStorage();
+    graph.UncompressStorage();
+    if( graph.CompressedStorage() )
+        LogicError("Storage was still compressed");
+    CheckGraph( graph, edges );
+
+    // Resizing to the same dimensions keeps the edges, the frozen sparsity,
+    // and the storage mode, while other sizes drop the edges and unfreeze
+    graph.CompressStorage();
+    graph.FreezeSparsity();
+    graph.Resize( numSources, numTargets );
+    if( !graph.CompressedStorage() || !graph.FrozenSparsity() )
+        LogicError("Resizing to the same size changed the graph's state");
+    CheckGraph( graph, edges );
+    graph.Resize( numSources+1, numTargets );
+    if( !graph.CompressedStorage() || graph.FrozenSparsity() )
+        LogicError("Resizing changed the storage mode or left it frozen");
+    CheckGraph( graph, std::set<Edge>() );
+    graph.Connect( numSources, 0 );
+    std::set<Edge> newEdges;
+    newEdges.insert( Edge(numSources,0) );
+    CheckGraph( graph, newEdges );
+
+    // Sparse matrices should likewise keep their entries
+    SparseMatrix<double> A( numSources, numTargets );
+    std::map<Edge,double> entries;
+    for( Int k=0; k<numEdges; ++k )
+    {
+        const Int i = SampleUniform( Int(0), numSources );
+        const Int j = SampleUniform( Int(0), numTargets );
+        const double value = double(SampleUniform( Int(1), Int(10) ));
+        A.QueueUpdate( i, j, value );
+        entries[Edge(i,j)] += value;
+    }
+    A.CompressStorage();
+    CheckMatrix( A, entries );
+    for( Int i=0; i<A.Height(); ++i )
+        for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+            if( A.Row(e) != i )
+                LogicError("Row ",e," was wrong");
+    A.UncompressStorage();
+    if( A.CompressedStorage() )
+        LogicError("Matrix storage was still compressed");
+    CheckMatrix( A, entries );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","number of sources (rows)",100);
+        const Int n = Input("--n","number of targets (columns)",50);
+        const Int numEdges = Input("--numEdges","number of queued edges",2000);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestGraphQueues( m, n, numEdges );
+            TestMatrixQueues( m, n, numEdges );
+            TestSetCSR( m, n, numEdges );
+            TestCompression( m, n, numEdges );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
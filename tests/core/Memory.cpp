@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// An element whose constructor throws after a given number of constructions
+struct Fragile
+{
+    static Int numLive;
+    static Int numUntilThrow;
+
+    double value;
+
+    Fragile() : value(0)
+    {
+        if( numUntilThrow-- == 0 )
+            RuntimeError("Fragile construction failed");
+        ++numLive;
+    }
+    ~Fragile() { --numLive; }
+};
+Int Fragile::numLive = 0;
+Int Fragile::numUntilThrow = -1;
+
+bool IsAligned( const void* ptr )
+{ return reinterpret_cast<std::uintptr_t>(ptr) % memory::ALIGNMENT == 0; }
+
+void TestAlignment( Int maxSize )
+{
+    Output("Testing alignment");
+    for( Int size=1; size<=maxSize; size*=3 )
+    {
+        Memory<double> realMem( size );
+        Memory<Complex<double>> complexMem( size );
+        Memory<char> charMem( size );
+        if( !IsAligned(realMem.Buffer()) ||
+            !IsAligned(complexMem.Buffer()) ||
+            !IsAligned(charMem.Buffer()) )
+            LogicError("Buffer of size ",size," was not aligned");
+
+        void* ptr = memory::Allocate( size );
+        if( !IsAligned(ptr) )
+            LogicError("Allocate(",size,") was not aligned");
+        memory::Deallocate( ptr, size );
+    }
+}
+
+void TestReuse( Int size )
+{
+    Output("Testing reuse");
+    memory::SetPooling( true );
+    memory::ReleasePool();
+    memory::ResetStatistics();
+    const size_t liveBytes = memory::GetStatistics().liveBytes;
+
+    double* firstBuffer;
+    {
+        Memory<double> mem( size );
+        firstBuffer = mem.Buffer();
+    }
+    auto stats = memory::GetStatistics();
+    if( stats.liveBytes != liveBytes ||
+        stats.pooledBytes < size_t(size)*sizeof(double) )
+        LogicError("Freed buffer was not cached");
+
+    // A request in the same size class should be served from the pool
+    {
+        Memory<double> mem( size-1 );
+        if( mem.Buffer() != firstBuffer )
+            LogicError("Cached buffer was not reused");
+    }
+    stats = memory::GetStatistics();
+    if( stats.numAllocations != 2 || stats.numReuses != 1 )
+        LogicError
+        ("Expected 2 allocations and 1 reuse but found ",
+         stats.numAllocations," and ",stats.numReuses);
+
+    // Without pooling, nothing should be cached
+    memory::SetPooling( false );
+    {
+        Memory<double> mem( size );
+    }
+    stats = memory::GetStatistics();
+    if( stats.pooledBytes != 0 )
+        LogicError("Buffers were cached with pooling disabled");
+    memory::SetPooling( true );
+    Output("  ",stats.numAllocations," allocations, ",stats.numReuses,
+           " reuses, peak of ",stats.peakBytes," bytes");
+}
+
+void TestFailedConstruction( Int size )
+{
+    Output("Testing construction failure");
+    const size_t liveBytes = memory::GetStatistics().liveBytes;
+    Fragile::numLive = 0;
+    Fragile::numUntilThrow = size/2;
+    bool threw = false;
+    try { Memory<Fragile> mem( size ); }
+    catch( std::exception& e ) { threw = true; }
+    Fragile::numUntilThrow = -1;
+
+    if( !threw )
+        LogicError("Construction failure was not propagated");
+    if( Fragile::numLive != 0 )
+        LogicError
+        (Fragile::numLive," constructed elements were not destroyed");
+    if( memory::GetStatistics().liveBytes != liveBytes )
+        LogicError("Buffer was leaked after construction failure");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int maxSize = Input("--maxSize","maximum buffer size",1000000);
+        const Int size = Input("--size","size of reused buffers",1000);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestAlignment( maxSize );
+            TestReuse( size );
+            TestFailedConstruction( size );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,364 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A minimal JSON reader, sufficient for checking the profiler output
+struct JSONValue
+{
+    enum { NUMBER, STRING, ARRAY, OBJECT } type=NUMBER;
+    double number=0;
+    string str;
+    vector<JSONValue> elements;
+    vector<pair<string,JSONValue>> members;
+
+    const JSONValue& operator[]( const string& key ) const
+    {
+        for( const auto& member : members )
+            if( member.first == key )
+                return member.second;
+        LogicError("JSON object did not contain \"",key,"\"");
+        return *this;
+    }
+};
+
+class JSONParser
+{
+public:
+    JSONParser( const string& text ) : text_(text), pos_(0) { }
+
+    JSONValue Parse()
+    {
+        JSONValue value = ParseValue();
+        SkipSpace();
+        if( pos_ != text_.size() )
+            LogicError("Trailing characters after JSON value");
+        return value;
+    }
+
+private:
+    const string& text_;
+    size_t pos_;
+
+    void SkipSpace()
+    {
+        while( pos_ < text_.size() && std::isspace(text_[pos_]) )
+            ++pos_;
+    }
+
+    char Peek()
+    {
+        SkipSpace();
+        if( pos_ >= text_.size() )
+            LogicError("Unexpected end of JSON");
+        return text_[pos_];
+    }
+
+    void Expect( char c )
+    {
+        if( Peek() != c )
+            LogicError("Expected '",c,"' at position ",pos_," of JSON");
+        ++pos_;
+    }
+
+    string ParseString()
+    {
+        Expect('"');
+        string str;
+        while( pos_ < text_.size() && text_[pos_] != '"' )
+        {
+            if( text_[pos_] == '\\' )
+                ++pos_;
+            str += text_[pos_++];
+        }
+        Expect('"');
+        return str;
+    }
+
+    JSONValue ParseValue()
+    {
+        JSONValue value;
+        const char c = Peek();
+        if( c == '{' )
+        {
+            value.type = JSONValue::OBJECT;
+            ++pos_;
+            if( Peek() != '}' )
+            {
+                while( true )
+                {
+                    const string key = ParseString();
+                    Expect(':');
+                    value.members.emplace_back( key, ParseValue() );
+                    if( Peek() != ',' )
+                        break;
+                    ++pos_;
+                }
+            }
+            Expect('}');
+        }
+        else if( c == '[' )
+        {
+            value.type = JSONValue::ARRAY;
+            ++pos_;
+            if( Peek() != ']' )
+            {
+                while( true )
+                {
+                    value.elements.push_back( ParseValue() );
+                    if( Peek() != ',' )
+                        break;
+                    ++pos_;
+                }
+            }
+            Expect(']');
+        }
+        else if( c == '"' )
+        {
+            value.type = JSONValue::STRING;
+            value.str = ParseString();
+        }
+        else
+        {
+            const char* begin = text_.c_str() + pos_;
+            char* end;
+            value.number = std::strtod( begin, &end );
+            if( end == begin )
+                LogicError("Invalid JSON value at position ",pos_);
+            pos_ += end - begin;
+        }
+        return value;
+    }
+};
+
+JSONValue ReadJSON( const string& filename )
+{
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    const string text = contents.str();
+    return JSONParser( text ).Parse();
+}
+
+const JSONValue& FindRegion( const JSONValue& regions, const string& name )
+{
+    for( const auto& region : regions.elements )
+        if( region["name"].str == name )
+            return region;
+    LogicError("Could not find region \"",name,"\"");
+    return regions;
+}
+
+// The maximum number of flops recorded within a region and its descendants
+double SubtreeFlops( const JSONValue& region )
+{
+    double flops = region["flops"]["max"].number;
+    for( const auto& child : region["children"].elements )
+        flops += SubtreeFlops( child );
+    return flops;
+}
+
+void CheckRegion
+( const JSONValue& region, double numCalls, bool checkTime=true )
+{
+    const string& name = region["name"].str;
+    const auto& calls = region["calls"];
+    if( calls["min"].number != numCalls || calls["max"].number != numCalls )
+        LogicError
+        ("Region \"",name,"\" recorded ",calls["max"].number,
+         " calls rather than ",numCalls);
+    if( checkTime && region["time"]["max"].number <= 0 )
+        LogicError("Region \"",name,"\" recorded no time");
+    if( region["time"]["min"].number > region["time"]["max"].number )
+        LogicError("Region \"",name,"\" had inconsistent time bounds");
+}
+
+void CheckProfile( const string& filename, Int numIts, mpi::Comm comm )
+{
+    const JSONValue profile = ReadJSON( filename );
+    if( profile["numProcesses"].number != mpi::Size(comm) )
+        LogicError("Profile reported the wrong number of processes");
+    const auto& regions = profile["regions"];
+    if( regions.elements.size() != 2 )
+        LogicError
+        ("Expected 2 top-level regions but found ",regions.elements.size());
+
+    const auto& generation = FindRegion( regions, "Generation" );
+    CheckRegion( generation, 1 );
+
+    const auto& iteration = FindRegion( regions, "Iteration" );
+    CheckRegion( iteration, numIts );
+    const auto& children = iteration["children"];
+    if( children.elements.size() != 2 )
+        LogicError("Expected 2 regions nested within \"Iteration\"");
+    const auto& gemm = FindRegion( children, "Gemm" );
+    CheckRegion( gemm, numIts );
+    CheckRegion( FindRegion( children, "FrobeniusNorm" ), numIts );
+    if( SubtreeFlops(gemm) <= 0 )
+        LogicError("No flops were attributed to \"Gemm\"");
+    if( gemm["time"]["max"].number > iteration["time"]["max"].number )
+        LogicError("A nested region took longer than its parent");
+}
+
+void CheckTrace( const string& filename, Int numIts )
+{
+    const JSONValue trace = ReadJSON( filename );
+    const auto& events = trace["traceEvents"].elements;
+    const size_t numEvents = 1 + 3*numIts;
+    if( events.size() != numEvents )
+        LogicError
+        ("Expected ",numEvents," trace events but found ",events.size());
+    for( const auto& event : events )
+    {
+        if( event["ph"].str != "X" )
+            LogicError("Trace events should be complete (\"X\") events");
+        if( event["dur"].number < 0 )
+            LogicError("Trace event had a negative duration");
+    }
+}
+
+// The traffic over the column and row communicators of the grid must be
+// reported separately (even when, as on a 2 x 2 grid, they have the same size
+// and root), and every member of a communicator must agree upon its label
+void CheckCommLabels( const Grid& g )
+{
+    mpi::ResetCommStats();
+    mpi::EnableCommStats();
+    int value = 1;
+    mpi::Broadcast( value, 0, g.ColComm() );
+    mpi::Broadcast( value, 0, g.RowComm() );
+    mpi::DisableCommStats();
+
+    vector<string> labels;
+    for( const auto& stat : mpi::LocalCommStats() )
+        if( stat.op == "Broadcast" )
+            labels.push_back( stat.comm );
+    mpi::ResetCommStats();
+    const size_t numLabels = ( g.Height() > 1 ) + ( g.Width() > 1 );
+    if( labels.size() != numLabels )
+        LogicError
+        ("Expected ",numLabels," communicator labels but found ",
+         labels.size());
+
+    mpi::Comm comms[2] = { g.ColComm(), g.RowComm() };
+    for( const mpi::Comm& labelComm : comms )
+    {
+        if( mpi::Size(labelComm) == 1 )
+            continue;
+        // Find our label for this communicator by recording one more call
+        mpi::EnableCommStats();
+        mpi::Broadcast( value, 0, labelComm );
+        mpi::DisableCommStats();
+        string label = mpi::LocalCommStats()[0].comm;
+        mpi::ResetCommStats();
+
+        int labelSize = label.size();
+        mpi::Broadcast( labelSize, 0, labelComm );
+        vector<byte> labelBuf( label.begin(), label.end() );
+        labelBuf.resize( labelSize );
+        mpi::Broadcast( labelBuf.data(), labelSize, 0, labelComm );
+        const string rootLabel( labelBuf.begin(), labelBuf.end() );
+        if( rootLabel != label )
+            LogicError
+            ("Communicator was labeled ",label," rather than ",rootLabel);
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of matrices",500);
+        const Int numIts = Input("--numIts","number of iterations",3);
+        const bool trace = Input("--trace","write a Chrome trace?",true);
+        const bool commStats =
+          Input("--commStats","record communication statistics?",true);
+        const bool keep = Input("--keep","keep the output files?",false);
+        const string basename =
+          Input("--basename","basename of output files",string("Profile"));
+        ProcessInput();
+        PrintInputReport();
+
+        ResetProfile();
+        EnableProfiling( trace );
+        if( commStats )
+            mpi::EnableCommStats();
+        DistMatrix<double> A, B, C;
+        {
+            ProfileRegion region("Generation");
+            Uniform( A, n, n );
+            Uniform( B, n, n );
+        }
+        for( Int it=0; it<numIts; ++it )
+        {
+            ProfileRegion region("Iteration");
+            {
+                ProfileRegion gemmRegion("Gemm");
+                Gemm( NORMAL, NORMAL, 1., A, B, C );
+            }
+            {
+                ProfileRegion normRegion("FrobeniusNorm");
+                const double frobNorm = FrobeniusNorm( C );
+                OutputFromRoot(comm,"|| C ||_F = ",frobNorm);
+            }
+        }
+        DisableProfiling();
+        if( commStats )
+        {
+            mpi::DisableCommStats();
+            if( mpi::Size(comm) > 1 && mpi::LocalCommStats().empty() )
+                LogicError("No communication was recorded");
+            mpi::WriteCommStats( cout, comm );
+            mpi::ResetCommStats();
+            CheckCommLabels( A.Grid() );
+        }
+
+        // The DEBUG_CSE scopes are also regions in profiling builds, so the
+        // exact shape of the tree is only checked otherwise
+        const string jsonName = basename+".json";
+        const string traceName =
+          BuildString(basename,"-trace-",commRank,".json");
+        WriteProfileJSON( jsonName, comm );
+        if( trace )
+            WriteProfileTrace( basename+"-trace" );
+#ifndef EL_PROFILE
+        if( commRank == 0 )
+            CheckProfile( jsonName, numIts, comm );
+        if( trace )
+            CheckTrace( traceName, numIts );
+#else
+        if( commRank == 0 )
+            ReadJSON( jsonName );
+        if( trace )
+            ReadJSON( traceName );
+#endif
+        OutputFromRoot(comm,"Profile output passed its checks");
+
+        if( keep )
+            OutputFromRoot(comm,"Wrote profile to ",jsonName);
+        else
+        {
+            mpi::Barrier( comm );
+            if( commRank == 0 )
+                std::remove( jsonName.c_str() );
+            if( trace )
+                std::remove( traceName.c_str() );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
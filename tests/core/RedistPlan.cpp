@@ -0,0 +1,174 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Each entry records its global position so that misplaced entries are caught
+double Value( Int i, Int j ) { return double(i) + 1000.*double(j); }
+
+void Fill( AbstractDistMatrix<double>& A, Int m, Int n )
+{
+    A.Resize( m, n );
+    if( !A.Participating() )
+        return;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc, Value(A.GlobalRow(iLoc),A.GlobalCol(jLoc)) );
+}
+
+void Check( const AbstractDistMatrix<double>& B, Int m, Int n, string label )
+{
+    if( B.Height() != m || B.Width() != n )
+        LogicError(label,": B was ",B.Height()," x ",B.Width());
+    if( !B.Participating() )
+        return;
+    for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+        {
+            const Int i = B.GlobalRow(iLoc);
+            const Int j = B.GlobalCol(jLoc);
+            if( B.GetLocal(iLoc,jLoc) != Value(i,j) )
+                LogicError
+                (label,": B(",i,",",j,")=",B.GetLocal(iLoc,jLoc),
+                 " rather than ",Value(i,j));
+        }
+}
+
+// Whether this process builds (and caches) a plan for copying A into B
+bool ExpectPlan
+( const AbstractDistMatrix<double>& A, const AbstractDistMatrix<double>& B )
+{
+    if( A.Grid().Size() == 1 && B.Grid().Size() == 1 )
+        return false;
+    return A.Grid() != B.Grid() || B.Grid().InGrid();
+}
+
+copy::RedistPlan* CachedPlan
+( const AbstractDistMatrix<double>& A, const AbstractDistMatrix<double>& B )
+{ return copy::FindRedistPlan( copy::MakeRedistPlanKey( A, B ) ); }
+
+// Copy A into B twice with the general-purpose redistribution, checking the
+// result each time and that the second copy reused the first copy's plan
+void TestCopy
+( const AbstractDistMatrix<double>& A, AbstractDistMatrix<double>& B,
+  const string& label )
+{
+    OutputFromRoot(mpi::COMM_WORLD,"Testing ",label);
+    const Int m = A.Height();
+    const Int n = A.Width();
+    B.Resize( m, n );
+    if( CachedPlan( A, B ) != nullptr )
+        LogicError(label,": a plan was cached before the first copy");
+    copy::GeneralPurpose( A, B );
+    Check( B, m, n, label );
+
+    copy::RedistPlan* plan = CachedPlan( A, B );
+    if( ExpectPlan(A,B) != (plan != nullptr) )
+        LogicError(label,": the plan was not cached as expected");
+    Zero( B );
+    copy::GeneralPurpose( A, B );
+    Check( B, m, n, label+" (cached)" );
+    if( CachedPlan( A, B ) != plan )
+        LogicError(label,": the cached plan was not reused");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",50);
+        const Int n = Input("--width","width of matrix",30);
+        const Int mb = Input("--blockHeight","block height",3);
+        const Int nb = Input("--blockWidth","block width",2);
+        ProcessInput();
+        PrintInputReport();
+
+        copy::ClearRedistPlans();
+        const Grid g( comm );
+
+        // The first half of the processes (at least one) form a subgrid
+        const int subSize = Max(commSize/2,1);
+        vector<int> subRanks(subSize);
+        for( int q=0; q<subSize; ++q )
+            subRanks[q] = q;
+        mpi::Group group, subGroup;
+        mpi::CommGroup( comm, group );
+        mpi::Incl( group, subSize, subRanks.data(), subGroup );
+        const Grid subGrid( comm, subGroup, Grid::FindFactor(subSize) );
+        mpi::Free( subGroup );
+        mpi::Free( group );
+
+        // Element-wise sources
+        DistMatrix<double> A(g);
+        Fill( A, m, n );
+        {
+            DistMatrix<double,VR,STAR> B(g);
+            TestCopy( A, B, "[MC,MR] -> [VR,STAR]" );
+        }
+        {
+            DistMatrix<double,MR,MC> B(subGrid);
+            TestCopy( A, B, "[MC,MR] -> [MR,MC] on a subgrid" );
+            DistMatrix<double,STAR,VC> C(g);
+            TestCopy( B, C, "[MR,MC] on a subgrid -> [STAR,VC]" );
+        }
+
+        // Block-cyclic sources
+        DistMatrix<double,MC,MR,BLOCK> ABlock(g,mb,nb);
+        Fill( ABlock, m, n );
+        {
+            DistMatrix<double,VC,STAR> B(g);
+            TestCopy( ABlock, B, "[MC,MR,BLOCK] -> [VC,STAR]" );
+        }
+        {
+            DistMatrix<double,MC,MR,BLOCK> B(subGrid,nb,mb);
+            TestCopy
+            ( ABlock, B, "[MC,MR,BLOCK] -> [MC,MR,BLOCK] on a subgrid" );
+        }
+
+        // Redundant targets
+        {
+            DistMatrix<double,STAR,STAR> B(g);
+            TestCopy( ABlock, B, "[MC,MR,BLOCK] -> [STAR,STAR]" );
+        }
+        {
+            DistMatrix<double,STAR,STAR> B(subGrid);
+            TestCopy( A, B, "[MC,MR] -> [STAR,STAR] on a subgrid" );
+        }
+        {
+            DistMatrix<double,MC,STAR> B(subGrid);
+            TestCopy( ABlock, B, "[MC,MR,BLOCK] -> [MC,STAR] on a subgrid" );
+        }
+
+        // Plans are keyed on grid identifiers which are never reused, so a
+        // grid created after another was destroyed must not pick up the plans
+        // of its predecessor, even when it has the same shape
+        for( Int rep=0; rep<2; ++rep )
+        {
+            const Grid newGrid( comm, Grid::FindFactor(commSize) );
+            DistMatrix<double,VR,STAR> B(newGrid);
+            TestCopy
+            ( A, B, BuildString("[MC,MR] -> [VR,STAR] on new grid ",rep) );
+        }
+
+        copy::ClearRedistPlans();
+        {
+            DistMatrix<double,VR,STAR> B(g);
+            TestCopy( A, B, "[MC,MR] -> [VR,STAR] after clearing the plans" );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
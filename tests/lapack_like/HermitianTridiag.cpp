@@ -15,6 +15,7 @@ void TestCorrectness
   const Matrix<F>& A, 
   const Matrix<F>& phase,
         Matrix<F>& AOrig,
+  const HermitianTridiagCtrl<F>& ctrl,
   bool print,
   bool display )
 {
@@ -43,8 +44,8 @@ void TestCorrectness
         Display( B, "Tridiagonal" );
 
     // Reverse the accumulated Householder transforms, ignoring symmetry
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, phase, B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, phase, B );
+    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, phase, B, ctrl );
+    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, phase, B, ctrl );
     if( print )
         Print( B, "Rotated tridiagonal" );
     if( display )
@@ -64,13 +65,13 @@ void TestCorrectness
 
     // Compute || I - Q Q^H ||
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, phase, B );
+    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, phase, B, ctrl );
     Matrix<F> QHAdj;
     Adjoint( B, QHAdj );
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, phase, B );
+    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, phase, B, ctrl );
     QHAdj -= B;
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, phase, B );
+    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, phase, B, ctrl );
     ShiftDiagonal( B, F(-1) );
     const Real infOrthogError = InfinityNorm( B );
     const Real relOrthogError = infOrthogError / (eps*m);
@@ -91,6 +92,7 @@ void TestCorrectness
   const DistMatrix<F>& A, 
   const DistMatrix<F,STAR,STAR>& phase,
         DistMatrix<F>& AOrig,
+  const HermitianTridiagCtrl<F>& ctrl,
   bool print,
   bool display )
 {
@@ -121,8 +123,8 @@ void TestCorrectness
         Display( B, "Tridiagonal" );
 
     // Reverse the accumulated Householder transforms, ignoring symmetry
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, phase, B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, phase, B );
+    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, phase, B, ctrl );
+    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, phase, B, ctrl );
     if( print )
         Print( B, "Rotated tridiagonal" );
     if( display )
@@ -143,13 +145,13 @@ void TestCorrectness
 
     // Compute || I - Q Q^H ||
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, phase, B );
+    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, phase, B, ctrl );
     DistMatrix<F> QHAdj( g );
     Adjoint( B, QHAdj );
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, phase, B );
+    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, phase, B, ctrl );
     QHAdj -= B;
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, phase, B );
+    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, phase, B, ctrl );
     ShiftDiagonal( B, F(-1) );
     const Real infOrthogError = InfinityNorm( B );
     const Real relOrthogError = infOrthogError / (eps*m);
@@ -169,6 +171,7 @@ void InnerTestHermitianTridiag
 ( UpperOrLower uplo,
         Matrix<F>& A,
         Matrix<F>& phase,
+  const HermitianTridiagCtrl<F>& ctrl,
   bool correctness,
   bool print,
   bool display )
@@ -179,7 +182,7 @@ void InnerTestHermitianTridiag
 
     Output("Starting tridiagonalization...");
     timer.Start();
-    HermitianTridiag( uplo, A, phase );
+    HermitianTridiag( uplo, A, phase, ctrl );
     const double runTime = timer.Stop();
     const double realGFlops = 16./3.*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
@@ -195,7 +198,7 @@ void InnerTestHermitianTridiag
         Display( phase, "phase after HermitianTridiag" );
     }
     if( correctness )
-        TestCorrectness( uplo, A, phase, AOrig, print, display );
+        TestCorrectness( uplo, A, phase, AOrig, ctrl, print, display );
     A = ACopy;
 }
 
@@ -234,7 +237,7 @@ void InnerTestHermitianTridiag
         Display( phase, "phase after HermitianTridiag" );
     }
     if( correctness )
-        TestCorrectness( uplo, A, phase, AOrig, print, display );
+        TestCorrectness( uplo, A, phase, AOrig, ctrl, print, display );
     A = ACopy;
 }
 
@@ -242,6 +245,7 @@ template<typename F>
 void TestHermitianTridiag
 ( UpperOrLower uplo,
   Int m,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -259,9 +263,17 @@ void TestHermitianTridiag
     if( display )
         Display( A, "A" );
 
+    HermitianTridiagCtrl<F> ctrl;
+
     Output("Sequential algorithm:");
     InnerTestHermitianTridiag
-    ( uplo, A, phase, correctness, print, display );
+    ( uplo, A, phase, ctrl, correctness, print, display );
+
+    Output("Sequential two-stage algorithm:");
+    ctrl.twoStage = true;
+    ctrl.bandwidth = bandwidth;
+    InnerTestHermitianTridiag
+    ( uplo, A, phase, ctrl, correctness, print, display );
 
     PopIndent();
 }
@@ -273,6 +285,7 @@ void TestHermitianTridiag
   Int m,
   Int nbLocal,
   bool avoidTrmv,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -310,6 +323,12 @@ void TestHermitianTridiag
     ctrl.order = COLUMN_MAJOR;
     InnerTestHermitianTridiag
     ( uplo, A, phase, ctrl, correctness, print, display );
+
+    OutputFromRoot(g.Comm(),"Two-stage algorithm:");
+    ctrl.twoStage = true;
+    ctrl.bandwidth = bandwidth;
+    InnerTestHermitianTridiag
+    ( uplo, A, phase, ctrl, correctness, print, display );
     PopIndent();
 }
 
@@ -329,6 +348,8 @@ main( int argc, char* argv[] )
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool avoidTrmv = 
           Input("--avoidTrmv","avoid Trmv local Symv",true);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage intermediate bandwidth (0=nb)",0);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -360,95 +381,106 @@ main( int argc, char* argv[] )
         {
             if( testReal )
                 TestHermitianTridiag<float>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<float>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 
             if( testReal )
                 TestHermitianTridiag<double>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<double>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 
 #ifdef EL_HAVE_QD
             if( testReal )
             {
                 TestHermitianTridiag<DoubleDouble>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
                 TestHermitianTridiag<QuadDouble>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             }
             if( testCpx )
             {
                 TestHermitianTridiag<Complex<DoubleDouble>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
                 TestHermitianTridiag<Complex<QuadDouble>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             }
 #endif
 
 #ifdef EL_HAVE_QUAD
             if( testReal )
                 TestHermitianTridiag<Quad>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<Quad>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
             if( testReal )
                 TestHermitianTridiag<BigFloat>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 #endif
         }
 
         if( testReal )
             TestHermitianTridiag<float>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<float>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
         if( testReal )
             TestHermitianTridiag<double>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<double>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
 #ifdef EL_HAVE_QD
         if( testReal )
         {
             TestHermitianTridiag<DoubleDouble>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<QuadDouble>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
         if( testCpx )
         {
             TestHermitianTridiag<Complex<DoubleDouble>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<Complex<QuadDouble>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
 #endif
 
 #ifdef EL_HAVE_QUAD
         if( testReal )
             TestHermitianTridiag<Quad>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<Quad>>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
         if( testReal )
             TestHermitianTridiag<BigFloat>
-            ( g, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( g, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
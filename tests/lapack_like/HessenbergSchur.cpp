@@ -288,6 +288,68 @@ void TestRandomQuasi( Int n, const HessenbergSchurCtrl& ctrl, bool print )
         Print( R );
 }
 
+template<typename F>
+void TestRandomDist
+( const Grid& g, Int n, const HessenbergSchurCtrl& ctrl, bool print )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( g.Rank() == 0 )
+        Output("Testing distributed uniform Hessenberg with ",TypeName<F>());
+
+    DistMatrix<F> H(g);
+    Uniform( H, n, n );
+    MakeTrapezoidal( UPPER, H, -1 );
+    const Real HFrob = FrobeniusNorm( H );
+    if( g.Rank() == 0 )
+        Output("|| H ||_F = ",HFrob);
+    if( print )
+        Print( H, "H" );
+
+    DistMatrix<F> T(g), Z(g);
+    DistMatrix<Complex<Real>,VR,STAR> w(g);
+    Timer timer;
+
+    T = H;
+    Identity( Z, n, n );
+    if( g.Rank() == 0 )
+        timer.Start();
+    auto info = HessenbergSchur( T, w, Z, ctrl );
+    if( g.Rank() == 0 )
+    {
+        Output("HessenbergSchur: ",timer.Stop()," seconds");
+        Output("Convergence achieved after ",info.numIterations," iterations");
+    }
+    if( print )
+    {
+        Print( w, "w" );
+        Print( Z, "Z" );
+        Print( T, "T" );
+    }
+
+    DistMatrix<F> R(g);
+    Gemm( NORMAL, NORMAL, F(1), Z, T, R );
+    Gemm( NORMAL, NORMAL, F(1), H, Z, F(-1), R );
+    const Real errFrob = FrobeniusNorm( R ); 
+    if( g.Rank() == 0 )
+        Output("|| H Z - Z T ||_F / || H ||_F = ",errFrob/HFrob);
+    if( print )
+        Print( R );
+
+    Identity( R, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), Z, Real(1), R );
+    const Real orthogError = HermitianFrobeniusNorm( LOWER, R );
+    if( g.Rank() == 0 )
+        Output("|| I - Z^H Z ||_F = ",orthogError);
+
+    const Real tol = 100*n*limits::Epsilon<Real>();
+    if( errFrob > tol*HFrob )
+        LogicError
+        ("|| H Z - Z T ||_F / || H ||_F = ",errFrob/HFrob," exceeded ",tol);
+    if( orthogError > tol )
+        LogicError("|| I - Z^H Z ||_F = ",orthogError," exceeded ",tol);
+}
+
 int main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
@@ -296,6 +358,14 @@ int main( int argc, char* argv[] )
     {
         const Int n = Input("--n","random matrix size",60);
         const bool useAED = Input("--aed","use Aggressive Early Deflat?",true);
+        const Int minAEDSize =
+          Input("--minAEDSize","minimum size for using AED",75);
+        const Int distN =
+          Input("--distN","distributed random matrix size",200);
+        const Int distMinAEDSize =
+          Input("--distMinAEDSize","distributed minimum size for AED",30);
+        const Int numBulgeChains =
+          Input("--chains","number of distributed bulge chains (0 for auto)",3);
         const bool progress = Input("--progress","print progress?",true);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
@@ -304,6 +374,7 @@ int main( int argc, char* argv[] )
         HessenbergSchurCtrl ctrl;
         ctrl.useAED = useAED;
         ctrl.progress = progress;
+        ctrl.minAEDSize = minAEDSize;
 
         TestAhuesTisseurQuasi<float>( ctrl, print );
         TestAhuesTisseurQuasi<double>( ctrl, print );
@@ -356,6 +427,17 @@ int main( int argc, char* argv[] )
 #ifdef EL_HAVE_MPC
         TestRandom<BigFloat>( n, ctrl, print );
 #endif
+
+        // Use a small enough minimum AED size for the distributed sweeps and
+        // deflations to be exercised
+        auto ctrlDist( ctrl );
+        ctrlDist.minAEDSize = distMinAEDSize;
+        ctrlDist.numBulgeChains = numBulgeChains;
+        const Grid g( mpi::COMM_WORLD );
+        TestRandomDist<float>( g, distN, ctrlDist, print );
+        TestRandomDist<double>( g, distN, ctrlDist, print );
+        TestRandomDist<Complex<float>>( g, distN, ctrlDist, print );
+        TestRandomDist<Complex<double>>( g, distN, ctrlDist, print );
     }
     catch( std::exception& e ) { ReportException(e); }
 
@@ -35,7 +35,7 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         lu::SolveAfter( NORMAL, A, P, Y );
     else
         lu::SolveAfter( NORMAL, A, P, Q, Y );
@@ -82,7 +82,7 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         lu::SolveAfter( NORMAL, A, P, Y );
     else
         lu::SolveAfter( NORMAL, A, P, Q, Y );
@@ -135,6 +135,12 @@ void TestLU
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
+    else if( pivoting == 3 )
+    {
+        LUCtrl ctrl;
+        ctrl.pivotType = LU_TOURNAMENT;
+        LU( A, P, ctrl );
+    }
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
@@ -208,6 +214,12 @@ void TestLU
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
+    else if( pivoting == 3 )
+    {
+        LUCtrl ctrl;
+        ctrl.pivotType = LU_TOURNAMENT;
+        LU( A, P, ctrl );
+    }
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -248,6 +260,100 @@ void TestLU
     PopIndent();
 }
 
+void TestPivoting
+( const Grid& g,
+  Int m,
+  Int pivot,
+  bool sequential,
+  bool correctness,
+  bool forceGrowth,
+  bool print )
+{
+    if( pivot == 0 )
+        OutputFromRoot(g.Comm(),"Testing LU with no pivoting");
+    else if( pivot == 1 )
+        OutputFromRoot(g.Comm(),"Testing LU with partial pivoting");
+    else if( pivot == 2 )
+        OutputFromRoot(g.Comm(),"Testing LU with full pivoting");
+    else if( pivot == 3 )
+        OutputFromRoot(g.Comm(),"Testing LU with tournament pivoting");
+
+    if( sequential && mpi::Rank() == 0 )
+    {
+        TestLU<float>
+        ( m, pivot, correctness, forceGrowth, print );
+        TestLU<Complex<float>>
+        ( m, pivot, correctness, forceGrowth, print );
+
+        TestLU<double>
+        ( m, pivot, correctness, forceGrowth, print );
+        TestLU<Complex<double>>
+        ( m, pivot, correctness, forceGrowth, print );
+
+#ifdef EL_HAVE_QD
+        TestLU<DoubleDouble>
+        ( m, pivot, correctness, forceGrowth, print );
+        TestLU<QuadDouble>
+        ( m, pivot, correctness, forceGrowth, print );
+
+        TestLU<Complex<DoubleDouble>>
+        ( m, pivot, correctness, forceGrowth, print );
+        TestLU<Complex<QuadDouble>>
+        ( m, pivot, correctness, forceGrowth, print );
+#endif
+
+#ifdef EL_HAVE_QUAD
+        TestLU<Quad>
+        ( m, pivot, correctness, forceGrowth, print );
+        TestLU<Complex<Quad>>
+        ( m, pivot, correctness, forceGrowth, print );
+#endif
+
+#ifdef EL_HAVE_MPC
+        TestLU<BigFloat>
+        ( m, pivot, correctness, forceGrowth, print );
+        TestLU<Complex<BigFloat>>
+        ( m, pivot, correctness, forceGrowth, print );
+#endif
+    }
+
+    TestLU<float>
+    ( g, m, pivot, correctness, forceGrowth, print );
+    TestLU<Complex<float>>
+    ( g, m, pivot, correctness, forceGrowth, print );
+
+    TestLU<double>
+    ( g, m, pivot, correctness, forceGrowth, print );
+    TestLU<Complex<double>>
+    ( g, m, pivot, correctness, forceGrowth, print );
+
+#ifdef EL_HAVE_QD
+    TestLU<DoubleDouble>
+    ( g, m, pivot, correctness, forceGrowth, print );
+    TestLU<QuadDouble>
+    ( g, m, pivot, correctness, forceGrowth, print );
+
+    TestLU<Complex<DoubleDouble>>
+    ( g, m, pivot, correctness, forceGrowth, print );
+    TestLU<Complex<QuadDouble>>
+    ( g, m, pivot, correctness, forceGrowth, print );
+#endif
+
+#ifdef EL_HAVE_QUAD
+    TestLU<Quad>
+    ( g, m, pivot, correctness, forceGrowth, print );
+    TestLU<Complex<Quad>>
+    ( g, m, pivot, correctness, forceGrowth, print );
+#endif
+
+#ifdef EL_HAVE_MPC
+    TestLU<BigFloat>
+    ( g, m, pivot, correctness, forceGrowth, print );
+    TestLU<Complex<BigFloat>>
+    ( g, m, pivot, correctness, forceGrowth, print );
+#endif
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -260,7 +366,9 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
-        const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
+        const Int pivot = Input
+          ("--pivot",
+           "0: none, 1: partial, 2: full, 3: tournament, -1: both 1 and 3",-1);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
@@ -272,7 +380,7 @@ main( int argc, char* argv[] )
 #endif
         ProcessInput();
         PrintInputReport();
-        if( pivot < 0 || pivot > 2 )
+        if( pivot < -1 || pivot > 3 )
             LogicError("Invalid pivot value");
 
 #ifdef EL_HAVE_MPC
@@ -285,87 +393,17 @@ main( int argc, char* argv[] )
         const Grid g( comm, gridHeight, order );
         SetBlocksize( nb );
         ComplainIfDebug();
-        if( pivot == 0 )
-            OutputFromRoot(g.Comm(),"Testing LU with no pivoting");
-        else if( pivot == 1 )
-            OutputFromRoot(g.Comm(),"Testing LU with partial pivoting");
-        else if( pivot == 2 )
-            OutputFromRoot(g.Comm(),"Testing LU with full pivoting");
-
-        if( sequential && mpi::Rank() == 0 )
+        // By default, test both partial and tournament pivoting
+        if( pivot == -1 )
         {
-            TestLU<float>
-            ( m, pivot, correctness, forceGrowth, print );
-            TestLU<Complex<float>>
-            ( m, pivot, correctness, forceGrowth, print );
-
-            TestLU<double>
-            ( m, pivot, correctness, forceGrowth, print );
-            TestLU<Complex<double>>
-            ( m, pivot, correctness, forceGrowth, print );
-
-#ifdef EL_HAVE_QD
-            TestLU<DoubleDouble>
-            ( m, pivot, correctness, forceGrowth, print );
-            TestLU<QuadDouble>
-            ( m, pivot, correctness, forceGrowth, print );
-
-            TestLU<Complex<DoubleDouble>>
-            ( m, pivot, correctness, forceGrowth, print );
-            TestLU<Complex<QuadDouble>>
-            ( m, pivot, correctness, forceGrowth, print );
-#endif
-
-#ifdef EL_HAVE_QUAD
-            TestLU<Quad>
-            ( m, pivot, correctness, forceGrowth, print );
-            TestLU<Complex<Quad>>
-            ( m, pivot, correctness, forceGrowth, print );
-#endif
-
-#ifdef EL_HAVE_MPC
-            TestLU<BigFloat>
-            ( m, pivot, correctness, forceGrowth, print );
-            TestLU<Complex<BigFloat>>
-            ( m, pivot, correctness, forceGrowth, print );
-#endif
+            TestPivoting
+            ( g, m, 1, sequential, correctness, forceGrowth, print );
+            TestPivoting
+            ( g, m, 3, sequential, correctness, forceGrowth, print );
         }
-
-        TestLU<float>
-        ( g, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<float>>
-        ( g, m, pivot, correctness, forceGrowth, print );
-
-        TestLU<double>
-        ( g, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<double>>
-        ( g, m, pivot, correctness, forceGrowth, print );
-
-#ifdef EL_HAVE_QD
-        TestLU<DoubleDouble>
-        ( g, m, pivot, correctness, forceGrowth, print );
-        TestLU<QuadDouble>
-        ( g, m, pivot, correctness, forceGrowth, print );
-
-        TestLU<Complex<DoubleDouble>>
-        ( g, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<QuadDouble>>
-        ( g, m, pivot, correctness, forceGrowth, print );
-#endif
-
-#ifdef EL_HAVE_QUAD
-        TestLU<Quad>
-        ( g, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<Quad>>
-        ( g, m, pivot, correctness, forceGrowth, print );
-#endif
-
-#ifdef EL_HAVE_MPC
-        TestLU<BigFloat>
-        ( g, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<BigFloat>>
-        ( g, m, pivot, correctness, forceGrowth, print );
-#endif
+        else
+            TestPivoting
+            ( g, m, pivot, sequential, correctness, forceGrowth, print );
     }
     catch( exception& e ) { ReportException(e); }
 
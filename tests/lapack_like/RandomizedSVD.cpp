@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Since A has exactly the requested rank, the randomized SVD should recover
+// it to near working precision
+template<typename F>
+void CheckFactorization
+( const Matrix<F>& A, const Matrix<F>& U, const Matrix<Base<F>>& s,
+  const Matrix<F>& V, Int rank, bool print )
+{
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( U.Height() != m || U.Width() != rank || s.Height() != rank ||
+        s.Width() != 1 || V.Height() != n || V.Width() != rank )
+        LogicError
+        ("Expected ",m," x ",rank," U, ",rank," x 1 s, and ",n," x ",rank,
+         " V but found ",U.Height()," x ",U.Width(),", ",s.Height()," x ",
+         s.Width(),", and ",V.Height()," x ",V.Width());
+    for( Int j=1; j<rank; ++j )
+        if( s.Get(j,0) > s.Get(j-1,0) )
+            LogicError("Singular values were not sorted");
+
+    Matrix<F> E( A ), UScaled( U );
+    DiagonalScale( RIGHT, NORMAL, s, UScaled );
+    Gemm( NORMAL, ADJOINT, F(-1), UScaled, V, F(1), E );
+    const Real AFrob = FrobeniusNorm( A );
+    const Real EFrob = FrobeniusNorm( E );
+
+    Matrix<F> Z;
+    Identity( Z, rank, rank );
+    Herk( LOWER, ADJOINT, Real(-1), U, Real(1), Z );
+    const Real UOrthFrob = HermitianFrobeniusNorm( LOWER, Z );
+    Identity( Z, rank, rank );
+    Herk( LOWER, ADJOINT, Real(-1), V, Real(1), Z );
+    const Real VOrthFrob = HermitianFrobeniusNorm( LOWER, Z );
+
+    if( print )
+        Print( E, "A - U Sigma V^H" );
+    Output("|| A - U Sigma V^H ||_F / || A ||_F = ",EFrob/AFrob);
+    Output("|| I - U^H U ||_F = ",UOrthFrob);
+    Output("|| I - V^H V ||_F = ",VOrthFrob);
+
+    const Real tol = 100*Max(m,n)*limits::Epsilon<Real>();
+    if( EFrob > tol*AFrob )
+        LogicError("Relative residual of ",EFrob/AFrob," was too large");
+    if( UOrthFrob > tol || VOrthFrob > tol )
+        LogicError("The singular vectors were not orthonormal");
+}
+
+template<typename F>
+void TestSequential
+( Int m, Int n, Int rank, const RandomizedSVDCtrl& ctrl, bool print )
+{
+    Output("Sequential test with ",TypeName<F>());
+    PushIndent();
+    Matrix<F> A, X, Y;
+    Gaussian( X, m, rank );
+    Gaussian( Y, rank, n );
+    Gemm( NORMAL, NORMAL, F(1), X, Y, A );
+
+    Matrix<F> U, V;
+    Matrix<Base<F>> s;
+    RandomizedSVD( A, U, s, V, ctrl );
+    CheckFactorization( A, U, s, V, rank, print );
+    PopIndent();
+}
+
+template<typename F>
+void TestDistributed
+( const Grid& g, Int m, Int n, Int rank, const RandomizedSVDCtrl& ctrl,
+  bool print )
+{
+    OutputFromRoot(g.Comm(),"Distributed test with ",TypeName<F>());
+    PushIndent();
+    DistMatrix<F> A(g), X(g), Y(g);
+    Gaussian( X, m, rank );
+    Gaussian( Y, rank, n );
+    Gemm( NORMAL, NORMAL, F(1), X, Y, A );
+
+    DistMatrix<F> U(g), V(g);
+    DistMatrix<Base<F>,STAR,STAR> s(g);
+    RandomizedSVD( A, U, s, V, ctrl );
+
+    // Check the gathered factors on the root
+    DistMatrix<F,CIRC,CIRC> A_CIRC( A ), U_CIRC( U ), V_CIRC( V );
+    DistMatrix<Base<F>,CIRC,CIRC> s_CIRC( s );
+    if( g.Rank() == 0 )
+        CheckFactorization
+        ( A_CIRC.Matrix(), U_CIRC.Matrix(), s_CIRC.Matrix(), V_CIRC.Matrix(),
+          rank, print );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",200);
+        const Int n = Input("--width","width of matrix",150);
+        const Int rank = Input("--rank","rank of matrix",10);
+        const Int oversample = Input("--oversample","oversampling",10);
+        const Int numPowerIts =
+          Input("--numPowerIts","number of power iterations",2);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        RandomizedSVDCtrl ctrl;
+        ctrl.rank = rank;
+        ctrl.oversample = oversample;
+        ctrl.numPowerIts = numPowerIts;
+
+        const Grid g( comm );
+        if( sequential && mpi::Rank(comm) == 0 )
+        {
+            TestSequential<double>( m, n, rank, ctrl, print );
+            TestSequential<Complex<double>>( m, n, rank, ctrl, print );
+        }
+        TestDistributed<double>( g, m, n, rank, ctrl, print );
+        TestDistributed<Complex<double>>( g, m, n, rank, ctrl, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
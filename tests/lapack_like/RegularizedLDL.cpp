@@ -0,0 +1,249 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Queue row i of the saddle-point matrix
+//
+//   | L + xReg I,  B^T      |
+//   | B,           yReg I   |,
+//
+// where L is the 2D Laplacian over an n1 x n2 grid and B couples each pair of
+// neighboring primal variables to a single dual variable
+template<class QueueFunc>
+void KKTRow
+( Int i, Int n1, Int n2, double xReg, double yReg, QueueFunc queue )
+{
+    const Int n = n1*n2;
+    if( i < n )
+    {
+        const Int x = i % n1;
+        const Int y = i / n1;
+        queue( i, 4+xReg );
+        if( x > 0 )    queue( i-1,  -1. );
+        if( x+1 < n1 ) queue( i+1,  -1. );
+        if( y > 0 )    queue( i-n1, -1. );
+        if( y+1 < n2 ) queue( i+n1, -1. );
+        if( i/2 < n/2 )
+            queue( n+i/2, i % 2 == 0 ? 1. : 2. );
+    }
+    else
+    {
+        const Int k = i - n;
+        queue( 2*k, 1. );
+        queue( 2*k+1, 2. );
+        queue( i, yReg );
+    }
+}
+
+double RHSEntry( Int i ) { return 1 + double(i % 7); }
+
+template<typename F>
+Base<F> RelativeResidual
+( const SparseMatrix<F>& A, const Matrix<F>& B, const Matrix<F>& X )
+{
+    Matrix<F> R( B );
+    Multiply( NORMAL, F(-1), A, X, F(1), R );
+    return FrobeniusNorm( R ) / FrobeniusNorm( B );
+}
+
+template<typename F>
+Base<F> RelativeResidual
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<F>& B,
+  const DistMultiVec<F>& X )
+{
+    DistMultiVec<F> R( B );
+    Multiply( NORMAL, F(-1), A, X, F(1), R );
+    return FrobeniusNorm( R ) / FrobeniusNorm( B );
+}
+
+// Both solves must reach the working-precision tolerance, so that the
+// demoted factorization only changes the cost of the solve
+template<typename Real>
+void CheckResiduals
+( const string& label, Real residual, Real mixedResidual, Real relTol,
+  mpi::Comm comm )
+{
+    OutputFromRoot
+    (comm,label,": relative residual of ",residual," with the full "
+     "factorization and ",mixedResidual," with the demoted factorization");
+    const Real tol = 10*relTol;
+    if( residual > tol )
+        LogicError
+        (label,": the relative residual ",residual," exceeded ",tol);
+    if( mixedResidual > tol )
+        LogicError
+        (label,": the mixed-precision relative residual ",mixedResidual,
+         " exceeded ",tol," (versus ",residual," without demotion)");
+}
+
+template<typename F>
+void TestSequential
+( Int n1, Int n2, Base<F> reg, const RegSolveCtrl<Base<F>>& ctrl )
+{
+    typedef Base<F> Real;
+    typedef Demote<F> FLow;
+    const Int n = n1*n2;
+    const Int N = n + n/2;
+
+    SparseMatrix<F> JOrig, J;
+    Zeros( JOrig, N, N );
+    Zeros( J, N, N );
+    for( Int i=0; i<N; ++i )
+    {
+        KKTRow
+        ( i, n1, n2, 0, 0,
+          [&]( Int j, double value ) { JOrig.QueueUpdate( i, j, F(value) ); } );
+        KKTRow
+        ( i, n1, n2, double(reg), -double(reg),
+          [&]( Int j, double value ) { J.QueueUpdate( i, j, F(value) ); } );
+    }
+    JOrig.ProcessQueues();
+    J.ProcessQueues();
+
+    ldl::NodeInfo info;
+    ldl::Separator rootSep;
+    vector<Int> map, invMap;
+    ldl::NestedDissection( J.LockedGraph(), map, rootSep, info );
+    InvertMap( map, invMap );
+
+    ldl::Front<F> front( J, map, info );
+    LDL( info, front, LDL_2D );
+    SparseMatrix<FLow> JLow;
+    Copy( J, JLow );
+    ldl::Front<FLow> frontLow( JLow, map, info );
+    LDL( info, frontLow, LDL_2D );
+
+    Matrix<Real> regZero, d;
+    Zeros( regZero, N, 1 );
+    Ones( d, N, 1 );
+    Matrix<F> B;
+    Zeros( B, N, 1 );
+    for( Int i=0; i<N; ++i )
+        B(i) = F(RHSEntry(i));
+
+    Matrix<F> X( B ), XMixed( B );
+    reg_ldl::SolveAfter( JOrig, regZero, d, invMap, info, front, X, ctrl );
+    reg_ldl::MixedSolveAfter
+    ( JOrig, regZero, d, invMap, info, frontLow, XMixed, ctrl );
+    CheckResiduals
+    ( BuildString("Sequential ",TypeName<F>()," with ",TypeName<FLow>()),
+      RelativeResidual( JOrig, B, X ), RelativeResidual( JOrig, B, XMixed ),
+      ctrl.relTol, mpi::COMM_SELF );
+}
+
+template<typename F>
+void TestDistributed
+( Int n1, Int n2, Base<F> reg, const RegSolveCtrl<Base<F>>& ctrl,
+  mpi::Comm comm )
+{
+    typedef Base<F> Real;
+    typedef Demote<F> FLow;
+    const Int n = n1*n2;
+    const Int N = n + n/2;
+
+    DistSparseMatrix<F> JOrig(comm), J(comm);
+    Zeros( JOrig, N, N );
+    Zeros( J, N, N );
+    for( Int iLoc=0; iLoc<J.LocalHeight(); ++iLoc )
+    {
+        const Int i = J.GlobalRow( iLoc );
+        KKTRow
+        ( i, n1, n2, 0, 0,
+          [&]( Int j, double value )
+          { JOrig.QueueLocalUpdate( iLoc, j, F(value) ); } );
+        KKTRow
+        ( i, n1, n2, double(reg), -double(reg),
+          [&]( Int j, double value )
+          { J.QueueLocalUpdate( iLoc, j, F(value) ); } );
+    }
+    JOrig.ProcessQueues();
+    J.ProcessQueues();
+
+    ldl::DistNodeInfo info;
+    ldl::DistSeparator rootSep;
+    DistMap map, invMap;
+    ldl::NestedDissection( J.DistGraph(), map, rootSep, info );
+    InvertMap( map, invMap );
+
+    ldl::DistFront<F> front( J, map, rootSep, info );
+    LDL( info, front, LDL_2D );
+    DistSparseMatrix<FLow> JLow(comm);
+    Copy( J, JLow );
+    ldl::DistFront<FLow> frontLow( JLow, map, rootSep, info );
+    LDL( info, frontLow, LDL_2D );
+
+    DistMultiVec<Real> regZero(comm), d(comm);
+    Zeros( regZero, N, 1 );
+    Ones( d, N, 1 );
+    DistMultiVec<F> B(comm);
+    Zeros( B, N, 1 );
+    for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+        B.SetLocal( iLoc, 0, F(RHSEntry(B.GlobalRow(iLoc))) );
+
+    DistMultiVec<F> X( B ), XMixed( B );
+    reg_ldl::SolveAfter( JOrig, regZero, d, invMap, info, front, X, ctrl );
+    reg_ldl::MixedSolveAfter
+    ( JOrig, regZero, d, invMap, info, frontLow, XMixed, ctrl );
+    CheckResiduals
+    ( BuildString("Distributed ",TypeName<F>()," with ",TypeName<FLow>()),
+      RelativeResidual( JOrig, B, X ), RelativeResidual( JOrig, B, XMixed ),
+      ctrl.relTol, comm );
+}
+
+template<typename F>
+void TestMixedSolve
+( Int n1, Int n2, Int maxIts, bool sequential, bool progress, mpi::Comm comm )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    // Regularize the factorization by roughly the square-root of the unit
+    // roundoff of the demoted precision, as the IPMs do
+    const Real reg = Sqrt(Real(limits::Epsilon<Demote<Real>>()));
+
+    RegSolveCtrl<Real> ctrl;
+    ctrl.relTol = Pow(eps,Real(0.75));
+    ctrl.maxIts = maxIts;
+    ctrl.progress = progress;
+
+    if( sequential && mpi::Rank(comm) == 0 )
+        TestSequential<F>( n1, n2, reg, ctrl );
+    TestDistributed<F>( n1, n2, reg, ctrl, comm );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int maxIts = Input("--maxIts","maximum Krylov iterations",50);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        TestMixedSolve<double>( n1, n2, maxIts, sequential, progress, comm );
+#ifdef EL_HAVE_QD
+        TestMixedSolve<DoubleDouble>
+        ( n1, n2, maxIts, sequential, progress, comm );
+#endif
+#ifdef EL_HAVE_QUAD
+        TestMixedSolve<Quad>( n1, n2, maxIts, sequential, progress, comm );
+#endif
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
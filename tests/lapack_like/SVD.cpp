@@ -22,6 +22,8 @@ void TestSequentialSVD
   bool useQR,
   bool penalizeDerivative,
   Int divideCutoff,
+  bool twoStage,
+  Int bandwidth,
   bool print )
 {
     typedef Base<F> Real;
@@ -51,6 +53,8 @@ void TestSequentialSVD
     ctrl.bidiagSVDCtrl.dcCtrl.secularCtrl.penalizeDerivative =
       penalizeDerivative;
     ctrl.bidiagSVDCtrl.dcCtrl.secularCtrl.progress = progress;
+    ctrl.twoStageBidiag = twoStage;
+    ctrl.bidiagBandwidth = bandwidth;
     ctrl.time = time;
 
     Matrix<Real> s;
@@ -163,6 +167,8 @@ void TestDistributedSVD
   bool useQR,
   bool penalizeDerivative,
   Int divideCutoff,
+  bool twoStage,
+  Int bandwidth,
   bool print )
 {
     typedef Base<F> Real;
@@ -192,6 +198,8 @@ void TestDistributedSVD
     ctrl.bidiagSVDCtrl.dcCtrl.secularCtrl.penalizeDerivative =
       penalizeDerivative;
     ctrl.bidiagSVDCtrl.dcCtrl.secularCtrl.progress = progress;
+    ctrl.twoStageBidiag = twoStage;
+    ctrl.bidiagBandwidth = bandwidth;
     ctrl.time = time;
 
     ctrl.time = time;
@@ -329,20 +337,32 @@ void TestSVD
   bool useQR,
   bool penalizeDerivative,
   Int divideCutoff,
+  Int stages,
+  Int bandwidth,
   bool print )
 {
     const int commRank = mpi::Rank();
-    if( testSeq && commRank == 0 )
+    for( Int twoStage=0; twoStage<2; ++twoStage )
     {
-        TestSequentialSVD<F>
-        ( m, n, rank, approach, tolType, tol, time, progress, wantU, wantV,
-          useQR, penalizeDerivative, divideCutoff, print );
-    }
-    if( testDist )
-    {
-        TestDistributedSVD<F> 
-        ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          wantU, wantV, useQR, penalizeDerivative, divideCutoff, print );
+        if( stages != 2 && stages != twoStage )
+            continue;
+        OutputFromRoot
+        (mpi::COMM_WORLD,"Testing the ",(twoStage ? "two" : "one"),
+         "-stage reduction to bidiagonal form");
+        if( testSeq && commRank == 0 )
+        {
+            TestSequentialSVD<F>
+            ( m, n, rank, approach, tolType, tol, time, progress, wantU, wantV,
+              useQR, penalizeDerivative, divideCutoff, twoStage, bandwidth,
+              print );
+        }
+        if( testDist )
+        {
+            TestDistributedSVD<F> 
+            ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+              wantU, wantV, useQR, penalizeDerivative, divideCutoff, twoStage,
+              bandwidth, print );
+        }
     }
 }
 
@@ -381,6 +401,12 @@ main( int argc, char* argv[] )
           Input
           ("--penalizeDerivative","penalize secular derivative in D&C?",false);
         const Int divideCutoff = Input("--divideCutoff","D&C cutoff?",60);
+        const Int stages =
+          Input
+          ("--stages",
+           "reduction to bidiagonal (0: one-stage, 1: two-stage, 2: both)",2);
+        const Int bandwidth =
+          Input("--bandwidth","bandwidth of two-stage reduction",0);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -405,61 +431,61 @@ main( int argc, char* argv[] )
         TestSVD<float>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, stages, bandwidth, print );
         TestSVD<Complex<float>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, stages, bandwidth, print );
 
         TestSVD<double>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, stages, bandwidth, print );
         TestSVD<Complex<double>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, stages, bandwidth, print );
 
 #ifdef EL_HAVE_QD
         TestSVD<DoubleDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, stages, bandwidth, print );
         TestSVD<Complex<DoubleDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, stages, bandwidth, print );
 
         TestSVD<QuadDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, stages, bandwidth, print );
         TestSVD<Complex<QuadDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, stages, bandwidth, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestSVD<Quad>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, stages, bandwidth, print );
         TestSVD<Complex<Quad>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, stages, bandwidth, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestSVD<BigFloat>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, stages, bandwidth, print );
         TestSVD<Complex<BigFloat>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, stages, bandwidth, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
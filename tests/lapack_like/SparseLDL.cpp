@@ -150,7 +150,9 @@ void TestSparseDirect
      "  max entries:   ",maxLocalEntriesBefore,"\n",Indent(),
      "  total entries: ",entriesBefore,"\n");
 
-    OutputFromRoot(comm,"Running LDL^T and redistribution...");
+    OutputFromRoot
+    (comm,"Running LDL^T and redistribution with ",MaxThreads(),
+     " threads per process...");
     SetBlocksize( nbFact );
     mpi::Barrier( comm );
     timer.Start();
@@ -177,6 +179,15 @@ void TestSparseDirect
     const double factSpeed = factGFlops / factTime;
     OutputFromRoot(comm,factTime," seconds, ",factSpeed," GFlop/s");
 
+    // The updates of concurrently factored subtrees must respect the budget
+    const Int taskPeak =
+      mpi::AllReduce( ldl::SubtreeTaskMemoryPeak(), mpi::MAX, comm );
+    OutputFromRoot
+    (comm,"Peak reserved subtree-task update entries: ",taskPeak," (limit ",
+     ldl::SubtreeTaskMemoryLimit(),")");
+    if( taskPeak > ldl::SubtreeTaskMemoryLimit() )
+        LogicError("Subtree tasks exceeded the update memory budget");
+
     // Memory usage after factorization
     const Int localEntriesAfter = front.NumLocalEntries();
     const Int minLocalEntriesAfter = 
@@ -246,6 +257,10 @@ int main( int argc, char* argv[] )
         const Int nbFact = Input("--nbFact","factorization blocksize",96);
         const Int nbSolve = Input("--nbSolve","solve blocksize",96);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const double taskCutoff =
+          Input("--taskCutoff","flop cutoff for subtree tasks",0.);
+        const Int taskMemLimit =
+          Input("--taskMemLimit","entry budget for subtree tasks",20000);
         const bool unpack = Input("--unpack","unpack frontal matrix?",true);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
@@ -254,6 +269,9 @@ int main( int argc, char* argv[] )
 #endif
         ProcessInput();
 
+        ldl::SetSubtreeTaskCutoff( taskCutoff );
+        ldl::SetSubtreeTaskMemoryLimit( taskMemLimit );
+
         BisectCtrl ctrl;
         ctrl.sequential = sequential;
         ctrl.numSeqSeps = numSeqSeps;
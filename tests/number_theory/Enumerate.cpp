@@ -0,0 +1,120 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Ensure that B v is a lattice member with the claimed norm
+template<typename F>
+void CheckMember
+( const Matrix<F>& B, const Matrix<F>& v, Base<F> norm, const string& label )
+{
+    typedef Base<F> Real;
+    for( Int j=0; j<v.Height(); ++j )
+        if( v(j) != Round(v(j)) )
+            LogicError(label,": coefficient ",j," was not an integer");
+    if( MaxNorm(v) == Real(0) )
+        LogicError(label,": the coefficients were all zero");
+    Matrix<F> x;
+    Zeros( x, B.Height(), 1 );
+    Gemv( NORMAL, F(1), B, v, F(0), x );
+    const Real xNorm = FrobeniusNorm( x );
+    if( Abs(xNorm-norm) > 1e-8*Max(norm,Real(1)) )
+        LogicError(label,": || B v ||_2 = ",xNorm," but ",norm," was claimed");
+}
+
+template<typename F>
+void TestEnumeration
+( Int n, Int maxEntry, Int splitDepth, Int numTrials, unsigned seed )
+{
+    typedef Base<F> Real;
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+
+    Matrix<F> B, R;
+    Zeros( B, n, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            B(i,j) = F(SampleUniform(-maxEntry,maxEntry+1));
+    LLL( B, R );
+
+    EnumCtrl<Real> seqCtrl, parCtrl;
+    parCtrl.parallel = true;
+    parCtrl.splitDepth = splitDepth;
+
+    // Full enumeration is deterministic, so the subtree split must find the
+    // same shortest vector norm
+    seqCtrl.enumType = FULL_ENUM;
+    parCtrl.enumType = FULL_ENUM;
+    Matrix<F> vSeq, vPar;
+    Timer timer;
+    timer.Start();
+    const Real seqNorm = ShortestVectorEnumeration( B, R, vSeq, seqCtrl );
+    Output("Sequential FULL_ENUM: ",seqNorm," in ",timer.Stop()," seconds");
+    timer.Start();
+    const Real parNorm = ShortestVectorEnumeration( B, R, vPar, parCtrl );
+    Output("Parallel FULL_ENUM:   ",parNorm," in ",timer.Stop()," seconds");
+    CheckMember( B, vSeq, seqNorm, "Sequential FULL_ENUM" );
+    CheckMember( B, vPar, parNorm, "Parallel FULL_ENUM" );
+    if( Abs(seqNorm-parNorm) > 1e-8*seqNorm )
+        LogicError
+        ("Parallel FULL_ENUM found ",parNorm," rather than ",seqNorm);
+
+    // GNR trials are randomized, but the earliest successful trial is kept
+    // and the trial bases are formed in the same order, so the results agree
+    // from the same seed
+    seqCtrl.enumType = GNR_ENUM;
+    parCtrl.enumType = GNR_ENUM;
+    seqCtrl.numTrials = numTrials;
+    parCtrl.numTrials = numTrials;
+    const Real bound = Real(1.01)*seqNorm;
+    Generator().seed( seed );
+    const Real seqGNR = ShortVectorEnumeration( B, R, bound, vSeq, seqCtrl );
+    Generator().seed( seed );
+    const Real parGNR = ShortVectorEnumeration( B, R, bound, vPar, parCtrl );
+    Output("Sequential GNR_ENUM: ",seqGNR);
+    Output("Parallel GNR_ENUM:   ",parGNR);
+    if( (seqGNR < bound) != (parGNR < bound) ||
+        (seqGNR < bound && Abs(seqGNR-parGNR) > 1e-8*seqGNR) )
+        LogicError("Parallel GNR_ENUM found ",parGNR," rather than ",seqGNR);
+    if( seqGNR < bound )
+    {
+        CheckMember( B, vSeq, seqGNR, "Sequential GNR_ENUM" );
+        CheckMember( B, vPar, parGNR, "Parallel GNR_ENUM" );
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","dimension of lattice",30);
+        const Int maxEntry = Input("--maxEntry","maximum basis entry",100);
+        const Int splitDepth =
+          Input("--splitDepth","depth of the subtree split",4);
+        const Int numTrials = Input("--numTrials","number of GNR trials",100);
+        const unsigned seed = Input("--seed","random seed",17u);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+#ifndef EL_HYBRID
+            Output("NOTE: Without OpenMP, both paths run sequentially");
+#endif
+            TestEnumeration<double>( n, maxEntry, splitDepth, numTrials, seed );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
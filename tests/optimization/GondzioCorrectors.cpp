@@ -0,0 +1,229 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Each storage format is given its own problems. In each, A has full row rank,
+// b = A 1 makes x = 1 primal feasible, c > 0 makes the dual feasible, and Q is
+// positive definite, so each problem has a finite optimal value.
+
+// Queue the nonzeros of row i of the sparse constraint matrix, which has a
+// dominant diagonal
+template<class QueueFunc>
+void ConstraintRow( Int i, Int n, QueueFunc queue )
+{
+    const Int jFar = (5*i+1) % n;
+    queue( i, 6. );
+    if( i+1 < n )
+        queue( i+1, -2. );
+    if( jFar != i && jFar != i+1 )
+        queue( jFar, 1. );
+}
+
+// y := A x
+void Apply
+( const Matrix<double>& A, const Matrix<double>& x, Matrix<double>& y )
+{ Gemv( NORMAL, 1., A, x, 0., y ); }
+
+void Apply
+( const ElementalMatrix<double>& A, const ElementalMatrix<double>& x,
+        ElementalMatrix<double>& y )
+{ Gemv( NORMAL, 1., A, x, 0., y ); }
+
+void Apply
+( const SparseMatrix<double>& A, const Matrix<double>& x, Matrix<double>& y )
+{ Multiply( NORMAL, 1., A, x, 0., y ); }
+
+void Apply
+( const DistSparseMatrix<double>& A, const DistMultiVec<double>& x,
+        DistMultiVec<double>& y )
+{ Multiply( NORMAL, 1., A, x, 0., y ); }
+
+// Solve one of the four problem classes with the given number of correctors
+// and return its primal objective
+template<class MatrixType,class VecType>
+double Solve
+( const MatrixType& Q, const MatrixType& A, const MatrixType& G,
+  const VecType& b, const VecType& c, const VecType& h,
+  bool quadratic, bool affine, bool sparse, Int numCorrectors, bool print )
+{
+    VecType x( b ), y( b ), z( b ), s( b );
+    if( affine )
+    {
+        if( quadratic )
+        {
+            qp::affine::Ctrl<double> ctrl;
+            ctrl.mehrotraCtrl.maxGondzioCorrectors = numCorrectors;
+            ctrl.mehrotraCtrl.print = print;
+            QP( Q, A, G, b, c, h, x, y, z, s, ctrl );
+        }
+        else
+        {
+            lp::affine::Ctrl<double> ctrl;
+            ctrl.mehrotraCtrl.maxGondzioCorrectors = numCorrectors;
+            ctrl.mehrotraCtrl.print = print;
+            LP( A, G, b, c, h, x, y, z, s, ctrl );
+        }
+    }
+    else
+    {
+        if( quadratic )
+        {
+            qp::direct::Ctrl<double> ctrl;
+            ctrl.mehrotraCtrl.maxGondzioCorrectors = numCorrectors;
+            ctrl.mehrotraCtrl.print = print;
+            QP( Q, A, b, c, x, y, z, ctrl );
+        }
+        else
+        {
+            lp::direct::Ctrl<double> ctrl( sparse );
+            ctrl.mehrotraCtrl.maxGondzioCorrectors = numCorrectors;
+            ctrl.mehrotraCtrl.print = print;
+            LP( A, b, c, x, y, z, ctrl );
+        }
+    }
+
+    double objective = Dot( c, x );
+    if( quadratic )
+    {
+        VecType Qx( x );
+        Apply( Q, x, Qx );
+        objective += Dot( x, Qx ) / 2;
+    }
+    return objective;
+}
+
+// With and without Gondzio's correctors, the IPMs must reach the same optimum
+template<class MatrixType,class VecType>
+void TestCorrectors
+( const string& label, const MatrixType& Q, const MatrixType& A,
+  const MatrixType& G, const VecType& b, const VecType& c, const VecType& h,
+  bool sparse, Int numCorrectors, bool print )
+{
+    const double tol = 100*Sqrt(limits::Epsilon<double>());
+    for( Int form=0; form<4; ++form )
+    {
+        const bool quadratic = ( form >= 2 );
+        const bool affine = ( form % 2 == 1 );
+        const string problem =
+          BuildString
+          (label,(affine ? " affine " : " direct "),(quadratic ? "QP" : "LP"));
+        const double objective =
+          Solve( Q, A, G, b, c, h, quadratic, affine, sparse, 0, print );
+        const double correctedObjective =
+          Solve
+          ( Q, A, G, b, c, h, quadratic, affine, sparse, numCorrectors,
+            print );
+        OutputFromRoot
+        (mpi::COMM_WORLD,problem,": ",objective," without and ",
+         correctedObjective," with correctors");
+        if( Abs(objective-correctedObjective) > tol*(1+Abs(objective)) )
+            LogicError
+            (problem,": the objectives ",objective," and ",correctedObjective,
+             " differed");
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","number of equality constraints",50);
+        const Int n = Input("--n","number of variables",100);
+        const Int numCorrectors =
+          Input("--numCorrectors","maximum number of Gondzio correctors",3);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( m > n )
+            LogicError("There must be at least as many variables as rows");
+
+        if( sequential && mpi::Rank(comm) == 0 )
+        {
+            Matrix<double> Q, A, G, b, c, h, ones;
+            Laplacian( Q, n );
+            Uniform( A, m, n );
+            ShiftDiagonal( A, 10. );
+            Identity( G, n, n );
+            G *= -1;
+            Ones( ones, n, 1 );
+            Zeros( b, m, 1 );
+            Apply( A, ones, b );
+            Uniform( c, n, 1, 2., 1. );
+            Zeros( h, n, 1 );
+            TestCorrectors
+            ( "Sequential dense", Q, A, G, b, c, h, false, numCorrectors,
+              print );
+
+            SparseMatrix<double> QSparse, ASparse, GSparse;
+            Laplacian( QSparse, n );
+            Zeros( ASparse, m, n );
+            for( Int i=0; i<m; ++i )
+                ConstraintRow
+                ( i, n,
+                  [&]( Int j, double value )
+                  { ASparse.QueueUpdate( i, j, value ); } );
+            ASparse.ProcessQueues();
+            Identity( GSparse, n, n );
+            GSparse *= -1;
+            Apply( ASparse, ones, b );
+            TestCorrectors
+            ( "Sequential sparse", QSparse, ASparse, GSparse, b, c, h, true,
+              numCorrectors, print );
+        }
+
+        const Grid grid( comm );
+        DistMatrix<double> Q(grid), A(grid), G(grid), b(grid), c(grid),
+          h(grid), ones(grid);
+        Laplacian( Q, n );
+        Uniform( A, m, n );
+        ShiftDiagonal( A, 10. );
+        Identity( G, n, n );
+        G *= -1;
+        Ones( ones, n, 1 );
+        Zeros( b, m, 1 );
+        Apply( A, ones, b );
+        Uniform( c, n, 1, 2., 1. );
+        Zeros( h, n, 1 );
+        TestCorrectors
+        ( "Distributed dense", Q, A, G, b, c, h, false, numCorrectors,
+          print );
+
+        DistSparseMatrix<double> QSparse(comm), ASparse(comm), GSparse(comm);
+        DistMultiVec<double> bSparse(comm), cSparse(comm), hSparse(comm),
+          onesSparse(comm);
+        Laplacian( QSparse, n );
+        Zeros( ASparse, m, n );
+        for( Int iLoc=0; iLoc<ASparse.LocalHeight(); ++iLoc )
+            ConstraintRow
+            ( ASparse.GlobalRow(iLoc), n,
+              [&]( Int j, double value )
+              { ASparse.QueueLocalUpdate( iLoc, j, value ); } );
+        ASparse.ProcessQueues();
+        Identity( GSparse, n, n );
+        GSparse *= -1;
+        Ones( onesSparse, n, 1 );
+        Zeros( bSparse, m, 1 );
+        Apply( ASparse, onesSparse, bSparse );
+        Uniform( cSparse, n, 1, 2., 1. );
+        Zeros( hSparse, n, 1 );
+        TestCorrectors
+        ( "Distributed sparse", QSparse, ASparse, GSparse, bSparse, cSparse,
+          hSparse, true, numCorrectors, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,262 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The sparse direct-form IPMs assemble the static portion of their full or
+// augmented KKT system once and then finish a copy of it with frozen sparsity
+// in each iteration, whereas the dense IPMs form their systems from scratch.
+// Both must therefore reach the same optimum of
+//
+//   min (1/2) x^T Q x + c^T x, s.t. A x = b, x >= 0,
+//
+// where Q = 0 for an LP.
+
+// Queue row i of the constraint matrix, which has a dominant diagonal and a
+// wrapped off-diagonal entry, and return the row sum so that x = 1 is strictly
+// feasible for b = A 1
+template<class QueueFunc>
+double ConstraintRow( Int i, Int n, QueueFunc queue )
+{
+    const Int jWrap = (3*i+n/2) % n;
+    const double wrapValue = ( i % 2 == 0 ? 1. : -2. );
+    queue( i, 5. );
+    queue( i+1, -1. );
+    if( jWrap != i && jWrap != i+1 )
+    {
+        queue( jWrap, wrapValue );
+        return 4 + wrapValue;
+    }
+    return 4;
+}
+
+// Queue row j of the positive-definite tridiagonal Hessian of the QP
+template<class QueueFunc>
+void HessianRow( Int j, Int n, QueueFunc queue )
+{
+    queue( j, 3. );
+    if( j > 0 )
+        queue( j-1, -1. );
+    if( j+1 < n )
+        queue( j+1, -1. );
+}
+
+double Cost( Int j ) { return 1 + double(j % 4)/4; }
+
+// Solve with the sparse direct IPM using the given KKT system, check that
+// A x = b, and return the objective
+template<class SparseType,class VecType>
+double SolveSparse
+( const string& label, const SparseType& Q, const SparseType& A,
+  const VecType& b, const VecType& c, bool quadratic, KKTSystem system,
+  bool print )
+{
+    VecType x( b ), y( b ), z( b );
+    if( quadratic )
+    {
+        qp::direct::Ctrl<double> ctrl;
+        ctrl.mehrotraCtrl.system = system;
+        ctrl.mehrotraCtrl.print = print;
+        QP( Q, A, b, c, x, y, z, ctrl );
+    }
+    else
+    {
+        lp::direct::Ctrl<double> ctrl(true);
+        ctrl.mehrotraCtrl.system = system;
+        ctrl.mehrotraCtrl.print = print;
+        LP( A, b, c, x, y, z, ctrl );
+    }
+
+    VecType r( b );
+    Multiply( NORMAL, -1., A, x, 1., r );
+    const double primalResid = FrobeniusNorm( r ) / (1+FrobeniusNorm( b ));
+    if( primalResid > 100*Sqrt(limits::Epsilon<double>()) )
+        LogicError(label,": || b - A x ||_2 / (1 + || b ||_2) = ",primalResid);
+
+    double objective = Dot( c, x );
+    if( quadratic )
+    {
+        VecType Qx( x );
+        Multiply( NORMAL, 1., Q, x, 0., Qx );
+        objective += Dot( x, Qx ) / 2;
+    }
+    return objective;
+}
+
+// Every process redundantly solves the dense problem for a reference optimum
+double DenseObjective( Int m, Int n, bool quadratic, bool print )
+{
+    Matrix<double> Q, A, b, c;
+    Zeros( Q, n, n );
+    Zeros( A, m, n );
+    Zeros( b, m, 1 );
+    Zeros( c, n, 1 );
+    for( Int i=0; i<m; ++i )
+        b(i) = ConstraintRow
+          ( i, n, [&]( Int j, double value ) { A(i,j) += value; } );
+    for( Int j=0; j<n; ++j )
+    {
+        c(j) = Cost( j );
+        if( quadratic )
+            HessianRow
+            ( j, n, [&]( Int k, double value ) { Q(j,k) += value; } );
+    }
+
+    Matrix<double> x, y, z;
+    if( quadratic )
+    {
+        qp::direct::Ctrl<double> ctrl;
+        ctrl.mehrotraCtrl.print = print;
+        QP( Q, A, b, c, x, y, z, ctrl );
+    }
+    else
+    {
+        lp::direct::Ctrl<double> ctrl(false);
+        ctrl.mehrotraCtrl.print = print;
+        LP( A, b, c, x, y, z, ctrl );
+    }
+
+    double objective = Dot( c, x );
+    if( quadratic )
+    {
+        Matrix<double> Qx;
+        Gemv( NORMAL, 1., Q, x, Qx );
+        objective += Dot( x, Qx ) / 2;
+    }
+    return objective;
+}
+
+void CheckObjective
+( const string& label, double objective, double refObjective )
+{
+    OutputFromRoot
+    (mpi::COMM_WORLD,label,": objective of ",objective," versus ",
+     refObjective," for the dense IPM");
+    const double tol = 100*Sqrt(limits::Epsilon<double>());
+    if( Abs(objective-refObjective) > tol*(1+Abs(refObjective)) )
+        LogicError
+        (label,": the objectives ",objective," and ",refObjective," differed");
+}
+
+void TestSequential
+( Int m, Int n, bool quadratic, KKTSystem system, double refObjective,
+  bool print )
+{
+    SparseMatrix<double> Q, A;
+    Matrix<double> b, c;
+    Zeros( Q, n, n );
+    Zeros( A, m, n );
+    Zeros( b, m, 1 );
+    Zeros( c, n, 1 );
+    for( Int i=0; i<m; ++i )
+        b(i) = ConstraintRow
+          ( i, n,
+            [&]( Int j, double value ) { A.QueueUpdate( i, j, value ); } );
+    for( Int j=0; j<n; ++j )
+    {
+        c(j) = Cost( j );
+        if( quadratic )
+            HessianRow
+            ( j, n,
+              [&]( Int k, double value ) { Q.QueueUpdate( j, k, value ); } );
+    }
+    A.ProcessQueues();
+    Q.ProcessQueues();
+
+    const string label =
+      BuildString
+      ("Sequential ",(quadratic ? "QP" : "LP"),
+       (system == FULL_KKT ? " with the full" : " with the augmented"),
+       " system");
+    const double objective =
+      SolveSparse( label, Q, A, b, c, quadratic, system, print );
+    CheckObjective( label, objective, refObjective );
+}
+
+void TestDistributed
+( Int m, Int n, bool quadratic, KKTSystem system, double refObjective,
+  bool print, mpi::Comm comm )
+{
+    DistSparseMatrix<double> Q(comm), A(comm);
+    DistMultiVec<double> b(comm), c(comm);
+    Zeros( Q, n, n );
+    Zeros( A, m, n );
+    Zeros( b, m, 1 );
+    Zeros( c, n, 1 );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow( iLoc );
+        b.SetLocal
+        ( iLoc, 0,
+          ConstraintRow
+          ( i, n,
+            [&]( Int j, double value )
+            { A.QueueLocalUpdate( iLoc, j, value ); } ) );
+    }
+    for( Int jLoc=0; jLoc<Q.LocalHeight(); ++jLoc )
+    {
+        const Int j = Q.GlobalRow( jLoc );
+        c.SetLocal( jLoc, 0, Cost(j) );
+        if( quadratic )
+            HessianRow
+            ( j, n,
+              [&]( Int k, double value )
+              { Q.QueueLocalUpdate( jLoc, k, value ); } );
+    }
+    A.ProcessQueues();
+    Q.ProcessQueues();
+
+    const string label =
+      BuildString
+      ("Distributed ",(quadratic ? "QP" : "LP"),
+       (system == FULL_KKT ? " with the full" : " with the augmented"),
+       " system");
+    const double objective =
+      SolveSparse( label, Q, A, b, c, quadratic, system, print );
+    CheckObjective( label, objective, refObjective );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","number of equality constraints",30);
+        const Int n = Input("--n","number of variables",60);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( m >= n )
+            LogicError("There must be more variables than constraints");
+
+        for( Int form=0; form<2; ++form )
+        {
+            const bool quadratic = ( form == 1 );
+            const double refObjective =
+              DenseObjective( m, n, quadratic, print );
+            const KKTSystem systems[2] = { FULL_KKT, AUGMENTED_KKT };
+            for( const KKTSystem system : systems )
+            {
+                if( sequential && mpi::Rank(comm) == 0 )
+                    TestSequential
+                    ( m, n, quadratic, system, refObjective, print );
+                TestDistributed
+                ( m, n, quadratic, system, refObjective, print, comm );
+            }
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,356 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A sparse direct conic-form QP, min (1/2) x^T Q x + c^T x, s.t. A x = b,
+// x >= 0, with Q = 0 for an LP
+struct Problem
+{
+    SparseMatrix<double> Q, A;
+    Matrix<double> b, c;
+};
+
+enum Defect {
+  NO_DEFECT,
+  EMPTY_ROW_DEFECT,
+  SINGLETON_ROW_DEFECT,
+  DUPLICATE_ROW_DEFECT,
+  UNBOUNDED_COLUMN_DEFECT
+};
+
+// Append every reduction to a well-posed core problem. The core has m0 rows
+// with a dominant diagonal and n0 > m0 columns, and the appended columns are
+//
+//   n0:          fixed to 1.5 by a singleton row, and also in core row 0,
+//   n0+1, n0+2:  zeroed by a forcing row, and also in core row 1,
+//   n0+3:        an empty column with a positive cost,
+//   n0+4:        an empty column with a positive diagonal in Q (for a QP),
+//   n0+5, n0+6:  column singletons in core rows 2 and 3 whose costs imply
+//                y_2, y_3 >= -1,
+//   n0+7:        a column in core rows 2 and 3 which these bounds dominate,
+//
+// while the appended rows are the singleton and forcing rows as well as twice
+// core row 4. The right-hand side is formed from a feasible point, and the
+// costs (and Q) make the problem bounded, unless a defect is requested.
+Problem BuildProblem( Int m0, Int n0, bool quadratic, Defect defect )
+{
+    if( m0 < 5 || n0 <= m0 )
+        LogicError("The core must have at least five rows and more columns");
+    const Int n = n0 + 8;
+    const Int m = m0 + 3 + ( defect == EMPTY_ROW_DEFECT ? 1 : 0 );
+    Problem problem;
+    Zeros( problem.A, m, n );
+    Zeros( problem.Q, n, n );
+    Zeros( problem.c, n, 1 );
+
+    auto coreEntry = []( Int i, Int j ) -> double
+    {
+        if( i == j )
+            return 10;
+        if( (i+2*j) % 5 == 0 )
+            return double((3*i+7*j) % 9 - 4);
+        return 0;
+    };
+    for( Int i=0; i<m0; ++i )
+        for( Int j=0; j<n0; ++j )
+            if( coreEntry(i,j) != 0 )
+                problem.A.QueueUpdate( i, j, coreEntry(i,j) );
+    problem.A.QueueUpdate( 0, n0, 1 );
+    problem.A.QueueUpdate( 1, n0+1, 1 );
+    problem.A.QueueUpdate( 1, n0+2, -1 );
+    problem.A.QueueUpdate( 2, n0+5, 1 );
+    problem.A.QueueUpdate( 3, n0+6, 1 );
+    problem.A.QueueUpdate( 2, n0+7, 1 );
+    problem.A.QueueUpdate( 3, n0+7, 1 );
+    // The singleton, forcing, and duplicate rows
+    problem.A.QueueUpdate( m0, n0, 2 );
+    problem.A.QueueUpdate( m0+1, n0+1, 1 );
+    problem.A.QueueUpdate( m0+1, n0+2, 3 );
+    for( Int j=0; j<n0; ++j )
+        if( coreEntry(4,j) != 0 )
+            problem.A.QueueUpdate( m0+2, j, 2*coreEntry(4,j) );
+    problem.A.ProcessQueues();
+
+    for( Int j=0; j<n0; ++j )
+        problem.c(j) = 1 + double(j % 5)/5;
+    problem.c(n0) = 1;
+    problem.c(n0+1) = 1;
+    problem.c(n0+2) = 1;
+    problem.c(n0+3) = ( defect == UNBOUNDED_COLUMN_DEFECT ? -1 : 2 );
+    problem.c(n0+4) = ( quadratic ? -3 : 1 );
+    problem.c(n0+5) = 1;
+    problem.c(n0+6) = 1;
+    problem.c(n0+7) = 5;
+    if( quadratic )
+    {
+        for( Int j=0; j<n0; ++j )
+        {
+            problem.Q.QueueUpdate( j, j, 2 );
+            if( j > 0 )
+                problem.Q.QueueUpdate( j, j-1, -1 );
+            if( j < n0-1 )
+                problem.Q.QueueUpdate( j, j+1, -1 );
+        }
+        problem.Q.QueueUpdate( n0+4, n0+4, 2 );
+        problem.Q.ProcessQueues();
+    }
+
+    Matrix<double> xFeas;
+    Ones( xFeas, n, 1 );
+    xFeas(n0) = 1.5;
+    xFeas(n0+1) = 0;
+    xFeas(n0+2) = 0;
+    Zeros( problem.b, m, 1 );
+    Multiply( NORMAL, 1., problem.A, xFeas, 0., problem.b );
+    if( defect == EMPTY_ROW_DEFECT )
+        problem.b(m-1) = 1;
+    else if( defect == SINGLETON_ROW_DEFECT )
+        problem.b(m0) = -2;
+    else if( defect == DUPLICATE_ROW_DEFECT )
+        problem.b(m0+2) += 1;
+    return problem;
+}
+
+// After presolve removes the singleton row, only the columns coupled through
+// Q remain
+Problem BuildCoupledProblem()
+{
+    Problem problem;
+    Zeros( problem.A, 1, 3 );
+    problem.A.QueueUpdate( 0, 0, 2 );
+    problem.A.ProcessQueues();
+    Zeros( problem.Q, 3, 3 );
+    problem.Q.QueueUpdate( 1, 1, 2 );
+    problem.Q.QueueUpdate( 1, 2, -1 );
+    problem.Q.QueueUpdate( 2, 1, -1 );
+    problem.Q.QueueUpdate( 2, 2, 2 );
+    problem.Q.ProcessQueues();
+    Zeros( problem.b, 1, 1 );
+    problem.b(0) = 3;
+    Zeros( problem.c, 3, 1 );
+    problem.c(0) = 1;
+    problem.c(1) = -1;
+    problem.c(2) = -2;
+    return problem;
+}
+
+// The IPMs only guarantee their minimum tolerance on degenerate problems, and
+// the unreduced problems are degenerate (e.g., the forcing row has no
+// interior)
+double Tolerance() { return 10*Pow(limits::Epsilon<double>(),0.3); }
+
+void SolveSequential
+( const Problem& problem, bool quadratic, bool presolve,
+  Matrix<double>& x, Matrix<double>& y, Matrix<double>& z )
+{
+    if( quadratic )
+    {
+        qp::direct::Ctrl<double> ctrl;
+        ctrl.presolveCtrl.enable = presolve;
+        QP( problem.Q, problem.A, problem.b, problem.c, x, y, z, ctrl );
+    }
+    else
+    {
+        lp::direct::Ctrl<double> ctrl(true);
+        ctrl.presolveCtrl.enable = presolve;
+        LP( problem.A, problem.b, problem.c, x, y, z, ctrl );
+    }
+}
+
+// Every process holds the full problem, so each queues its own rows
+void Distribute
+( const SparseMatrix<double>& ALoc, DistSparseMatrix<double>& A )
+{
+    Zeros( A, ALoc.Height(), ALoc.Width() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow( iLoc );
+        for( Int e=ALoc.RowOffset(i); e<ALoc.RowOffset(i+1); ++e )
+            A.QueueLocalUpdate( iLoc, ALoc.Col(e), ALoc.Value(e) );
+    }
+    A.ProcessQueues();
+}
+
+void Distribute( const Matrix<double>& xLoc, DistMultiVec<double>& x )
+{
+    Zeros( x, xLoc.Height(), 1 );
+    for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
+        x.SetLocal( iLoc, 0, xLoc(x.GlobalRow(iLoc)) );
+}
+
+// Solve with the distributed driver and gather the solution onto the root
+void SolveDistributed
+( const Problem& problem, bool quadratic, bool presolve,
+  Matrix<double>& x, Matrix<double>& y, Matrix<double>& z )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    DistSparseMatrix<double> Q(comm), A(comm);
+    DistMultiVec<double> b(comm), c(comm), xDist(comm), yDist(comm),
+      zDist(comm);
+    Distribute( problem.Q, Q );
+    Distribute( problem.A, A );
+    Distribute( problem.b, b );
+    Distribute( problem.c, c );
+    if( quadratic )
+    {
+        qp::direct::Ctrl<double> ctrl;
+        ctrl.presolveCtrl.enable = presolve;
+        QP( Q, A, b, c, xDist, yDist, zDist, ctrl );
+    }
+    else
+    {
+        lp::direct::Ctrl<double> ctrl(true);
+        ctrl.presolveCtrl.enable = presolve;
+        LP( A, b, c, xDist, yDist, zDist, ctrl );
+    }
+    if( mpi::Rank(comm) == 0 )
+    {
+        CopyFromRoot( xDist, x );
+        CopyFromRoot( yDist, y );
+        CopyFromRoot( zDist, z );
+    }
+    else
+    {
+        CopyFromNonRoot( xDist, 0 );
+        CopyFromNonRoot( yDist, 0 );
+        CopyFromNonRoot( zDist, 0 );
+    }
+}
+
+// Check primal feasibility, dual feasibility with z = c + Q x + A^T y >= 0,
+// and complementarity, and return the objective
+double CheckSolution
+( const Problem& problem, const Matrix<double>& x, const Matrix<double>& y,
+  const Matrix<double>& z, const string& label )
+{
+    const double tol = Tolerance();
+    const Int m = problem.A.Height();
+    const Int n = problem.A.Width();
+    if( x.Height() != n || y.Height() != m || z.Height() != n )
+        LogicError(label,": the solution had the wrong dimensions");
+
+    Matrix<double> r( problem.b );
+    Multiply( NORMAL, -1., problem.A, x, 1., r );
+    const double rNorm = FrobeniusNorm( r ) / (1+FrobeniusNorm(problem.b));
+
+    Matrix<double> dualRes( problem.c ), Qx;
+    Zeros( Qx, n, 1 );
+    Multiply( NORMAL, 1., problem.Q, x, 0., Qx );
+    dualRes += Qx;
+    Multiply( TRANSPOSE, 1., problem.A, y, 1., dualRes );
+    dualRes -= z;
+    const double dualNorm =
+      FrobeniusNorm( dualRes ) / (1+FrobeniusNorm(problem.c));
+
+    const double objective = Dot( problem.c, x ) + Dot( x, Qx ) / 2;
+    const double gap = Abs(Dot( x, z )) / (1+Abs(objective));
+    Output
+    (label,": objective=",objective,", primal residual=",rNorm,
+     ", dual residual=",dualNorm,", complementarity=",gap,
+     ", min(x)=",Min(x)," min(z)=",Min(z));
+    if( rNorm > tol )
+        LogicError(label,": A x != b");
+    if( dualNorm > tol )
+        LogicError(label,": z != c + Q x + A^T y");
+    if( Min(x) < -tol || Min(z) < -tol )
+        LogicError(label,": x or z was not nonnegative");
+    if( gap > tol )
+        LogicError(label,": x and z were not complementary");
+    return objective;
+}
+
+template<typename SolveType>
+void TestSolution
+( const Problem& problem, bool quadratic, const string& label,
+  SolveType solve )
+{
+    Matrix<double> x, y, z, xPre, yPre, zPre;
+    solve( problem, quadratic, false, x, y, z );
+    solve( problem, quadratic, true, xPre, yPre, zPre );
+    if( mpi::Rank() != 0 )
+        return;
+    const double objective = CheckSolution( problem, x, y, z, label );
+    const double objectivePre =
+      CheckSolution( problem, xPre, yPre, zPre, label+" with presolve" );
+    if( Abs(objective-objectivePre) > Tolerance()*(1+Abs(objective)) )
+        LogicError
+        (label,": the objectives ",objective," and ",objectivePre,
+         " differed");
+}
+
+// Presolve must detect the defect, on every process, before the IPM starts
+template<typename SolveType>
+void TestDefect
+( const Problem& problem, bool quadratic, const string& label,
+  const string& expected, SolveType solve )
+{
+    Matrix<double> x, y, z;
+    string message;
+    try { solve( problem, quadratic, true, x, y, z ); }
+    catch( std::exception& e ) { message = e.what(); }
+    if( message.empty() )
+        LogicError(label,": the defect was not detected");
+    if( mpi::Rank() == 0 && message.find(expected) == string::npos )
+        LogicError
+        (label,": expected a message containing \"",expected,"\" but found \"",
+         message,"\"");
+    OutputFromRoot(mpi::COMM_WORLD,label,": ",message);
+}
+
+template<typename SolveType>
+void TestDriver
+( Int m0, Int n0, const string& driver, SolveType solve )
+{
+    OutputFromRoot(mpi::COMM_WORLD,"Testing the ",driver," driver");
+    PushIndent();
+    for( Int form=0; form<2; ++form )
+    {
+        const bool quadratic = ( form == 1 );
+        const string type = ( quadratic ? "QP" : "LP" );
+        TestSolution
+        ( BuildProblem(m0,n0,quadratic,NO_DEFECT), quadratic, type, solve );
+        TestDefect
+        ( BuildProblem(m0,n0,quadratic,EMPTY_ROW_DEFECT), quadratic,
+          type+" with an inconsistent empty row", "is empty", solve );
+        TestDefect
+        ( BuildProblem(m0,n0,quadratic,SINGLETON_ROW_DEFECT), quadratic,
+          type+" with an infeasible singleton row", "forces", solve );
+        TestDefect
+        ( BuildProblem(m0,n0,quadratic,DUPLICATE_ROW_DEFECT), quadratic,
+          type+" with an inconsistent duplicate row", "inconsistent", solve );
+        TestDefect
+        ( BuildProblem(m0,n0,quadratic,UNBOUNDED_COLUMN_DEFECT), quadratic,
+          type+" with an unbounded column", "unbounded", solve );
+    }
+    TestSolution( BuildCoupledProblem(), true, "Coupled QP", solve );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m0 = Input("--m0","number of core rows",20);
+        const Int n0 = Input("--n0","number of core columns",40);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( sequential && mpi::Rank() == 0 )
+            TestDriver( m0, n0, "sequential", SolveSequential );
+        TestDriver( m0, n0, "distributed", SolveDistributed );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}